@@ -1,13 +1,28 @@
-
 // ------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------
 
 #include <errno.h>
+#include <fcntl.h>
+#include <math.h>
 #include <modbus.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "common_thermia.h"
 
@@ -16,70 +31,236 @@
 
 typedef enum { REG_COIL_STATUS = 0x01, REG_INPUT_STATUS = 0x02, REG_INPUT = 0x04, REG_HOLDING = 0x08 } reg_type_t;
 
+// what lookups and block reads touch, packed into 16 bytes a register so the table stays in few cache lines
 typedef struct {
     const char *name;
-    reg_type_t type;
-    int address;
+    uint8_t type; // reg_type_t
+    uint16_t address;
+    uint16_t scale;
+    uint8_t model; // model_t flags
+    uint8_t group; // system and subsystem, interned in the group table
+} register_def_t;
+
+// what only describes a register, by handle
+typedef struct {
     int defacto;
-    int scale;
-    model_t model;
-    const char *system;
-    const char *subsystem;
     const char *description;
-} register_def_t;
+} register_info_t;
+
+typedef enum { VALUE_BIT, VALUE_S16, VALUE_U16, VALUE_U32_MSB, VALUE_U32_LSB } value_kind_t; // halves of a u32 pair
+
+typedef struct {
+    reg_type_t type;
+    uint16_t address, length; // addresses covered by one block read
+    uint16_t first, count;    // positions covered in the model order
+} register_run_t;
+
+typedef struct {
+    const char *system, *subsystem;
+} register_group_t;
+
+typedef struct {
+    uint16_t first, count;           // positions of the group's supported registers
+    uint16_t runs_first, runs_count; // its block reads
+} register_group_plan_t;
+
+typedef struct {
+    model_t model;
+    const uint16_t *order;     // handles by position: supported registers ordered by type then address
+    const int16_t *positions;  // position by handle, -1 if unsupported
+    const uint16_t *runs_of;   // run by position
+    int count;
+    const register_run_t *runs;
+    int runs_count;
+    const register_group_plan_t *groups; // by group, into group_positions and group_runs
+    const uint16_t *group_positions;
+    const register_run_t *group_runs;
+} register_model_table_t;
+
+typedef struct {
+    int16_t value, reported, deadband; // latest, at last change, change threshold (all raw)
+    bool valid;
+    uint32_t changed_sequence;
+    uint64_t updated_ms;
+} cache_entry_t;
+
+#ifdef THERMIA_STATS
+#define STATS_FUNCTIONS 8
+#define STATS_BUCKETS 240 // log-linear: 8 sub-buckets per power of two of microseconds
+
+typedef struct {
+    uint64_t count, errors, timeouts, retries, bytes_sent, bytes_received;
+    uint32_t latency_max_us;
+    uint32_t latency[STATS_BUCKETS];
+} stats_function_t;
+#endif
+
+struct thermia_modbus {
+    modbus_t *modbus;
+    char address[256];
+    int port;
+    model_t model;
+    const register_model_table_t *table;
+    pthread_mutex_t io_lock; // serialises requests on the connection, guards the request policy
+    uint32_t response_timeout_ms, byte_timeout_ms; // also applied to the breaker probe's connection
+    int retries;
+    uint32_t backoff_ms, backoff_max_ms;
+    int breaker_threshold, breaker_failures;
+    uint32_t breaker_probe_ms;
+    _Atomic bool breaker_open; // read without the I/O lock, so failing fast never waits behind a probe
+    uint64_t breaker_probe_due_ms;
+    uint64_t requested_ms; // last request sent, for the heartbeat
+    uint32_t keepalive_idle_s, keepalive_interval_s, keepalive_count;
+    uint32_t heartbeat_idle_ms;
+    bool heartbeat_started, heartbeat_stop; // thread started (heartbeat or breaker probes), asked to stop on close
+    pthread_t heartbeat_thread;
+    pthread_cond_t heartbeat_changed; // with the I/O lock
+    uint8_t *planner; // learned flags by position, guarded by the I/O lock
+    bool planner_dirty;
+    char planner_path[256], planner_key[64];
+    pthread_mutex_t cache_lock; // guards cache entries and sequence (and stats)
+    uint32_t cache_sequence;
+#ifdef THERMIA_STATS
+    stats_function_t stats[STATS_FUNCTIONS];
+#endif
+    cache_entry_t cache[]; // by handle
+};
 
 // ------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------
 
-static modbus_t *g_ctx = NULL;
-static model_t g_model = MODEL_MEGA;
-
-static const register_def_t g_registers[] = {
 #include "common_thermia_registers.h"
-};
+#include "common_thermia_registers_index.h"
+_Static_assert(REGISTERS_HASH_SLOTS == sizeof(g_registers) / sizeof(register_def_t), "register index does not match register table");
+_Static_assert(sizeof(g_registers_info) / sizeof(register_info_t) == sizeof(g_registers) / sizeof(register_def_t), "register info does not match register table");
+_Static_assert(sizeof(register_def_t) <= 16, "register table rows no longer packed");
+_Static_assert(REGISTERS_SOURCE_HASH == REGISTERS_INDEX_SOURCE_HASH, "register index and register table generated from different sources");
 static const int g_num_registers = sizeof(g_registers) / sizeof(register_def_t);
 
+static const char *register_system(const register_def_t *reg) { return g_registers_groups[reg->group].system; }
+static const char *register_subsystem(const register_def_t *reg) { return g_registers_groups[reg->group].subsystem; }
+static const char *register_description(const register_def_t *reg) { return g_registers_info[reg - g_registers].description; }
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+static uint64_t time_now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+static uint64_t time_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
 // ------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------
 
+// FNV-1a, seeded: must match hashName() in common_thermia_registers.js
+static uint32_t register_hash(const char *name, uint32_t seed) {
+    uint32_t hash = 0x811c9dc5u ^ seed;
+    while (*name)
+        hash = (hash ^ (uint8_t)*name++) * 0x01000193u;
+    return hash;
+}
+
+// minimal perfect hash generated with the table: one hash picks the bucket seed, one more hash (or the seed itself) picks
+// the slot, and a single strcmp rejects names that are not in the table
 static const register_def_t *find_register(const char *name, reg_type_t type) {
-    for (int i = 0; i < g_num_registers; i++)
-        if (strcmp(g_registers[i].name, name) == 0 && g_registers[i].type & type)
-            return &g_registers[i];
+    const int seed = g_registers_hash_seeds[register_hash(name, 0) % REGISTERS_HASH_BUCKETS];
+    const int slot = seed < 0 ? -seed - 1 : (int)(register_hash(name, (uint32_t)seed) % REGISTERS_HASH_SLOTS);
+    const register_def_t *reg = &g_registers[g_registers_hash_slots[slot]];
+    return strcmp(reg->name, name) == 0 && reg->type & type ? reg : NULL;
+}
+static bool is_register_supported(const thermia_modbus_t *ctx, const register_def_t *reg) { return ctx->table->positions[reg - g_registers] >= 0; }
+
+static const register_model_table_t *find_model_table(model_t model) {
+    for (size_t i = 0; i < sizeof(g_registers_models) / sizeof(register_model_table_t); i++)
+        if (g_registers_models[i].model == model)
+            return &g_registers_models[i];
     return NULL;
 }
-static bool is_register_supported(const register_def_t *reg) { return reg->model & g_model; }
 
 // ------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------
 
-bool thermia_modbus_open(const char *address, int port, model_t model) {
-    if (g_ctx != NULL) {
-        fprintf(stderr, "modbus: initialised already\n");
-        return false;
+#define REQUEST_TIMEOUT_MS_DEFAULT 500 // libmodbus default, response and byte
+#define REQUEST_RETRIES_DEFAULT 2
+#define REQUEST_BACKOFF_MS_DEFAULT 100
+#define REQUEST_BACKOFF_MAX_MS_DEFAULT 1000
+#define BREAKER_THRESHOLD_DEFAULT 3
+#define BREAKER_PROBE_MS_DEFAULT 5000
+
+thermia_modbus_t *thermia_modbus_open(const char *address, int port, model_t model) {
+    const register_model_table_t *table = find_model_table(model);
+    if (table == NULL) {
+        fprintf(stderr, "modbus: model unknown: 0x%02x\n", model);
+        return NULL;
+    }
+    thermia_modbus_t *ctx = calloc(1, sizeof(thermia_modbus_t) + sizeof(cache_entry_t) * (size_t)g_num_registers);
+    if (ctx == NULL || (ctx->planner = calloc((size_t)table->count, sizeof(uint8_t))) == NULL) {
+        fprintf(stderr, "modbus: initialisation failed: %s\n", strerror(errno));
+        free(ctx);
+        return NULL;
     }
-    g_model = model;
-    g_ctx = modbus_new_tcp(address, port);
-    if (g_ctx == NULL) {
+    snprintf(ctx->address, sizeof(ctx->address), "%s", address);
+    ctx->port = port;
+    ctx->model = model;
+    ctx->table = table;
+    ctx->response_timeout_ms = REQUEST_TIMEOUT_MS_DEFAULT;
+    ctx->byte_timeout_ms = REQUEST_TIMEOUT_MS_DEFAULT;
+    ctx->retries = REQUEST_RETRIES_DEFAULT;
+    ctx->backoff_ms = REQUEST_BACKOFF_MS_DEFAULT;
+    ctx->backoff_max_ms = REQUEST_BACKOFF_MAX_MS_DEFAULT;
+    ctx->breaker_threshold = BREAKER_THRESHOLD_DEFAULT;
+    ctx->breaker_probe_ms = BREAKER_PROBE_MS_DEFAULT;
+    pthread_mutex_init(&ctx->io_lock, NULL);
+    pthread_mutex_init(&ctx->cache_lock, NULL);
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC); // deadlines are time_now_ms
+    pthread_cond_init(&ctx->heartbeat_changed, &attr);
+    pthread_condattr_destroy(&attr);
+    ctx->modbus = modbus_new_tcp(address, port);
+    if (ctx->modbus == NULL) {
         fprintf(stderr, "modbus: initialisation failed: %s\n", modbus_strerror(errno));
-        return false;
+        pthread_mutex_destroy(&ctx->io_lock);
+        pthread_mutex_destroy(&ctx->cache_lock);
+        pthread_cond_destroy(&ctx->heartbeat_changed);
+        free(ctx->planner);
+        free(ctx);
+        return NULL;
     }
-    modbus_set_slave(g_ctx, 1);
-    if (modbus_connect(g_ctx) == -1) {
+    modbus_set_slave(ctx->modbus, 1);
+    if (modbus_connect(ctx->modbus) == -1) {
         fprintf(stderr, "modbus: connection failed: %s\n", modbus_strerror(errno));
-        modbus_free(g_ctx);
-        g_ctx = NULL;
-        return false;
+        modbus_free(ctx->modbus);
+        pthread_mutex_destroy(&ctx->io_lock);
+        pthread_mutex_destroy(&ctx->cache_lock);
+        pthread_cond_destroy(&ctx->heartbeat_changed);
+        free(ctx->planner);
+        free(ctx);
+        return NULL;
     }
-    printf("modbus: connected to %s:502 (model: %s)\n", address, model == MODEL_MEGA ? "MEGA" : "INVERTER");
-    return true;
+    fprintf(stderr, "modbus: connected to %s:%d (model: %s)\n", address, port, model == MODEL_MEGA ? "MEGA" : "INVERTER");
+    return ctx;
 }
 
-void thermia_modbus_close(void) {
-    if (g_ctx != NULL) {
-        modbus_close(g_ctx);
-        modbus_free(g_ctx);
-        g_ctx = NULL;
+static void heartbeat_stop(thermia_modbus_t *ctx);
+
+void thermia_modbus_close(thermia_modbus_t *ctx) {
+    if (ctx != NULL) {
+        heartbeat_stop(ctx);
+        modbus_close(ctx->modbus);
+        modbus_free(ctx->modbus);
+        pthread_mutex_destroy(&ctx->io_lock);
+        pthread_mutex_destroy(&ctx->cache_lock);
+        pthread_cond_destroy(&ctx->heartbeat_changed);
+        free(ctx->planner);
+        free(ctx);
     }
 }
 
@@ -87,181 +268,4989 @@ void thermia_modbus_close(void) {
 // ------------------------------------------------------------------------------------------------------------------------
 
 #define MODBUS_CHECK(ctx)                                                                                                                                      \
-    if (ctx == NULL) {                                                                                                                                         \
+    if (ctx == NULL || ctx->modbus == NULL) {                                                                                                                  \
         fprintf(stderr, "modbus: not initialised/connected\n");                                                                                                \
         return false;                                                                                                                                          \
     }
-#define REGISTER_CHECK(reg)                                                                                                                                    \
+#define REGISTER_CHECK(ctx, reg)                                                                                                                               \
     if (reg == NULL) {                                                                                                                                         \
         fprintf(stderr, "register: '%s' not found\n", name);                                                                                                   \
         return false;                                                                                                                                          \
     }                                                                                                                                                          \
-    if (!is_register_supported(reg)) {                                                                                                                         \
+    if (!is_register_supported(ctx, reg)) {                                                                                                                    \
         fprintf(stderr, "register: '%s' not supported by model\n", name);                                                                                      \
         return false;                                                                                                                                          \
     }
 
-bool thermia_modbus_read_register_bit(const char *name, bool *value) {
-    MODBUS_CHECK(g_ctx);
+// caller holds the I/O lock (or is opening); keepalive probes keep idle sessions open through NAT and detect dead peers
+static bool connection_keepalive(thermia_modbus_t *ctx) {
+    const int fd = modbus_get_socket(ctx->modbus), enabled = ctx->keepalive_idle_s > 0;
+    const int idle = (int)ctx->keepalive_idle_s, interval = (int)ctx->keepalive_interval_s, count = (int)ctx->keepalive_count;
+    if (fd == -1)
+        return true; // applied on connect
+    return setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &enabled, sizeof(enabled)) != -1 &&
+           (!enabled || (setsockopt(fd, IPPROTO_TCP, TCP_KEEPIDLE, &idle, sizeof(idle)) != -1 &&
+                         setsockopt(fd, IPPROTO_TCP, TCP_KEEPINTVL, &interval, sizeof(interval)) != -1 &&
+                         setsockopt(fd, IPPROTO_TCP, TCP_KEEPCNT, &count, sizeof(count)) != -1));
+}
 
-    const register_def_t *reg = find_register(name, REG_COIL_STATUS | REG_INPUT_STATUS);
-    REGISTER_CHECK(reg);
+// caller holds the I/O lock
+static bool connection_connect(thermia_modbus_t *ctx) {
+    if (modbus_connect(ctx->modbus) == -1)
+        return false;
+    if (ctx->keepalive_idle_s > 0 && !connection_keepalive(ctx))
+        fprintf(stderr, "modbus: failed to set keepalive: %s\n", strerror(errno));
+    return true;
+}
 
-    uint8_t reg_value;
-    int rc;
-    if (reg->type == REG_COIL_STATUS)
-        rc = modbus_read_bits(g_ctx, reg->address, 1, &reg_value);
-    else
-        rc = modbus_read_input_bits(g_ctx, reg->address, 1, &reg_value);
-    if (rc == -1) {
-        fprintf(stderr, "register: failed to read bit: %s\n", modbus_strerror(errno));
+// caller holds the I/O lock; true if the peer closed the connection (or it was never open), without waiting
+static bool connection_is_closed(thermia_modbus_t *ctx) {
+    const int fd = modbus_get_socket(ctx->modbus);
+    if (fd == -1)
+        return true;
+    uint8_t byte;
+    const ssize_t received = recv(fd, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    return received == 0 || (received == -1 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+}
+
+bool thermia_modbus_reconnect(thermia_modbus_t *ctx) {
+    MODBUS_CHECK(ctx);
+
+    pthread_mutex_lock(&ctx->io_lock);
+    modbus_close(ctx->modbus);
+    const bool connected = connection_connect(ctx);
+    const int error = errno;
+    pthread_mutex_unlock(&ctx->io_lock);
+    if (!connected) {
+        fprintf(stderr, "modbus: reconnection failed: %s\n", modbus_strerror(error));
         return false;
     }
-
-    *value = reg_value != 0;
     return true;
 }
 
-bool thermia_modbus_read_register_int(const char *name, int *value) {
-    MODBUS_CHECK(g_ctx);
+static bool is_register_type_bit(reg_type_t type) { return type == REG_COIL_STATUS || type == REG_INPUT_STATUS; }
 
-    const register_def_t *reg = find_register(name, REG_INPUT | REG_HOLDING);
-    REGISTER_CHECK(reg);
+static uint8_t register_read_function(reg_type_t type) { return type == REG_HOLDING ? 0x03 : (uint8_t)type; }
+static uint8_t register_write_function(reg_type_t type, int count) { return type == REG_COIL_STATUS ? (count == 1 ? 0x05 : 0x0F) : (count == 1 ? 0x06 : 0x10); }
 
-    uint16_t reg_value;
-    int rc;
-    if (reg->type == REG_INPUT)
-        rc = modbus_read_input_registers(g_ctx, reg->address, 1, &reg_value);
-    else
-        rc = modbus_read_registers(g_ctx, reg->address, 1, &reg_value);
-    if (rc == -1) {
-        fprintf(stderr, "register: failed to read int: %s\n", modbus_strerror(errno));
+/*
+ * Values: raw register values are as read (sign extended 16 bit); in engineering units they are scaled by the
+ * multiplier (1 / scale) and read as the kind the generator gave them, with both halves of a u32 pair giving the
+ * whole value. Halves on their own read as unsigned 16 bit.
+ */
+
+static double register_value(thermia_modbus_handle_t handle, int value) {
+    return (double)(g_registers_kinds[handle] <= VALUE_S16 ? value : value & 0xffff) * g_registers_multipliers[handle];
+}
+
+static double register_value_pair(const uint16_t *pair, int msb, int lsb) {
+    return (double)((uint32_t)(msb & 0xffff) << 16 | (uint32_t)(lsb & 0xffff)) * g_registers_multipliers[pair[0]];
+}
+
+static const uint16_t *register_value_pair_of(thermia_modbus_handle_t handle) {
+    for (int i = 0; i < REGISTERS_VALUE_PAIRS; i++)
+        if (g_registers_value_pairs[i][0] == handle || g_registers_value_pairs[i][1] == handle)
+            return g_registers_value_pairs[i];
+    return NULL;
+}
+
+// decimals implied by the scale (10 -> 1, 100 -> 2), so scaled values print exactly
+static int format_value(char *buffer, size_t size, thermia_modbus_handle_t handle, double value) {
+    if (g_registers_kinds[handle] == VALUE_BIT)
+        return snprintf(buffer, size, "%d", value != 0);
+    int decimals = 0;
+    for (int scale = g_registers[handle].scale; scale > 1; scale /= 10)
+        decimals++;
+    return snprintf(buffer, size, "%.*f", decimals, value);
+}
+
+static int format_register_scaled(char *buffer, size_t size, const register_def_t *reg, int value) {
+    return format_value(buffer, size, reg - g_registers, register_value(reg - g_registers, value));
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Stats (built with THERMIA_STATS, otherwise the hooks compile away): every Modbus transaction on a context is counted
+ * by function code with its bytes on the wire (TCP payload: MBAP header and PDU), errors, timeouts, retries (requests
+ * reissued after a failure, e.g. block reads falling back to single reads) and its latency in an HDR style histogram
+ * with 3 significant bits, so percentiles are within 12.5% from microseconds to seconds at a fixed 1KB per function.
+ */
+
+#ifdef THERMIA_STATS
+
+static const uint8_t g_stats_functions[STATS_FUNCTIONS] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x0F, 0x10};
+static const char *const g_stats_function_names[STATS_FUNCTIONS] = {
+    "read_coils",        "read_discrete_inputs",  "read_holding_registers", "read_input_registers",
+    "write_single_coil", "write_single_register", "write_multiple_coils",   "write_multiple_registers"};
+
+static int stats_bucket(uint32_t value) {
+    if (value < 8)
+        return (int)value;
+    const int magnitude = 31 - __builtin_clz(value);
+    return (magnitude - 2) * 8 + (int)((value >> (magnitude - 3)) & 7);
+}
+
+static uint32_t stats_bucket_lower(int bucket) { return bucket < 8 ? (uint32_t)bucket : (uint32_t)(8 + bucket % 8) << (bucket / 8 - 1); }
+
+static stats_function_t *stats_function(thermia_modbus_t *ctx, uint8_t function) {
+    for (int i = 0; i < STATS_FUNCTIONS; i++)
+        if (g_stats_functions[i] == function)
+            return &ctx->stats[i];
+    return NULL;
+}
+
+// wire size of request and response for 'quantity' registers, the response as an exception if failed (or none if timed out)
+static void stats_record(thermia_modbus_t *ctx, uint8_t function, int quantity, bool ok, int error, uint64_t latency_us) {
+    const bool writes_bits = function == 0x0F, writes_registers = function == 0x10, reads_bits = function <= 0x02, reads_registers = function <= 0x04;
+    const uint32_t sent = 12 + (writes_bits ? 1 + (uint32_t)(quantity + 7) / 8 : writes_registers ? 1 + 2 * (uint32_t)quantity : 0);
+    const uint32_t received = !ok ? (error == ETIMEDOUT ? 0 : 9)
+                              : reads_bits      ? 9 + (uint32_t)(quantity + 7) / 8
+                              : reads_registers ? 9 + 2 * (uint32_t)quantity
+                                                : 12;
+    const uint32_t latency = latency_us > UINT32_MAX ? UINT32_MAX : (uint32_t)latency_us;
+    pthread_mutex_lock(&ctx->cache_lock);
+    stats_function_t *stats = stats_function(ctx, function);
+    if (stats != NULL) {
+        stats->count++;
+        stats->errors += !ok;
+        stats->timeouts += !ok && error == ETIMEDOUT;
+        stats->bytes_sent += sent;
+        stats->bytes_received += received;
+        stats->latency[stats_bucket(latency)]++;
+        if (latency > stats->latency_max_us)
+            stats->latency_max_us = latency;
+    }
+    pthread_mutex_unlock(&ctx->cache_lock);
+    errno = error;
+}
+
+static void stats_retry(thermia_modbus_t *ctx, uint8_t function, int count) {
+    pthread_mutex_lock(&ctx->cache_lock);
+    stats_function_t *stats = stats_function(ctx, function);
+    if (stats != NULL)
+        stats->retries += (uint64_t)count;
+    pthread_mutex_unlock(&ctx->cache_lock);
+}
+
+static uint32_t stats_percentile(const stats_function_t *stats, double percentile) {
+    const uint64_t rank = (uint64_t)ceil((double)stats->count * percentile / 100.0);
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < STATS_BUCKETS; bucket++)
+        if ((seen += stats->latency[bucket]) >= rank && seen > 0) {
+            const uint32_t upper = bucket + 1 < STATS_BUCKETS ? stats_bucket_lower(bucket + 1) - 1 : UINT32_MAX;
+            return upper < stats->latency_max_us ? upper : stats->latency_max_us;
+        }
+    return 0;
+}
+
+int thermia_modbus_stats(thermia_modbus_t *ctx, thermia_modbus_stats_t *stats, int stats_max) {
+    if (ctx == NULL)
+        return 0;
+    int count = 0;
+    pthread_mutex_lock(&ctx->cache_lock);
+    for (int i = 0; i < STATS_FUNCTIONS && count < stats_max; i++) {
+        const stats_function_t *function = &ctx->stats[i];
+        if (function->count > 0)
+            stats[count++] = (thermia_modbus_stats_t){.function = g_stats_functions[i],
+                                                      .function_name = g_stats_function_names[i],
+                                                      .count = function->count,
+                                                      .errors = function->errors,
+                                                      .timeouts = function->timeouts,
+                                                      .retries = function->retries,
+                                                      .bytes_sent = function->bytes_sent,
+                                                      .bytes_received = function->bytes_received,
+                                                      .latency_p50_us = stats_percentile(function, 50),
+                                                      .latency_p90_us = stats_percentile(function, 90),
+                                                      .latency_p99_us = stats_percentile(function, 99),
+                                                      .latency_max_us = function->latency_max_us};
+    }
+    pthread_mutex_unlock(&ctx->cache_lock);
+    return count;
+}
+
+void thermia_modbus_stats_reset(thermia_modbus_t *ctx) {
+    if (ctx != NULL) {
+        pthread_mutex_lock(&ctx->cache_lock);
+        memset(ctx->stats, 0, sizeof(ctx->stats));
+        pthread_mutex_unlock(&ctx->cache_lock);
+    }
+}
+
+#define STATS_START(start_us) const uint64_t start_us = time_now_us()
+#define STATS_RECORD(ctx, function, quantity, ok, error, start_us) stats_record(ctx, function, quantity, ok, error, time_now_us() - (start_us))
+#define STATS_RETRY(ctx, function, count) stats_retry(ctx, function, count)
+
+#else
+
+int thermia_modbus_stats(thermia_modbus_t *ctx, thermia_modbus_stats_t *stats, int stats_max) {
+    (void)ctx;
+    (void)stats;
+    (void)stats_max;
+    return 0;
+}
+
+void thermia_modbus_stats_reset(thermia_modbus_t *ctx) { (void)ctx; }
+
+#define STATS_START(start_us)
+#define STATS_RECORD(ctx, function, quantity, ok, error, start_us)
+#define STATS_RETRY(ctx, function, count)
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Cache: every value read (or written) through a context is kept with its time, in a flat array by handle. Each read
+ * call is one cache sequence; an entry records the sequence in which it last changed by more than its deadband, so a
+ * consumer holding a cursor (last seen sequence) can iterate just what changed since it last looked. Updates are made
+ * against the next sequence and only published once the read call completes, so a cursor never skips part of a call.
+ */
+
+static void cache_update(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, int value, uint64_t now_ms) {
+    pthread_mutex_lock(&ctx->cache_lock);
+    cache_entry_t *entry = &ctx->cache[handle];
+    entry->value = (int16_t)value;
+    entry->updated_ms = now_ms;
+    if (!entry->valid || abs(value - entry->reported) > entry->deadband) {
+        entry->reported = (int16_t)value;
+        entry->changed_sequence = ctx->cache_sequence + 1;
+        entry->valid = true;
+    }
+    pthread_mutex_unlock(&ctx->cache_lock);
+}
+
+static void cache_publish(thermia_modbus_t *ctx) {
+    pthread_mutex_lock(&ctx->cache_lock);
+    ctx->cache_sequence++;
+    pthread_mutex_unlock(&ctx->cache_lock);
+}
+
+bool thermia_modbus_cache_get(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, int *value, uint32_t *age_ms) {
+    if (ctx == NULL || handle < 0 || handle >= g_num_registers)
+        return false;
+    pthread_mutex_lock(&ctx->cache_lock);
+    const cache_entry_t entry = ctx->cache[handle];
+    pthread_mutex_unlock(&ctx->cache_lock);
+    if (!entry.valid)
+        return false;
+    *value = entry.value;
+    if (age_ms != NULL)
+        *age_ms = (uint32_t)(time_now_ms() - entry.updated_ms);
+    return true;
+}
+
+bool thermia_modbus_cache_set_deadband(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, double deadband) {
+    if (ctx == NULL || handle < 0 || handle >= g_num_registers || deadband < 0)
         return false;
+    pthread_mutex_lock(&ctx->cache_lock);
+    ctx->cache[handle].deadband = (int16_t)lround(deadband * g_registers[handle].scale);
+    pthread_mutex_unlock(&ctx->cache_lock);
+    return true;
+}
+
+int thermia_modbus_cache_set_deadband_scale(thermia_modbus_t *ctx, int scale, double deadband) {
+    int count = 0;
+    for (int i = 0; i < g_num_registers; i++)
+        if (g_registers[i].scale == scale && !is_register_type_bit(g_registers[i].type) && thermia_modbus_cache_set_deadband(ctx, i, deadband))
+            count++;
+    return count;
+}
+
+int thermia_modbus_cache_changed(thermia_modbus_t *ctx, uint32_t *cursor, thermia_modbus_handle_t *handles, int handles_max) {
+    int count = 0;
+    pthread_mutex_lock(&ctx->cache_lock);
+    for (int i = 0; i < g_num_registers && count < handles_max; i++)
+        if (ctx->cache[i].valid && ctx->cache[i].changed_sequence - *cursor - 1 < ctx->cache_sequence - *cursor) // cursor < changed <= now, wrap safe
+            handles[count++] = (thermia_modbus_handle_t)i;
+    *cursor = ctx->cache_sequence;
+    pthread_mutex_unlock(&ctx->cache_lock);
+    return count;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Requests: every Modbus request goes through one policy. A request that fails for want of a response (timeout, dropped
+ * connection) is retried on a fresh connection after an exponential backoff; an exception is an answer and is not. After
+ * a number of consecutive unanswered requests the circuit breaker opens and requests fail at once, without touching the
+ * network, while the context's heartbeat thread probes the controller every probe interval with a connect and a single
+ * register read: success closes the breaker, failure keeps it open for another interval. The worst case stall of a
+ * request is bounded by (retries + 1) response timeouts plus the backoffs, and only the requests before the breaker
+ * opens pay it.
+ */
+
+static bool is_modbus_exception(int error) { return error > MODBUS_ENOBASE && error < MODBUS_ENOBASE + MODBUS_EXCEPTION_MAX; }
+
+static int request_send(modbus_t *modbus, uint8_t function, int address, int count, uint8_t *bits, uint16_t *registers) {
+    switch (function) {
+    case 0x01:
+        return modbus_read_bits(modbus, address, count, bits);
+    case 0x02:
+        return modbus_read_input_bits(modbus, address, count, bits);
+    case 0x03:
+        return modbus_read_registers(modbus, address, count, registers);
+    case 0x04:
+        return modbus_read_input_registers(modbus, address, count, registers);
+    case 0x05:
+        return modbus_write_bit(modbus, address, bits[0]);
+    case 0x06:
+        return modbus_write_register(modbus, address, registers[0]);
+    case 0x0F:
+        return modbus_write_bits(modbus, address, count, bits);
+    default:
+        return modbus_write_registers(modbus, address, count, registers);
     }
+}
+
+static void request_sleep_ms(uint32_t ms) {
+    struct timespec ts = {.tv_sec = ms / 1000, .tv_nsec = (long)(ms % 1000) * 1000000};
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR)
+        ;
+}
+
+static bool heartbeat_start(thermia_modbus_t *ctx);
 
-    *value = (int16_t)reg_value;
+// true, with errno ENOTCONN, while the breaker is open; needs no lock, so callers check before taking the I/O lock
+static bool breaker_fails_fast(thermia_modbus_t *ctx) {
+    if (!atomic_load_explicit(&ctx->breaker_open, memory_order_acquire))
+        return false;
+    errno = ENOTCONN;
     return true;
 }
 
-bool thermia_modbus_write_register_bit(const char *name, bool value) {
-    MODBUS_CHECK(g_ctx);
+// caller holds the I/O lock; 'bits' or 'registers' hold the data to write or receive the data read, errno is set on failure
+static bool request(thermia_modbus_t *ctx, uint8_t function, int address, int count, uint8_t *bits, uint16_t *registers) {
+    if (breaker_fails_fast(ctx))
+        return false;
+    uint32_t backoff_ms = ctx->backoff_ms;
+    for (int attempt = 0; attempt < ctx->retries + 1; attempt++) {
+        if (attempt > 0) {
+            STATS_RETRY(ctx, function, 1);
+            request_sleep_ms(backoff_ms);
+            backoff_ms = backoff_ms * 2 < ctx->backoff_max_ms ? backoff_ms * 2 : ctx->backoff_max_ms;
+            modbus_close(ctx->modbus);
+            if (!connection_connect(ctx))
+                continue;
+        }
+        ctx->requested_ms = time_now_ms();
+        STATS_START(start_us);
+        const int rc = request_send(ctx->modbus, function, address, count, bits, registers);
+        STATS_RECORD(ctx, function, count, rc != -1, errno, start_us);
+        if (rc != -1 || is_modbus_exception(errno)) {
+            ctx->breaker_failures = 0;
+            return rc != -1;
+        }
+    }
+    const int error = errno;
+    if (ctx->breaker_threshold > 0 && ++ctx->breaker_failures >= ctx->breaker_threshold && heartbeat_start(ctx)) {
+        fprintf(stderr, "modbus: %s:%d unavailable after %d failed requests, failing fast until a probe succeeds (every %u ms)\n", ctx->address, ctx->port,
+                ctx->breaker_failures, ctx->breaker_probe_ms);
+        ctx->breaker_probe_due_ms = time_now_ms() + ctx->breaker_probe_ms;
+        atomic_store_explicit(&ctx->breaker_open, true, memory_order_release);
+        pthread_cond_signal(&ctx->heartbeat_changed);
+    }
+    errno = error;
+    return false;
+}
 
-    const register_def_t *reg = find_register(name, REG_COIL_STATUS);
-    REGISTER_CHECK(reg);
+bool thermia_modbus_set_timeouts(thermia_modbus_t *ctx, uint32_t response_timeout_ms, uint32_t byte_timeout_ms) {
+    MODBUS_CHECK(ctx);
 
-    if (modbus_write_bit(g_ctx, reg->address, value ? 1 : 0) == -1) {
-        fprintf(stderr, "register: failed to write bit: %s\n", modbus_strerror(errno));
+    pthread_mutex_lock(&ctx->io_lock);
+    const bool set = modbus_set_response_timeout(ctx->modbus, response_timeout_ms / 1000, (response_timeout_ms % 1000) * 1000) != -1 &&
+                     modbus_set_byte_timeout(ctx->modbus, byte_timeout_ms / 1000, (byte_timeout_ms % 1000) * 1000) != -1;
+    const int error = errno;
+    if (set) {
+        ctx->response_timeout_ms = response_timeout_ms;
+        ctx->byte_timeout_ms = byte_timeout_ms;
+    }
+    pthread_mutex_unlock(&ctx->io_lock);
+    if (!set) {
+        fprintf(stderr, "modbus: failed to set timeouts: %s\n", modbus_strerror(error));
+        return false;
+    }
+    return true;
+}
+
+bool thermia_modbus_set_retry(thermia_modbus_t *ctx, int retries, uint32_t backoff_ms, uint32_t backoff_max_ms) {
+    MODBUS_CHECK(ctx);
+    if (retries < 0 || backoff_max_ms < backoff_ms) {
+        fprintf(stderr, "modbus: invalid retry policy (retries %d, backoff %u..%u ms)\n", retries, backoff_ms, backoff_max_ms);
         return false;
     }
 
+    pthread_mutex_lock(&ctx->io_lock);
+    ctx->retries = retries;
+    ctx->backoff_ms = backoff_ms;
+    ctx->backoff_max_ms = backoff_max_ms;
+    pthread_mutex_unlock(&ctx->io_lock);
     return true;
 }
 
-bool thermia_modbus_write_register_int(const char *name, int value) {
-    MODBUS_CHECK(g_ctx);
+bool thermia_modbus_set_breaker(thermia_modbus_t *ctx, int threshold, uint32_t probe_interval_ms) {
+    MODBUS_CHECK(ctx);
+    if (threshold < 0) {
+        fprintf(stderr, "modbus: invalid breaker threshold %d\n", threshold);
+        return false;
+    }
+
+    pthread_mutex_lock(&ctx->io_lock);
+    ctx->breaker_threshold = threshold;
+    ctx->breaker_probe_ms = probe_interval_ms;
+    if (threshold == 0)
+        atomic_store_explicit(&ctx->breaker_open, false, memory_order_release);
+    ctx->breaker_failures = 0;
+    pthread_mutex_unlock(&ctx->io_lock);
+    return true;
+}
 
-    const register_def_t *reg = find_register(name, REG_HOLDING);
-    REGISTER_CHECK(reg);
+bool thermia_modbus_breaker_is_open(thermia_modbus_t *ctx) { return ctx != NULL && atomic_load_explicit(&ctx->breaker_open, memory_order_acquire); }
 
-    if (modbus_write_register(g_ctx, reg->address, (uint16_t)value) == -1) {
-        fprintf(stderr, "register: failed to write int: %s\n", modbus_strerror(errno));
+bool thermia_modbus_set_keepalive(thermia_modbus_t *ctx, uint32_t idle_s, uint32_t interval_s, uint32_t count) {
+    MODBUS_CHECK(ctx);
+    if (idle_s > 0 && (interval_s == 0 || count == 0)) {
+        fprintf(stderr, "modbus: invalid keepalive interval %u or count %u\n", interval_s, count);
         return false;
     }
 
+    pthread_mutex_lock(&ctx->io_lock);
+    ctx->keepalive_idle_s = idle_s;
+    ctx->keepalive_interval_s = interval_s;
+    ctx->keepalive_count = count;
+    const bool set = connection_keepalive(ctx);
+    const int error = errno;
+    pthread_mutex_unlock(&ctx->io_lock);
+    if (!set) {
+        fprintf(stderr, "modbus: failed to set keepalive: %s\n", strerror(error));
+        return false;
+    }
     return true;
 }
 
 // ------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------
 
-#ifdef TEST
-
-void print_usage(const char *prog) {
-    printf("Usage:\n");
-    printf("  %s <address> <model> read <register_name>\n", prog);
-    printf("  %s <address> <model> write <register_name> <value>\n", prog);
-    printf("\n");
-    printf("Models: mega, inverter\n");
-    printf("\n");
-    printf("Examples:\n");
-    printf("  %s 192.168.0.106 mega read valueHeatpumpBrineInTemperature\n", prog);
-    printf("  %s 192.168.0.106 mega read alarmHeatpumpBrineInSensor\n", prog);
-    printf("  %s 192.168.0.106 mega write enableHeatpumpResetAllAlarms 1\n", prog);
+// reads 'count' consecutive registers of one type starting at 'address', bits are returned as 0/1 and ints sign extended
+static bool read_block(thermia_modbus_t *ctx, reg_type_t type, int address, int count, int *values) {
+    uint8_t bits[MODBUS_MAX_READ_BITS];
+    uint16_t registers[MODBUS_MAX_READ_REGISTERS];
+    if (!request(ctx, register_read_function(type), address, count, bits, registers))
+        return false;
+    for (int i = 0; i < count; i++)
+        values[i] = is_register_type_bit(type) ? bits[i] != 0 : (int16_t)registers[i];
+    return true;
 }
 
-int main(int argc, char *argv[]) {
-    if (argc < 5) {
-        print_usage(argv[0]);
-        return 1;
-    }
+/*
+ * Heartbeat: a thread per context, started by the first heartbeat setting or the first time the breaker opens and kept
+ * until close. While the breaker is open it probes the controller every probe interval, a connect and a single
+ * register read on a connection of its own without the I/O lock, and on success swaps that connection in and closes
+ * the breaker, so no request of the owner ever waits on a dead controller. Otherwise, with a heartbeat set, it checks the connection every HEARTBEAT_CHECK_MS without any traffic
+ * (a peek at the socket shows whether the peer closed it) and reconnects at once if so, and sends a single register
+ * read once the connection has been idle for the heartbeat interval, so the session stays open and a dead one is
+ * found and replaced (by the request retry) here rather than by the next poll. It takes the I/O lock like any request.
+ */
 
-    const char *address = argv[1], *model_str = argv[2], *operation = argv[3];
+#define HEARTBEAT_CHECK_MS 1000
+#define HEARTBEAT_REGISTER "valueHeatpumpSoftwareVersionMajor"
 
-    model_t model;
-    if (strcmp(model_str, "mega") == 0)
-        model = MODEL_MEGA;
-    else if (strcmp(model_str, "inverter") == 0)
-        model = MODEL_INVERTER;
-    else {
-        fprintf(stderr, "model unknown, must be 'mega' or 'inverter': %s\n", model_str);
-        return EXIT_FAILURE;
+// without the I/O lock, on a connection of its own; returns it connected if the controller answered, NULL otherwise
+static modbus_t *breaker_probe(thermia_modbus_t *ctx, const register_def_t *reg, uint32_t response_timeout_ms, uint32_t byte_timeout_ms) {
+    modbus_t *modbus = modbus_new_tcp(ctx->address, ctx->port);
+    if (modbus == NULL)
+        return NULL;
+    modbus_set_slave(modbus, 1);
+    modbus_set_response_timeout(modbus, response_timeout_ms / 1000, (response_timeout_ms % 1000) * 1000);
+    modbus_set_byte_timeout(modbus, byte_timeout_ms / 1000, (byte_timeout_ms % 1000) * 1000);
+    if (modbus_connect(modbus) != -1) {
+        uint16_t registers[1];
+        STATS_START(start_us);
+        const int rc = request_send(modbus, register_read_function(reg->type), reg->address, 1, NULL, registers);
+        STATS_RECORD(ctx, register_read_function(reg->type), 1, rc != -1, errno, start_us);
+        if (rc != -1 || is_modbus_exception(errno))
+            return modbus;
     }
+    modbus_close(modbus);
+    modbus_free(modbus);
+    return NULL;
+}
 
-    if (!thermia_modbus_open(address, 502, model))
-        return EXIT_FAILURE;
+// caller holds the I/O lock, which is dropped while the probe waits on the network
+static void breaker_probe_swap(thermia_modbus_t *ctx, const register_def_t *reg) {
+    const uint32_t response_timeout_ms = ctx->response_timeout_ms, byte_timeout_ms = ctx->byte_timeout_ms;
+    pthread_mutex_unlock(&ctx->io_lock);
+    modbus_t *modbus = breaker_probe(ctx, reg, response_timeout_ms, byte_timeout_ms);
+    pthread_mutex_lock(&ctx->io_lock);
+    if (modbus == NULL) {
+        ctx->breaker_probe_due_ms = time_now_ms() + ctx->breaker_probe_ms;
+        return;
+    }
+    fprintf(stderr, "modbus: %s:%d available again\n", ctx->address, ctx->port);
+    modbus_close(ctx->modbus);
+    modbus_free(ctx->modbus);
+    ctx->modbus = modbus;
+    if (ctx->keepalive_idle_s > 0 && !connection_keepalive(ctx))
+        fprintf(stderr, "modbus: failed to set keepalive: %s\n", strerror(errno));
+    ctx->requested_ms = time_now_ms();
+    ctx->breaker_failures = 0;
+    atomic_store_explicit(&ctx->breaker_open, false, memory_order_release);
+}
 
-    if (strcmp(operation, "read") == 0) {
-        for (int argi = 4; argi < argc; argi++) {
-            const char *reg_name = argv[argi];
-            const register_def_t *reg = find_register(reg_name, REG_COIL_STATUS | REG_INPUT_STATUS | REG_INPUT | REG_HOLDING);
-            if (reg == NULL) {
-                fprintf(stderr, "register: not found '%s'\n", reg_name);
-                goto failure;
-            }
-            if (reg->type == REG_COIL_STATUS || reg->type == REG_INPUT_STATUS) {
-                bool value;
-                if (thermia_modbus_read_register_bit(reg_name, &value))
-                    printf("%s = %d (read)\n", reg_name, value ? 1 : 0);
-            } else {
-                int value;
-                if (thermia_modbus_read_register_int(reg_name, &value)) {
-                    if (reg->scale > 1)
-                        printf("%s = %.2f (read) (raw = %d)\n", reg_name, (double)value / reg->scale, value);
-                    else
-                        printf("%s = %d (read)\n", reg_name, value);
-                }
+static void *heartbeat_thread(void *arg) {
+    thermia_modbus_t *ctx = (thermia_modbus_t *)arg;
+    const register_def_t *reg = find_register(HEARTBEAT_REGISTER, REG_INPUT);
+    pthread_mutex_lock(&ctx->io_lock);
+    while (!ctx->heartbeat_stop) {
+        if (ctx->breaker_open) {
+            if (time_now_ms() >= ctx->breaker_probe_due_ms)
+                breaker_probe_swap(ctx, reg);
+            if (ctx->breaker_open && !ctx->heartbeat_stop) {
+                const uint64_t wake_ms = ctx->breaker_probe_due_ms;
+                const struct timespec until = {.tv_sec = (time_t)(wake_ms / 1000), .tv_nsec = (long)(wake_ms % 1000) * 1000000};
+                pthread_cond_timedwait(&ctx->heartbeat_changed, &ctx->io_lock, &until);
             }
+            continue;
         }
-    } else if (strcmp(operation, "write") == 0) {
-        if (argc < 6) {
-            fprintf(stderr, "register: missing value for write operation\n");
-            goto failure;
-        }
-        const char *reg_name = argv[4];
-        const register_def_t *reg = find_register(reg_name, REG_COIL_STATUS | REG_HOLDING);
-        if (reg == NULL) {
-            fprintf(stderr, "register: not found '%s'\n", reg_name);
-            goto failure;
+        if (ctx->heartbeat_idle_ms == 0) {
+            pthread_cond_wait(&ctx->heartbeat_changed, &ctx->io_lock);
+            continue;
         }
-        const int value = atoi(argv[5]);
-        if (reg->type == REG_COIL_STATUS) {
-            if (thermia_modbus_write_register_bit(reg_name, value != 0))
-                printf("%s = %d (write)\n", reg_name, value);
-        } else {
-            if (thermia_modbus_write_register_int(reg_name, value))
-                printf("%s = %d (write)\n", reg_name, value);
+        const uint64_t now_ms = time_now_ms(), due_ms = ctx->requested_ms + ctx->heartbeat_idle_ms;
+        if (connection_is_closed(ctx)) {
+            fprintf(stderr, "modbus: %s:%d closed the connection, reconnecting\n", ctx->address, ctx->port);
+            modbus_close(ctx->modbus);
+            if (!connection_connect(ctx))
+                fprintf(stderr, "modbus: reconnection failed: %s\n", modbus_strerror(errno));
+            ctx->requested_ms = now_ms; // retried at the next check otherwise
+        } else if (now_ms >= due_ms) {
+            int value;
+            if (read_block(ctx, reg->type, reg->address, 1, &value)) {
+                cache_update(ctx, (thermia_modbus_handle_t)(reg - g_registers), value, time_now_ms());
+                cache_publish(ctx);
+            }
+            ctx->requested_ms = time_now_ms();
         }
-    } else {
-        fprintf(stderr, "operation unknown: %s\n", operation);
-        goto failure;
+        uint64_t wake_ms = ctx->requested_ms + ctx->heartbeat_idle_ms;
+        if (wake_ms > time_now_ms() + HEARTBEAT_CHECK_MS)
+            wake_ms = time_now_ms() + HEARTBEAT_CHECK_MS;
+        const struct timespec until = {.tv_sec = (time_t)(wake_ms / 1000), .tv_nsec = (long)(wake_ms % 1000) * 1000000};
+        pthread_cond_timedwait(&ctx->heartbeat_changed, &ctx->io_lock, &until);
     }
+    pthread_mutex_unlock(&ctx->io_lock);
+    return NULL;
+}
 
-    thermia_modbus_close();
-    return EXIT_SUCCESS;
+// caller holds the I/O lock; signals the thread if already started
+static bool heartbeat_start(thermia_modbus_t *ctx) {
+    if (ctx->heartbeat_started) {
+        pthread_cond_signal(&ctx->heartbeat_changed);
+        return true;
+    }
+    const int error = pthread_create(&ctx->heartbeat_thread, NULL, heartbeat_thread, ctx);
+    if (error != 0) {
+        fprintf(stderr, "modbus: failed to start heartbeat thread: %s\n", strerror(error));
+        return false;
+    }
+    ctx->heartbeat_started = true;
+    return true;
+}
 
-failure:
-    thermia_modbus_close();
-    return EXIT_FAILURE;
+static void heartbeat_stop(thermia_modbus_t *ctx) {
+    pthread_mutex_lock(&ctx->io_lock);
+    const bool started = ctx->heartbeat_started;
+    ctx->heartbeat_stop = true;
+    pthread_cond_signal(&ctx->heartbeat_changed);
+    pthread_mutex_unlock(&ctx->io_lock);
+    if (started)
+        pthread_join(ctx->heartbeat_thread, NULL);
+}
+
+bool thermia_modbus_set_heartbeat(thermia_modbus_t *ctx, uint32_t idle_ms) {
+    MODBUS_CHECK(ctx);
+
+    pthread_mutex_lock(&ctx->io_lock);
+    ctx->heartbeat_idle_ms = idle_ms;
+    if (ctx->requested_ms == 0)
+        ctx->requested_ms = time_now_ms();
+    bool started = true;
+    if (idle_ms > 0)
+        started = heartbeat_start(ctx);
+    else if (ctx->heartbeat_started)
+        pthread_cond_signal(&ctx->heartbeat_changed); // stays for the breaker probes
+    pthread_mutex_unlock(&ctx->io_lock);
+    return started;
+}
+
+#define HANDLE_CHECK(handle, types)                                                                                                                            \
+    if (handle < 0 || handle >= g_num_registers || !(g_registers[handle].type & (types))) {                                                                   \
+        fprintf(stderr, "register: handle %d invalid for operation\n", handle);                                                                                \
+        return false;                                                                                                                                          \
+    }
+
+const char *thermia_modbus_handle_name(thermia_modbus_handle_t handle) { return handle >= 0 && handle < g_num_registers ? g_registers[handle].name : NULL; }
+
+bool thermia_modbus_resolve_register(thermia_modbus_t *ctx, const char *name, thermia_modbus_handle_t *handle) {
+    MODBUS_CHECK(ctx);
+
+    const register_def_t *reg = find_register(name, REG_COIL_STATUS | REG_INPUT_STATUS | REG_INPUT | REG_HOLDING);
+    REGISTER_CHECK(ctx, reg);
+
+    *handle = (thermia_modbus_handle_t)(reg - g_registers);
+    return true;
+}
+
+// single register request with its cache update, under the I/O lock; errno is preserved for the caller's message
+static bool transfer_handle(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, bool write, int *value) {
+    const register_def_t *reg = &g_registers[handle];
+    if (breaker_fails_fast(ctx))
+        return false;
+    pthread_mutex_lock(&ctx->io_lock);
+    bool transferred;
+    if (!write)
+        transferred = read_block(ctx, reg->type, reg->address, 1, value);
+    else {
+        uint8_t bit = *value ? 1 : 0;
+        uint16_t reg_value = (uint16_t)*value;
+        transferred = request(ctx, register_write_function(reg->type, 1), reg->address, 1, &bit, &reg_value);
+    }
+    const int error = errno;
+    if (transferred) {
+        cache_update(ctx, handle, reg->type == REG_COIL_STATUS ? *value != 0 : (int16_t)*value, time_now_ms());
+        cache_publish(ctx);
+    }
+    pthread_mutex_unlock(&ctx->io_lock);
+    errno = error;
+    return transferred;
+}
+
+bool thermia_modbus_read_handle_bit(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, bool *value) {
+    MODBUS_CHECK(ctx);
+    HANDLE_CHECK(handle, REG_COIL_STATUS | REG_INPUT_STATUS);
+
+    int reg_value;
+    if (!transfer_handle(ctx, handle, false, &reg_value)) {
+        fprintf(stderr, "register: failed to read bit: %s\n", modbus_strerror(errno));
+        return false;
+    }
+
+    *value = reg_value != 0;
+    return true;
+}
+
+bool thermia_modbus_read_handle_int(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, int *value) {
+    MODBUS_CHECK(ctx);
+    HANDLE_CHECK(handle, REG_INPUT | REG_HOLDING);
+
+    int reg_value;
+    if (!transfer_handle(ctx, handle, false, &reg_value)) {
+        fprintf(stderr, "register: failed to read int: %s\n", modbus_strerror(errno));
+        return false;
+    }
+
+    *value = reg_value;
+    return true;
+}
+
+bool thermia_modbus_write_handle_bit(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, bool value) {
+    MODBUS_CHECK(ctx);
+    HANDLE_CHECK(handle, REG_COIL_STATUS);
+
+    int reg_value = value ? 1 : 0;
+    if (!transfer_handle(ctx, handle, true, &reg_value)) {
+        fprintf(stderr, "register: failed to write bit: %s\n", modbus_strerror(errno));
+        return false;
+    }
+
+    return true;
+}
+
+bool thermia_modbus_write_handle_int(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, int value) {
+    MODBUS_CHECK(ctx);
+    HANDLE_CHECK(handle, REG_HOLDING);
+
+    if (!transfer_handle(ctx, handle, true, &value)) {
+        fprintf(stderr, "register: failed to write int: %s\n", modbus_strerror(errno));
+        return false;
+    }
+
+    return true;
+}
+
+bool thermia_modbus_read_register_bit(thermia_modbus_t *ctx, const char *name, bool *value) {
+    MODBUS_CHECK(ctx);
+
+    const register_def_t *reg = find_register(name, REG_COIL_STATUS | REG_INPUT_STATUS);
+    REGISTER_CHECK(ctx, reg);
+
+    return thermia_modbus_read_handle_bit(ctx, (thermia_modbus_handle_t)(reg - g_registers), value);
+}
+
+bool thermia_modbus_read_register_int(thermia_modbus_t *ctx, const char *name, int *value) {
+    MODBUS_CHECK(ctx);
+
+    const register_def_t *reg = find_register(name, REG_INPUT | REG_HOLDING);
+    REGISTER_CHECK(ctx, reg);
+
+    return thermia_modbus_read_handle_int(ctx, (thermia_modbus_handle_t)(reg - g_registers), value);
+}
+
+bool thermia_modbus_write_register_bit(thermia_modbus_t *ctx, const char *name, bool value) {
+    MODBUS_CHECK(ctx);
+
+    const register_def_t *reg = find_register(name, REG_COIL_STATUS);
+    REGISTER_CHECK(ctx, reg);
+
+    return thermia_modbus_write_handle_bit(ctx, (thermia_modbus_handle_t)(reg - g_registers), value);
+}
+
+bool thermia_modbus_write_register_int(thermia_modbus_t *ctx, const char *name, int value) {
+    MODBUS_CHECK(ctx);
+
+    const register_def_t *reg = find_register(name, REG_HOLDING);
+    REGISTER_CHECK(ctx, reg);
+
+    return thermia_modbus_write_handle_int(ctx, (thermia_modbus_handle_t)(reg - g_registers), value);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Block reads: the model tables are generated with the supported registers ordered by type and address and already
+ * merged into runs, which may span small gaps of unrequested addresses (cheaper than another round trip) but never
+ * exceed the Modbus PDU limits. Requested registers are ordered by position in that table and each run holding any of
+ * them is read as one block, trimmed to the requested span.
+ *
+ * The controller rejects a block holding an address its firmware does not implement, so the planner learns: a run
+ * failing with an illegal address exception is bisected, and when both halves read the gap between them holds the
+ * hole, so a cut is recorded there and later blocks never span it. A single register rejected on its own is a hole
+ * itself and is no longer requested. What was learned can be kept in a file, per model and firmware version.
+ *
+ * Cached variants first serve whatever the cache holds within the maximum age. If anything is left they take the I/O
+ * lock and check again before going to the wire: a request queued behind an in-flight fetch of the same (stale)
+ * registers is then served by that fetch instead of issuing its own.
+ */
+
+typedef struct {
+    const register_def_t *reg;
+    int position;
+    int *value;
+    bool *valid;
+} block_entry_t;
+
+static int block_entry_compare(const void *a, const void *b) { return ((const block_entry_t *)a)->position - ((const block_entry_t *)b)->position; }
+
+#define PLANNER_CUT 0x01  // no block spans this position and the next
+#define PLANNER_HOLE 0x02 // rejected on its own
+
+static void planner_learn(thermia_modbus_t *ctx, int position, uint8_t flags) {
+    if ((ctx->planner[position] & flags) != flags) {
+        ctx->planner[position] |= flags;
+        ctx->planner_dirty = true;
+    }
+}
+
+static bool planner_is_cut(const thermia_modbus_t *ctx, int position_from, int position_to) {
+    for (int position = position_from; position < position_to; position++)
+        if (ctx->planner[position] & PLANNER_CUT)
+            return true;
+    return false;
+}
+
+// returns true if the entries were read as one block
+static bool read_block_entries(thermia_modbus_t *ctx, const block_entry_t *entries, int count) {
+    const reg_type_t type = entries[0].reg->type;
+    const int address = entries[0].reg->address, length = entries[count - 1].reg->address - address + 1;
+    int values[MODBUS_MAX_READ_BITS];
+    if (read_block(ctx, type, address, length, values)) {
+        const uint64_t now_ms = time_now_ms();
+        for (int i = 0; i < count; i++) {
+            *entries[i].value = values[entries[i].reg->address - address];
+            *entries[i].valid = true;
+            cache_update(ctx, (thermia_modbus_handle_t)(entries[i].reg - g_registers), *entries[i].value, now_ms);
+        }
+        return true;
+    }
+    if (errno == EMBXILADD && count > 1) {
+        STATS_RETRY(ctx, register_read_function(type), count);
+        const int half = count / 2;
+        const bool left = read_block_entries(ctx, entries, half), right = read_block_entries(ctx, &entries[half], count - half);
+        if (left && right)
+            planner_learn(ctx, entries[half - 1].position, PLANNER_CUT);
+        return false;
+    }
+    if (errno == EMBXILADD) {
+        if (entries[0].position > 0)
+            planner_learn(ctx, entries[0].position - 1, PLANNER_CUT);
+        planner_learn(ctx, entries[0].position, PLANNER_CUT | PLANNER_HOLE);
+        fprintf(stderr, "register: '%s' not implemented by the controller, no longer read\n", entries[0].reg->name);
+        return false;
+    }
+    if (!ctx->breaker_open || errno != ENOTCONN) // failing fast was reported when the breaker opened
+        fprintf(stderr, "register: failed to read block (address %d, count %d): %s\n", address, length, modbus_strerror(errno));
+    return false;
+}
+
+// entries ordered by position, all in one run: read as one block unless the planner learned holes or cuts among them
+static void read_block_run(thermia_modbus_t *ctx, const block_entry_t *entries, int count) {
+    for (int start = 0, end; start < count; start = end) {
+        if (ctx->planner[entries[start].position] & PLANNER_HOLE) {
+            end = start + 1;
+            continue;
+        }
+        for (end = start + 1; end < count && !planner_is_cut(ctx, entries[end - 1].position, entries[end].position); end++)
+            ;
+        read_block_entries(ctx, &entries[start], end - start);
+    }
+}
+
+static void planner_save(thermia_modbus_t *ctx);
+
+// caller holds the I/O lock
+static void read_block_plan(thermia_modbus_t *ctx, block_entry_t *entries, int count) {
+    qsort(entries, (size_t)count, sizeof(block_entry_t), block_entry_compare);
+
+    const uint16_t *runs_of = ctx->table->runs_of;
+    for (int start = 0, end; start < count; start = end) {
+        for (end = start + 1; end < count && runs_of[entries[end].position] == runs_of[entries[start].position]; end++)
+            ;
+        read_block_run(ctx, &entries[start], end - start);
+    }
+    cache_publish(ctx);
+    if (ctx->planner_dirty)
+        planner_save(ctx);
+}
+
+// fills entries fresh enough in the cache, returns the count of the rest, which are compacted to the front
+static int read_block_cache_serve(thermia_modbus_t *ctx, block_entry_t *entries, int count, uint32_t max_age_ms) {
+    const uint64_t now_ms = time_now_ms();
+    int stale_count = 0;
+    pthread_mutex_lock(&ctx->cache_lock);
+    for (int i = 0; i < count; i++) {
+        const cache_entry_t *entry = &ctx->cache[entries[i].reg - g_registers];
+        if (entry->valid && now_ms - entry->updated_ms <= max_age_ms) {
+            *entries[i].value = entry->value;
+            *entries[i].valid = true;
+        } else
+            entries[stale_count++] = entries[i];
+    }
+    pthread_mutex_unlock(&ctx->cache_lock);
+    return stale_count;
+}
+
+static void read_block_entries_all(thermia_modbus_t *ctx, block_entry_t *entries, int count, bool cached, uint32_t max_age_ms) {
+    if (cached && (count = read_block_cache_serve(ctx, entries, count, max_age_ms)) == 0)
+        return;
+    if (breaker_fails_fast(ctx)) {
+        if (cached)
+            read_block_cache_serve(ctx, entries, count, UINT32_MAX); // last known values, at any age, while unavailable
+        return;
+    }
+    pthread_mutex_lock(&ctx->io_lock);
+    if (cached)
+        count = read_block_cache_serve(ctx, entries, count, max_age_ms);
+    if (count > 0)
+        read_block_plan(ctx, entries, count);
+    if (cached && ctx->breaker_open)
+        read_block_cache_serve(ctx, entries, count, UINT32_MAX); // last known values, at any age, while unavailable
+    pthread_mutex_unlock(&ctx->io_lock);
+}
+
+static block_entry_t *block_entries_alloc(int count) {
+    block_entry_t *entries = malloc(sizeof(block_entry_t) * (size_t)(count > 0 ? count : 1));
+    if (entries == NULL)
+        fprintf(stderr, "register: failed to allocate block entries\n");
+    return entries;
+}
+
+static bool read_handles(thermia_modbus_t *ctx, const thermia_modbus_handle_t *handles, int count, int *values, bool *valid, bool cached, uint32_t max_age_ms) {
+    MODBUS_CHECK(ctx);
+
+    block_entry_t *entries = block_entries_alloc(count);
+    if (entries == NULL)
+        return false;
+    int entries_count = 0;
+    for (int i = 0; i < count; i++) {
+        valid[i] = false;
+        if (handles[i] < 0 || handles[i] >= g_num_registers || ctx->table->positions[handles[i]] < 0)
+            fprintf(stderr, "register: handle %d invalid for operation\n", handles[i]);
+        else
+            entries[entries_count++] =
+                (block_entry_t){.reg = &g_registers[handles[i]], .position = ctx->table->positions[handles[i]], .value = &values[i], .valid = &valid[i]};
+    }
+    read_block_entries_all(ctx, entries, entries_count, cached, max_age_ms);
+    free(entries);
+
+    for (int i = 0; i < count; i++)
+        if (!valid[i])
+            return false;
+    return true;
+}
+
+static bool read_registers(thermia_modbus_t *ctx, thermia_modbus_read_t *reads, int count, bool cached, uint32_t max_age_ms) {
+    MODBUS_CHECK(ctx);
+
+    block_entry_t *entries = block_entries_alloc(count);
+    if (entries == NULL)
+        return false;
+    int entries_count = 0;
+    for (int i = 0; i < count; i++) {
+        const char *name = reads[i].name;
+        const register_def_t *reg = find_register(name, REG_COIL_STATUS | REG_INPUT_STATUS | REG_INPUT | REG_HOLDING);
+        reads[i].valid = false;
+        if (reg == NULL)
+            fprintf(stderr, "register: '%s' not found\n", name);
+        else if (!is_register_supported(ctx, reg))
+            fprintf(stderr, "register: '%s' not supported by model\n", name);
+        else
+            entries[entries_count++] =
+                (block_entry_t){.reg = reg, .position = ctx->table->positions[reg - g_registers], .value = &reads[i].value, .valid = &reads[i].valid};
+    }
+    read_block_entries_all(ctx, entries, entries_count, cached, max_age_ms);
+    free(entries);
+
+    for (int i = 0; i < count; i++)
+        if (!reads[i].valid)
+            return false;
+    return true;
+}
+
+bool thermia_modbus_read_handles(thermia_modbus_t *ctx, const thermia_modbus_handle_t *handles, int count, int *values, bool *valid) {
+    return read_handles(ctx, handles, count, values, valid, false, 0);
+}
+
+bool thermia_modbus_read_handles_cached(thermia_modbus_t *ctx, const thermia_modbus_handle_t *handles, int count, uint32_t max_age_ms, int *values, bool *valid) {
+    return read_handles(ctx, handles, count, values, valid, true, max_age_ms);
+}
+
+bool thermia_modbus_read_registers(thermia_modbus_t *ctx, thermia_modbus_read_t *reads, int count) { return read_registers(ctx, reads, count, false, 0); }
+
+int thermia_modbus_register_count(void) { return g_num_registers; }
+
+bool thermia_modbus_read_all(thermia_modbus_t *ctx, int *values, bool *valid) {
+    MODBUS_CHECK(ctx);
+
+    const register_model_table_t *table = ctx->table;
+    block_entry_t *entries = block_entries_alloc(table->count);
+    if (entries == NULL)
+        return false;
+    for (int i = 0; i < g_num_registers; i++)
+        valid[i] = false;
+    for (int position = 0; position < table->count; position++) {
+        const int handle = table->order[position];
+        entries[position] = (block_entry_t){.reg = &g_registers[handle], .position = position, .value = &values[handle], .valid = &valid[handle]};
+    }
+    read_block_entries_all(ctx, entries, table->count, false, 0);
+    bool complete = true;
+    for (int i = 0; i < table->count; i++)
+        complete &= *entries[i].valid;
+    free(entries);
+    return complete;
+}
+
+bool thermia_modbus_read_registers_cached(thermia_modbus_t *ctx, thermia_modbus_read_t *reads, int count, uint32_t max_age_ms) {
+    return read_registers(ctx, reads, count, true, max_age_ms);
+}
+
+/*
+ * Groups: registers by system and subsystem (Heatpump/Unit, Heating/MixValve2, ...), generated per model with the
+ * positions of their supported registers and their block reads, each model run holding any of them trimmed to their
+ * span. A pattern names a group, either part may be "*" to match any and a bare system ("Tapwater") matches all of its
+ * subsystems. A single group is read by its own plan, several are planned together as their registers may share runs.
+ */
+
+static bool group_part_matches(const char *part, size_t length, const char *name) {
+    return (length == 1 && part[0] == '*') || (strlen(name) == length && strncmp(part, name, length) == 0);
+}
+
+static bool group_matches(const register_group_t *group, const char *pattern) {
+    const char *slash = strchr(pattern, '/');
+    return group_part_matches(pattern, slash != NULL ? (size_t)(slash - pattern) : strlen(pattern), group->system) &&
+           (slash == NULL || group_part_matches(slash + 1, strlen(slash + 1), group->subsystem));
+}
+
+// returns the count of supported registers in the matching groups (filling up to max handles) and the group if only one
+// matches, else -1
+static int group_resolve(const thermia_modbus_t *ctx, const char *pattern, thermia_modbus_handle_t *handles, int max, int *single) {
+    const register_model_table_t *table = ctx->table;
+    int count = 0, matched = 0;
+    for (int group = 0; group < REGISTERS_GROUPS; group++)
+        if (group_matches(&g_registers_groups[group], pattern)) {
+            const register_group_plan_t *plan = &table->groups[group];
+            for (int i = 0; i < plan->count; i++, count++)
+                if (count < max)
+                    handles[count] = (thermia_modbus_handle_t)table->order[table->group_positions[plan->first + i]];
+            *single = matched++ == 0 ? group : -1;
+        }
+    if (matched == 0) {
+        fprintf(stderr, "group: '%s' matches no group\n", pattern);
+        return -1;
+    }
+    return count;
+}
+
+int thermia_modbus_resolve_group(thermia_modbus_t *ctx, const char *pattern, thermia_modbus_handle_t *handles, int max) {
+    int single;
+    return group_resolve(ctx, pattern, handles, max, &single);
+}
+
+int thermia_modbus_read_group(thermia_modbus_t *ctx, const char *pattern, thermia_modbus_handle_t *handles, int *values, bool *valid, int max) {
+    if (ctx == NULL || ctx->modbus == NULL) {
+        fprintf(stderr, "modbus: not initialised/connected\n");
+        return -1;
+    }
+    int group;
+    const int count = group_resolve(ctx, pattern, handles, max, &group);
+    if (count < 0)
+        return -1;
+    if (count > max) {
+        fprintf(stderr, "group: '%s' holds %d registers, more than %d\n", pattern, count, max);
+        return -1;
+    }
+    block_entry_t *entries = block_entries_alloc(count);
+    if (entries == NULL)
+        return -1;
+    for (int i = 0; i < count; i++) {
+        valid[i] = false;
+        entries[i] = (block_entry_t){.reg = &g_registers[handles[i]], .position = ctx->table->positions[handles[i]], .value = &values[i], .valid = &valid[i]};
+    }
+    if (breaker_fails_fast(ctx)) { // all invalid, as a failed read leaves them
+        free(entries);
+        return count;
+    }
+    pthread_mutex_lock(&ctx->io_lock);
+    if (group >= 0) {
+        const register_group_plan_t *plan = &ctx->table->groups[group];
+        for (int run = plan->runs_first; run < plan->runs_first + plan->runs_count; run++)
+            read_block_run(ctx, &entries[ctx->table->group_runs[run].first - plan->first], ctx->table->group_runs[run].count);
+        cache_publish(ctx);
+        if (ctx->planner_dirty)
+            planner_save(ctx);
+    } else
+        read_block_plan(ctx, entries, count);
+    pthread_mutex_unlock(&ctx->io_lock);
+    free(entries);
+    return count;
+}
+
+/*
+ * Planner file: one line per learned cut or hole, "<model> <firmware> <cut|hole> <read function> <address>", e.g.
+ * "mega 9.2.1 cut 0x04 57" (no block spans input register 57 and the next one read). Lines for other models and
+ * firmware versions are kept as they are, so one file can serve a fleet.
+ */
+
+#define PLANNER_LINE_MAX 128
+
+static int planner_position_of(const thermia_modbus_t *ctx, unsigned function, int address) {
+    for (int position = 0; position < ctx->table->count; position++) {
+        const register_def_t *reg = &g_registers[ctx->table->order[position]];
+        if (register_read_function(reg->type) == function && reg->address == address)
+            return position;
+    }
+    return -1;
+}
+
+static bool planner_is_line_of(const thermia_modbus_t *ctx, const char *line) {
+    const size_t key_length = strlen(ctx->planner_key);
+    return strncmp(line, ctx->planner_key, key_length) == 0 && line[key_length] == ' ';
+}
+
+// caller holds the I/O lock
+static void planner_load(thermia_modbus_t *ctx) {
+    FILE *file = fopen(ctx->planner_path, "r");
+    if (file == NULL) {
+        if (errno != ENOENT)
+            fprintf(stderr, "planner: failed to open '%s': %s\n", ctx->planner_path, strerror(errno));
+        return;
+    }
+    char line[PLANNER_LINE_MAX], kind[8];
+    unsigned function;
+    int address, position;
+    while (fgets(line, sizeof(line), file) != NULL)
+        if (planner_is_line_of(ctx, line) && sscanf(line + strlen(ctx->planner_key), " %7s %x %d", kind, &function, &address) == 3 &&
+            (position = planner_position_of(ctx, function, address)) != -1)
+            ctx->planner[position] |= strcmp(kind, "hole") == 0 ? PLANNER_CUT | PLANNER_HOLE : PLANNER_CUT;
+    fclose(file);
+}
+
+// caller holds the I/O lock; rewritten whole through a temporary file, so a reader never sees it half written
+static void planner_save(thermia_modbus_t *ctx) {
+    if (ctx->planner_path[0] == '\0')
+        return; // kept in memory until a file is set
+    char path[sizeof(ctx->planner_path) + 8], line[PLANNER_LINE_MAX];
+    snprintf(path, sizeof(path), "%s.tmp", ctx->planner_path);
+    FILE *file = fopen(path, "w");
+    if (file == NULL) {
+        fprintf(stderr, "planner: failed to save '%s': %s\n", path, strerror(errno));
+        return;
+    }
+    FILE *previous = fopen(ctx->planner_path, "r");
+    if (previous != NULL) {
+        while (fgets(line, sizeof(line), previous) != NULL)
+            if (!planner_is_line_of(ctx, line))
+                fputs(line, file);
+        fclose(previous);
+    }
+    for (int position = 0; position < ctx->table->count; position++)
+        if (ctx->planner[position] & PLANNER_CUT) {
+            const register_def_t *reg = &g_registers[ctx->table->order[position]];
+            fprintf(file, "%s %s 0x%02x %d\n", ctx->planner_key, ctx->planner[position] & PLANNER_HOLE ? "hole" : "cut", register_read_function(reg->type),
+                    reg->address);
+        }
+    if (fclose(file) != 0 || rename(path, ctx->planner_path) != 0) {
+        fprintf(stderr, "planner: failed to save '%s': %s\n", ctx->planner_path, strerror(errno));
+        unlink(path);
+        return;
+    }
+    ctx->planner_dirty = false;
+}
+
+bool thermia_modbus_set_planner_file(thermia_modbus_t *ctx, const char *path) {
+    MODBUS_CHECK(ctx);
+
+    static const char *const names[3] = {"valueHeatpumpSoftwareVersionMajor", "valueHeatpumpSoftwareVersionMinor", "valueHeatpumpSoftwareVersionMicro"};
+    thermia_modbus_handle_t handles[3];
+    int version[3];
+    bool valid[3];
+    for (int i = 0; i < 3; i++) {
+        const char *name = names[i];
+        const register_def_t *reg = find_register(name, REG_INPUT);
+        REGISTER_CHECK(ctx, reg);
+        handles[i] = (thermia_modbus_handle_t)(reg - g_registers);
+    }
+    if (!thermia_modbus_read_handles(ctx, handles, 3, version, valid)) {
+        fprintf(stderr, "planner: failed to read firmware version\n");
+        return false;
+    }
+
+    pthread_mutex_lock(&ctx->io_lock);
+    snprintf(ctx->planner_path, sizeof(ctx->planner_path), "%s", path);
+    snprintf(ctx->planner_key, sizeof(ctx->planner_key), "%s %d.%d.%d", ctx->model == MODEL_MEGA ? "mega" : "inverter", version[0], version[1], version[2]);
+    planner_load(ctx); // merged with anything learned before
+    if (ctx->planner_dirty)
+        planner_save(ctx);
+    pthread_mutex_unlock(&ctx->io_lock);
+    return true;
+}
+
+bool thermia_modbus_read_handle_value(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, double *value) {
+    MODBUS_CHECK(ctx);
+    HANDLE_CHECK(handle, REG_COIL_STATUS | REG_INPUT_STATUS | REG_INPUT | REG_HOLDING);
+
+    const uint16_t *pair = register_value_pair_of(handle);
+    const thermia_modbus_handle_t handles[2] = {pair != NULL ? pair[0] : handle, pair != NULL ? pair[1] : handle};
+    int values[2];
+    bool valid[2];
+    if (!thermia_modbus_read_handles(ctx, handles, pair != NULL ? 2 : 1, values, valid))
+        return false;
+
+    *value = pair != NULL ? register_value_pair(pair, values[0], values[1]) : register_value(handle, values[0]);
+    return true;
+}
+
+bool thermia_modbus_read_value(thermia_modbus_t *ctx, const char *name, double *value) {
+    thermia_modbus_handle_t handle;
+    return thermia_modbus_resolve_register(ctx, name, &handle) && thermia_modbus_read_handle_value(ctx, handle, value);
+}
+
+// one pass over every handle without branching on the kind (so it vectorises), then the invalid and pairs fixed up
+void thermia_modbus_scale_values(const int *values, const bool *valid, double *scaled) {
+    for (int i = 0; i < REGISTERS_HASH_SLOTS; i++)
+        scaled[i] = (double)(values[i] & (g_registers_kinds[i] <= VALUE_S16 ? -1 : 0xffff)) * g_registers_multipliers[i];
+    for (int i = 0; i < REGISTERS_HASH_SLOTS; i++)
+        scaled[i] = valid[i] ? scaled[i] : NAN;
+    for (int i = 0; i < REGISTERS_VALUE_PAIRS; i++) {
+        const uint16_t *pair = g_registers_value_pairs[i];
+        scaled[pair[0]] = scaled[pair[1]] =
+            valid[pair[0]] && valid[pair[1]] ? register_value_pair(pair, values[pair[0]], values[pair[1]]) : NAN;
+    }
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Batch writes: requested writes are ordered by type and address and cut into runs of exactly consecutive addresses
+ * (a write cannot skip a gap), each sent as one write multiple coils / registers request (0x0F / 0x10), or as a single
+ * write when alone. A run the controller rejects is retried register by register so one bad address or value does not
+ * fail its neighbours. The batch holds the I/O lock throughout, so no other request on the context interleaves with
+ * it, and the optional verification reads back what was written with the block read planner.
+ */
+
+typedef struct {
+    const register_def_t *reg;
+    int position;
+    int value;
+    bool *written, *verified; // verified is NULL unless verifying
+} write_entry_t;
+
+static int write_entry_compare(const void *a, const void *b) { return ((const write_entry_t *)a)->position - ((const write_entry_t *)b)->position; }
+
+static void write_block_entries(thermia_modbus_t *ctx, const write_entry_t *entries, int count) {
+    const reg_type_t type = entries[0].reg->type;
+    const int address = entries[0].reg->address;
+    uint8_t bits[MODBUS_MAX_WRITE_BITS];
+    uint16_t registers[MODBUS_MAX_WRITE_REGISTERS];
+    for (int i = 0; i < count; i++) {
+        bits[i] = entries[i].value ? 1 : 0;
+        registers[i] = (uint16_t)entries[i].value;
+    }
+    if (request(ctx, register_write_function(type, count), address, count, bits, registers)) {
+        const uint64_t now_ms = time_now_ms();
+        for (int i = 0; i < count; i++) {
+            *entries[i].written = true;
+            cache_update(ctx, (thermia_modbus_handle_t)(entries[i].reg - g_registers), type == REG_COIL_STATUS ? entries[i].value != 0 : (int16_t)entries[i].value,
+                         now_ms);
+        }
+        return;
+    }
+    if ((errno == EMBXILADD || errno == EMBXILVAL) && count > 1) {
+        STATS_RETRY(ctx, register_write_function(type, count), count);
+        for (int i = 0; i < count; i++)
+            write_block_entries(ctx, &entries[i], 1);
+        return;
+    }
+    if (ctx->breaker_open && errno == ENOTCONN)
+        return; // failing fast was reported when the breaker opened
+    if (count == 1)
+        fprintf(stderr, "register: failed to write '%s': %s\n", entries[0].reg->name, modbus_strerror(errno));
+    else
+        fprintf(stderr, "register: failed to write block (address %d, count %d): %s\n", address, count, modbus_strerror(errno));
+}
+
+// caller holds the I/O lock
+static void write_block_plan(thermia_modbus_t *ctx, write_entry_t *entries, int count) {
+    qsort(entries, (size_t)count, sizeof(write_entry_t), write_entry_compare);
+
+    for (int start = 0, end; start < count; start = end) {
+        const reg_type_t type = entries[start].reg->type;
+        const int limit = type == REG_COIL_STATUS ? MODBUS_MAX_WRITE_BITS : MODBUS_MAX_WRITE_REGISTERS;
+        for (end = start + 1; end < count && end - start < limit; end++)
+            if (entries[end].reg->type != type || entries[end].reg->address != entries[end - 1].reg->address + 1)
+                break;
+        write_block_entries(ctx, &entries[start], end - start);
+    }
+    cache_publish(ctx);
+}
+
+// read back what was written, an entry is verified if it reads back unchanged
+static void write_block_verify(thermia_modbus_t *ctx, const write_entry_t *entries, int count) {
+    block_entry_t *reads = block_entries_alloc(count);
+    int *values = malloc(sizeof(int) * (size_t)(count > 0 ? count : 1));
+    if (reads == NULL || values == NULL) {
+        free(reads);
+        free(values);
+        return;
+    }
+    int reads_count = 0;
+    for (int i = 0; i < count; i++)
+        if (*entries[i].written)
+            reads[reads_count++] = (block_entry_t){.reg = entries[i].reg, .position = entries[i].position, .value = &values[i], .valid = entries[i].verified};
+    read_block_plan(ctx, reads, reads_count);
+    for (int i = 0; i < count; i++) {
+        const write_entry_t *entry = &entries[i];
+        if (*entry->verified && values[i] != (entry->reg->type == REG_COIL_STATUS ? entry->value != 0 : (int16_t)entry->value)) {
+            fprintf(stderr, "register: '%s' read back %d after writing %d\n", entry->reg->name, values[i], entry->value);
+            *entry->verified = false;
+        }
+    }
+    free(reads);
+    free(values);
+}
+
+static bool write_entries_all(thermia_modbus_t *ctx, write_entry_t *entries, int count) {
+    for (int i = 1; i < count; i++)
+        for (int j = 0; j < i; j++)
+            if (entries[i].reg == entries[j].reg) {
+                fprintf(stderr, "register: '%s' written twice in one batch\n", entries[i].reg->name);
+                return false;
+            }
+    if (breaker_fails_fast(ctx))
+        return false; // failing fast was reported when the breaker opened
+    pthread_mutex_lock(&ctx->io_lock);
+    write_block_plan(ctx, entries, count);
+    if (count > 0 && entries[0].verified != NULL)
+        write_block_verify(ctx, entries, count);
+    pthread_mutex_unlock(&ctx->io_lock);
+
+    for (int i = 0; i < count; i++)
+        if (!*entries[i].written || (entries[i].verified != NULL && !*entries[i].verified))
+            return false;
+    return true;
+}
+
+static write_entry_t *write_entries_alloc(int count) {
+    write_entry_t *entries = malloc(sizeof(write_entry_t) * (size_t)(count > 0 ? count : 1));
+    if (entries == NULL)
+        fprintf(stderr, "register: failed to allocate write entries\n");
+    return entries;
+}
+
+bool thermia_modbus_write_handles(thermia_modbus_t *ctx, const thermia_modbus_handle_t *handles, const int *values, int count, bool *written, bool *verified) {
+    MODBUS_CHECK(ctx);
+
+    write_entry_t *entries = write_entries_alloc(count);
+    if (entries == NULL)
+        return false;
+    bool accepted = true;
+    for (int i = 0; i < count; i++) {
+        written[i] = false;
+        if (verified != NULL)
+            verified[i] = false;
+        if (handles[i] < 0 || handles[i] >= g_num_registers || !(g_registers[handles[i]].type & (REG_COIL_STATUS | REG_HOLDING)) ||
+            ctx->table->positions[handles[i]] < 0) {
+            fprintf(stderr, "register: handle %d invalid for operation\n", handles[i]);
+            accepted = false;
+        } else
+            entries[i] = (write_entry_t){.reg = &g_registers[handles[i]],
+                                         .position = ctx->table->positions[handles[i]],
+                                         .value = values[i],
+                                         .written = &written[i],
+                                         .verified = verified != NULL ? &verified[i] : NULL};
+    }
+    accepted = accepted && write_entries_all(ctx, entries, count);
+    free(entries);
+    return accepted;
+}
+
+bool thermia_modbus_write_registers(thermia_modbus_t *ctx, thermia_modbus_write_t *writes, int count, bool verify) {
+    MODBUS_CHECK(ctx);
+
+    write_entry_t *entries = write_entries_alloc(count);
+    if (entries == NULL)
+        return false;
+    bool accepted = true;
+    for (int i = 0; i < count; i++) {
+        const char *name = writes[i].name;
+        const register_def_t *reg = find_register(name, REG_COIL_STATUS | REG_HOLDING);
+        writes[i].written = writes[i].verified = false;
+        if (reg == NULL) {
+            fprintf(stderr, "register: '%s' not found\n", name);
+            accepted = false;
+        } else if (!is_register_supported(ctx, reg)) {
+            fprintf(stderr, "register: '%s' not supported by model\n", name);
+            accepted = false;
+        } else
+            entries[i] = (write_entry_t){.reg = reg,
+                                         .position = ctx->table->positions[reg - g_registers],
+                                         .value = writes[i].value,
+                                         .written = &writes[i].written,
+                                         .verified = verify ? &writes[i].verified : NULL};
+    }
+    accepted = accepted && write_entries_all(ctx, entries, count);
+    free(entries);
+    return accepted;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Async: an epoll event loop over non-blocking Modbus TCP connections of its own, one per attached context. Up to
+ * ASYNC_PIPELINE_DEPTH transactions are in flight on each connection and matched back by MBAP transaction id, so round
+ * trips to one controller overlap, as do those to different controllers, instead of adding up. Requests are cut into
+ * the same runs as blocking block reads, around the holes the planner has learned, and a run rejected with an illegal
+ * address exception is bisected, teaching the planner as blocking reads do; results land in the context cache as well
+ * as in the callback. The loop belongs to the caller: wait on the fd (or let
+ * dispatch wait) and call dispatch, which does all ready I/O, expires late transactions and runs their callbacks. A
+ * connection that fails, or has a transaction time out, takes its transactions with it and is reopened by the next
+ * request.
+ */
+
+#define ASYNC_CONNECTIONS_MAX 64
+#define ASYNC_PIPELINE_DEPTH 8
+#define ASYNC_TIMEOUT_MS 1000
+#define ASYNC_REQUEST_LENGTH 12 // MBAP header (7) + function, address, quantity
+#define ASYNC_FRAME_MAX 260     // MBAP header (7) + PDU (253)
+#define ASYNC_UNIT_ID 1         // as set on the blocking connection
+
+// the halves of a run bisected on an illegal address exception: when both read, the hole lies between them
+typedef struct {
+    int position; // last position of the first half
+    int outstanding;
+    bool failed;
+} async_split_t;
+
+typedef struct async_transaction {
+    struct async_transaction *next;
+    async_split_t *split; // the bisection this transaction is a half of, if any
+    uint16_t id;
+    reg_type_t type;
+    int address, length;
+    uint64_t deadline_ms;
+    uint64_t sent_us;
+    thermia_async_callback_t callback;
+    void *callback_arg;
+    int handles_count;
+    thermia_modbus_handle_t handles[];
+} async_transaction_t;
+
+typedef struct {
+    thermia_modbus_t *ctx;
+    int fd;
+    uint32_t events;
+    bool connecting;
+    uint64_t connect_deadline_ms;
+    uint16_t next_id;
+    async_transaction_t *queued, *inflight;
+    int inflight_count;
+    uint8_t tx[ASYNC_PIPELINE_DEPTH * ASYNC_REQUEST_LENGTH];
+    size_t tx_length;
+    uint8_t rx[ASYNC_FRAME_MAX * 2];
+    size_t rx_length;
+} async_connection_t;
+
+struct thermia_async {
+    int epoll_fd;
+    async_connection_t *connections[ASYNC_CONNECTIONS_MAX];
+    int connections_count;
+    int pending, completed;
+};
+
+static async_transaction_t *async_transaction_new(reg_type_t type, int address, int length, int handles_count, thermia_async_callback_t callback,
+                                                  void *callback_arg) {
+    async_transaction_t *transaction = malloc(sizeof(async_transaction_t) + sizeof(thermia_modbus_handle_t) * (size_t)handles_count);
+    if (transaction == NULL) {
+        fprintf(stderr, "async: failed to allocate transaction\n");
+        return NULL;
+    }
+    *transaction = (async_transaction_t){
+        .type = type, .address = address, .length = length, .callback = callback, .callback_arg = callback_arg, .handles_count = handles_count};
+    return transaction;
+}
+
+// caller holds the I/O lock
+static void async_planner_learn(thermia_modbus_t *ctx, int position, uint8_t flags) {
+    planner_learn(ctx, position, flags);
+    if (ctx->planner_dirty)
+        planner_save(ctx);
+}
+
+// values are by address offset from the start of the transaction, or NULL if it failed
+static void async_complete(thermia_async_t *async, async_connection_t *connection, async_transaction_t *transaction, const int *values) {
+    thermia_modbus_t *ctx = connection->ctx;
+    if (values != NULL) {
+        const uint64_t now_ms = time_now_ms();
+        pthread_mutex_lock(&ctx->io_lock); // publish between, never inside, blocking read calls
+        for (int i = 0; i < transaction->handles_count; i++)
+            cache_update(ctx, transaction->handles[i], values[g_registers[transaction->handles[i]].address - transaction->address], now_ms);
+        cache_publish(ctx);
+        pthread_mutex_unlock(&ctx->io_lock);
+    }
+    async_split_t *split = transaction->split;
+    if (split != NULL) {
+        split->failed |= values == NULL;
+        if (--split->outstanding == 0) {
+            if (!split->failed) {
+                pthread_mutex_lock(&ctx->io_lock);
+                async_planner_learn(ctx, split->position, PLANNER_CUT);
+                pthread_mutex_unlock(&ctx->io_lock);
+            }
+            free(split);
+        }
+    }
+    if (transaction->callback != NULL)
+        for (int i = 0; i < transaction->handles_count; i++)
+            transaction->callback(transaction->callback_arg, transaction->handles[i],
+                                  values != NULL ? values[g_registers[transaction->handles[i]].address - transaction->address] : 0, values != NULL);
+    free(transaction);
+    async->pending--;
+    async->completed++;
+}
+
+// fails every transaction on the connection and closes it, reporting the reason (if any)
+static void async_connection_fail(thermia_async_t *async, async_connection_t *connection, const char *reason) {
+    if (connection->fd != -1) {
+        if (reason != NULL)
+            fprintf(stderr, "async: connection to %s:%d failed: %s\n", connection->ctx->address, connection->ctx->port, reason);
+        close(connection->fd);
+        connection->fd = -1;
+    }
+    connection->connecting = false;
+    connection->inflight_count = 0;
+    connection->tx_length = connection->rx_length = 0;
+    while (connection->inflight != NULL || connection->queued != NULL) {
+        async_transaction_t **list = connection->inflight != NULL ? &connection->inflight : &connection->queued, *transaction = *list;
+        *list = transaction->next;
+        async_complete(async, connection, transaction, NULL);
+    }
+}
+
+static bool async_connection_open(thermia_async_t *async, async_connection_t *connection) {
+    const thermia_modbus_t *ctx = connection->ctx;
+    char port[16];
+    snprintf(port, sizeof(port), "%d", ctx->port);
+    struct addrinfo hints = {.ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM}, *info;
+    const int rc = getaddrinfo(ctx->address, port, &hints, &info);
+    if (rc != 0) {
+        fprintf(stderr, "async: failed to resolve '%s': %s\n", ctx->address, gai_strerror(rc));
+        return false;
+    }
+    const int fd = socket(info->ai_family, info->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, info->ai_protocol), nodelay = 1;
+    struct epoll_event event = {.events = EPOLLIN | EPOLLOUT, .data.ptr = connection};
+    if (fd == -1 || setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay)) == -1 ||
+        (connect(fd, info->ai_addr, info->ai_addrlen) == -1 && errno != EINPROGRESS) || epoll_ctl(async->epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1) {
+        fprintf(stderr, "async: connection to %s:%d failed: %s\n", ctx->address, ctx->port, strerror(errno));
+        if (fd != -1)
+            close(fd);
+        freeaddrinfo(info);
+        return false;
+    }
+    freeaddrinfo(info);
+    connection->fd = fd;
+    connection->events = event.events;
+    connection->connecting = true;
+    connection->connect_deadline_ms = time_now_ms() + ASYNC_TIMEOUT_MS;
+    return true;
+}
+
+// moves queued transactions in flight (up to the pipeline depth) and sends what the socket takes
+static bool async_connection_service(thermia_async_t *async, async_connection_t *connection) {
+    if (connection->fd == -1)
+        return true;
+    if (!connection->connecting) {
+        async_transaction_t **inflight_tail = &connection->inflight;
+        while (*inflight_tail != NULL)
+            inflight_tail = &(*inflight_tail)->next;
+        while (connection->queued != NULL && connection->inflight_count < ASYNC_PIPELINE_DEPTH &&
+               connection->tx_length + ASYNC_REQUEST_LENGTH <= sizeof(connection->tx)) {
+            async_transaction_t *transaction = connection->queued;
+            connection->queued = transaction->next;
+            transaction->next = NULL;
+            transaction->id = connection->next_id++;
+            transaction->deadline_ms = time_now_ms() + ASYNC_TIMEOUT_MS;
+            transaction->sent_us = time_now_us();
+            uint8_t *request = connection->tx + connection->tx_length;
+            const uint8_t header[ASYNC_REQUEST_LENGTH] = {
+                (uint8_t)(transaction->id >> 8), (uint8_t)transaction->id, 0, 0, 0, 6, ASYNC_UNIT_ID, register_read_function(transaction->type),
+                (uint8_t)(transaction->address >> 8), (uint8_t)transaction->address, (uint8_t)(transaction->length >> 8), (uint8_t)transaction->length};
+            memcpy(request, header, ASYNC_REQUEST_LENGTH);
+            connection->tx_length += ASYNC_REQUEST_LENGTH;
+            *inflight_tail = transaction;
+            inflight_tail = &transaction->next;
+            connection->inflight_count++;
+        }
+        size_t sent_length = 0;
+        while (sent_length < connection->tx_length) {
+            const ssize_t sent = send(connection->fd, connection->tx + sent_length, connection->tx_length - sent_length, MSG_NOSIGNAL);
+            if (sent == -1) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    break;
+                async_connection_fail(async, connection, strerror(errno));
+                return false;
+            }
+            sent_length += (size_t)sent;
+        }
+        connection->tx_length -= sent_length;
+        memmove(connection->tx, connection->tx + sent_length, connection->tx_length);
+    }
+    const uint32_t events = EPOLLIN | (connection->connecting || connection->tx_length > 0 ? EPOLLOUT : 0);
+    if (events != connection->events) {
+        struct epoll_event event = {.events = events, .data.ptr = connection};
+        epoll_ctl(async->epoll_fd, EPOLL_CTL_MOD, connection->fd, &event);
+        connection->events = events;
+    }
+    return true;
+}
+
+static async_transaction_t *async_transaction_part(const async_transaction_t *transaction, int first, int count, async_split_t *split) {
+    const register_def_t *head = &g_registers[transaction->handles[first]], *tail = &g_registers[transaction->handles[first + count - 1]];
+    async_transaction_t *part =
+        async_transaction_new(head->type, head->address, tail->address - head->address + 1, count, transaction->callback, transaction->callback_arg);
+    if (part != NULL) {
+        memcpy(part->handles, transaction->handles + first, sizeof(thermia_modbus_handle_t) * (size_t)count);
+        part->split = split;
+    }
+    return part;
+}
+
+/*
+ * An illegal address exception on a run means it holds an address the controller does not implement: as for blocking
+ * reads the run is bisected, a cut is learned between halves that both read and a single register rejected on its own
+ * is a hole, so later polls (blocking or async) plan around it without rediscovery.
+ */
+static void async_transaction_split(thermia_async_t *async, async_connection_t *connection, async_transaction_t *transaction) {
+    thermia_modbus_t *ctx = connection->ctx;
+    const register_model_table_t *table = ctx->table;
+    if (transaction->handles_count == 1) {
+        const int position = table->positions[transaction->handles[0]];
+        pthread_mutex_lock(&ctx->io_lock);
+        if (position > 0)
+            planner_learn(ctx, position - 1, PLANNER_CUT);
+        async_planner_learn(ctx, position, PLANNER_CUT | PLANNER_HOLE);
+        pthread_mutex_unlock(&ctx->io_lock);
+        fprintf(stderr, "register: '%s' not implemented by the controller, no longer read\n", g_registers[transaction->handles[0]].name);
+        async_complete(async, connection, transaction, NULL);
+        return;
+    }
+    STATS_RETRY(ctx, register_read_function(transaction->type), transaction->handles_count);
+    const int half = transaction->handles_count / 2;
+    async_split_t *split = malloc(sizeof(async_split_t));
+    async_transaction_t *left = NULL, *right = NULL;
+    if (split == NULL || (left = async_transaction_part(transaction, 0, half, split)) == NULL ||
+        (right = async_transaction_part(transaction, half, transaction->handles_count - half, split)) == NULL) {
+        fprintf(stderr, "async: failed to allocate transaction split\n");
+        free(split);
+        free(left);
+        async_complete(async, connection, transaction, NULL);
+        return;
+    }
+    *split = (async_split_t){.position = table->positions[transaction->handles[half - 1]], .outstanding = 2};
+    left->next = right;
+    right->next = connection->queued;
+    connection->queued = left;
+    async->pending += 2;
+    transaction->handles_count = 0; // now read by the halves
+    async_complete(async, connection, transaction, NULL);
+}
+
+static bool async_frame(thermia_async_t *async, async_connection_t *connection, const uint8_t *frame, size_t length) {
+    const uint16_t id = (uint16_t)(frame[0] << 8 | frame[1]);
+    async_transaction_t **link = &connection->inflight;
+    while (*link != NULL && (*link)->id != id)
+        link = &(*link)->next;
+    if (*link == NULL)
+        return true; // late response to an expired transaction
+    async_transaction_t *transaction = *link;
+    *link = transaction->next;
+    connection->inflight_count--;
+
+    const uint8_t function = register_read_function(transaction->type);
+    STATS_RECORD(connection->ctx, function, transaction->length, frame[7] == function, MODBUS_ENOBASE + frame[8], transaction->sent_us);
+    if (frame[7] == (function | 0x80)) {
+        if (frame[8] == MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS)
+            async_transaction_split(async, connection, transaction);
+        else {
+            fprintf(stderr, "async: failed to read block (address %d, count %d): exception 0x%02x\n", transaction->address, transaction->length, frame[8]);
+            async_complete(async, connection, transaction, NULL);
+        }
+        return true;
+    }
+    const int bytes = is_register_type_bit(transaction->type) ? (transaction->length + 7) / 8 : transaction->length * 2;
+    if (frame[7] != function || frame[8] != bytes || length != 9 + (size_t)bytes) {
+        async_complete(async, connection, transaction, NULL);
+        return false;
+    }
+    int values[MODBUS_MAX_READ_BITS];
+    const uint8_t *data = frame + 9;
+    for (int i = 0; i < transaction->length; i++)
+        values[i] = is_register_type_bit(transaction->type) ? (data[i / 8] >> (i % 8)) & 1 : (int16_t)(data[2 * i] << 8 | data[2 * i + 1]);
+    async_complete(async, connection, transaction, values);
+    return true;
+}
+
+static bool async_connection_receive(thermia_async_t *async, async_connection_t *connection) {
+    for (;;) {
+        const ssize_t received = recv(connection->fd, connection->rx + connection->rx_length, sizeof(connection->rx) - connection->rx_length, 0);
+        if (received == 0) {
+            async_connection_fail(async, connection, "closed by peer");
+            return false;
+        }
+        if (received == -1) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                return true;
+            async_connection_fail(async, connection, strerror(errno));
+            return false;
+        }
+        connection->rx_length += (size_t)received;
+        size_t offset = 0;
+        while (connection->rx_length - offset >= 9) {
+            const uint8_t *frame = connection->rx + offset;
+            const size_t length = 6 + (size_t)(frame[4] << 8 | frame[5]);
+            if (length < 9 || length > ASYNC_FRAME_MAX || frame[2] != 0 || frame[3] != 0) {
+                async_connection_fail(async, connection, "malformed response");
+                return false;
+            }
+            if (connection->rx_length - offset < length)
+                break;
+            if (!async_frame(async, connection, frame, length)) {
+                async_connection_fail(async, connection, "response does not match request");
+                return false;
+            }
+            if (connection->fd == -1) // failed from within a callback
+                return false;
+            offset += length;
+        }
+        connection->rx_length -= offset;
+        memmove(connection->rx, connection->rx + offset, connection->rx_length);
+    }
+}
+
+static async_connection_t *async_connection_find(const thermia_async_t *async, const thermia_modbus_t *ctx) {
+    for (int i = 0; i < async->connections_count; i++)
+        if (async->connections[i]->ctx == ctx)
+            return async->connections[i];
+    return NULL;
+}
+
+thermia_async_t *thermia_async_create(void) {
+    thermia_async_t *async = calloc(1, sizeof(thermia_async_t));
+    if (async == NULL || (async->epoll_fd = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+        fprintf(stderr, "async: initialisation failed: %s\n", strerror(errno));
+        free(async);
+        return NULL;
+    }
+    return async;
+}
+
+void thermia_async_destroy(thermia_async_t *async) {
+    if (async != NULL) {
+        for (int i = 0; i < async->connections_count; i++) {
+            async_connection_fail(async, async->connections[i], NULL);
+            free(async->connections[i]);
+        }
+        close(async->epoll_fd);
+        free(async);
+    }
+}
+
+bool thermia_async_attach(thermia_async_t *async, thermia_modbus_t *ctx) {
+    MODBUS_CHECK(ctx);
+
+    if (async_connection_find(async, ctx) != NULL)
+        return true;
+    if (async->connections_count == ASYNC_CONNECTIONS_MAX) {
+        fprintf(stderr, "async: too many connections\n");
+        return false;
+    }
+    async_connection_t *connection = calloc(1, sizeof(async_connection_t));
+    if (connection == NULL) {
+        fprintf(stderr, "async: failed to allocate connection\n");
+        return false;
+    }
+    connection->ctx = ctx;
+    connection->fd = -1;
+    if (!async_connection_open(async, connection)) {
+        free(connection);
+        return false;
+    }
+    async->connections[async->connections_count++] = connection;
+    return true;
+}
+
+int thermia_async_fd(const thermia_async_t *async) { return async->epoll_fd; }
+
+int thermia_async_pending(const thermia_async_t *async) { return async->pending; }
+
+static int async_position_compare(const void *a, const void *b) { return *(const int *)a - *(const int *)b; }
+
+bool thermia_async_read_handles(thermia_async_t *async, thermia_modbus_t *ctx, const thermia_modbus_handle_t *handles, int count,
+                                thermia_async_callback_t callback, void *callback_arg) {
+    MODBUS_CHECK(ctx);
+
+    async_connection_t *connection = async_connection_find(async, ctx);
+    if (connection == NULL) {
+        fprintf(stderr, "async: context not attached\n");
+        return false;
+    }
+    if (connection->fd == -1 && !async_connection_open(async, connection))
+        return false;
+    int *positions = malloc(sizeof(int) * (size_t)(count > 0 ? count : 1));
+    if (positions == NULL) {
+        fprintf(stderr, "async: failed to allocate positions\n");
+        return false;
+    }
+    const register_model_table_t *table = ctx->table;
+    int positions_count = 0;
+    for (int i = 0; i < count; i++)
+        if (handles[i] < 0 || handles[i] >= g_num_registers || table->positions[handles[i]] < 0)
+            fprintf(stderr, "register: handle %d invalid for operation\n", handles[i]);
+        else
+            positions[positions_count++] = table->positions[handles[i]];
+    qsort(positions, (size_t)positions_count, sizeof(int), async_position_compare);
+
+    async_transaction_t **queued_tail = &connection->queued;
+    while (*queued_tail != NULL)
+        queued_tail = &(*queued_tail)->next;
+    bool queued = true;
+    int holes_count = 0;
+    pthread_mutex_lock(&ctx->io_lock); // runs are cut where the planner learned holes, shared with blocking reads
+    for (int start = 0, end; start < positions_count; start = end) {
+        if (ctx->planner[positions[start]] & PLANNER_HOLE) {
+            end = start + 1;
+            holes_count++;
+            continue;
+        }
+        for (end = start + 1; end < positions_count && table->runs_of[positions[end]] == table->runs_of[positions[start]] &&
+                              !planner_is_cut(ctx, positions[end - 1], positions[end]);
+             end++)
+            ;
+        const register_def_t *first = &g_registers[table->order[positions[start]]], *last = &g_registers[table->order[positions[end - 1]]];
+        async_transaction_t *transaction =
+            async_transaction_new(first->type, first->address, last->address - first->address + 1, end - start, callback, callback_arg);
+        if (transaction == NULL) {
+            queued = false;
+            break;
+        }
+        for (int i = start; i < end; i++)
+            transaction->handles[i - start] = table->order[positions[i]];
+        *queued_tail = transaction;
+        queued_tail = &transaction->next;
+        async->pending++;
+    }
+    pthread_mutex_unlock(&ctx->io_lock);
+    free(positions);
+    async_connection_service(async, connection);
+    return queued && positions_count == count && holes_count == 0;
+}
+
+int thermia_async_dispatch(thermia_async_t *async, int timeout_ms) {
+    uint64_t now_ms = time_now_ms();
+    for (int i = 0; i < async->connections_count; i++) {
+        const async_connection_t *connection = async->connections[i];
+        const uint64_t deadline_ms = connection->connecting        ? connection->connect_deadline_ms
+                                     : connection->inflight != NULL ? connection->inflight->deadline_ms
+                                                                    : 0;
+        if (deadline_ms > 0 && (timeout_ms < 0 || deadline_ms < now_ms + (uint64_t)timeout_ms))
+            timeout_ms = deadline_ms > now_ms ? (int)(deadline_ms - now_ms) : 0;
+    }
+    const int completed = async->completed;
+    struct epoll_event events[ASYNC_CONNECTIONS_MAX];
+    const int events_count = epoll_wait(async->epoll_fd, events, ASYNC_CONNECTIONS_MAX, timeout_ms);
+    if (events_count == -1 && errno != EINTR) {
+        fprintf(stderr, "async: wait failed: %s\n", strerror(errno));
+        return -1;
+    }
+    for (int i = 0; i < events_count; i++) {
+        async_connection_t *connection = events[i].data.ptr;
+        if (connection->fd == -1)
+            continue;
+        if (connection->connecting && events[i].events & (EPOLLOUT | EPOLLERR | EPOLLHUP)) {
+            int error = 0;
+            socklen_t error_length = sizeof(error);
+            getsockopt(connection->fd, SOL_SOCKET, SO_ERROR, &error, &error_length);
+            if (error != 0 || events[i].events & (EPOLLERR | EPOLLHUP)) {
+                async_connection_fail(async, connection, strerror(error != 0 ? error : ECONNREFUSED));
+                continue;
+            }
+            connection->connecting = false;
+        }
+        if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+            async_connection_receive(async, connection);
+    }
+
+    now_ms = time_now_ms();
+    for (int i = 0; i < async->connections_count; i++) {
+        async_connection_t *connection = async->connections[i];
+        if (connection->connecting && connection->connect_deadline_ms <= now_ms)
+            async_connection_fail(async, connection, "connection timed out");
+        if (connection->inflight != NULL && connection->inflight->deadline_ms <= now_ms) {
+            // a late response would still arrive, out of order with the rest, so the connection goes with the transaction
+            for (const async_transaction_t *transaction = connection->inflight; transaction != NULL && transaction->deadline_ms <= now_ms;
+                 transaction = transaction->next) // in deadline order
+                STATS_RECORD(connection->ctx, register_read_function(transaction->type), transaction->length, false, ETIMEDOUT, transaction->sent_us);
+            fprintf(stderr, "async: failed to read block (address %d, count %d): response timed out\n", connection->inflight->address,
+                    connection->inflight->length);
+            async_connection_fail(async, connection, "response timed out");
+        }
+        async_connection_service(async, connection);
+    }
+    return async->completed - completed;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Poller: each register has its own interval and next deadline, kept in a min-heap ordered by deadline. A tick pops
+ * everything that is due and reads it as one block read, so registers sharing an interval also share PDUs, while slow
+ * moving registers (versions, enables, setpoints) stop costing bus traffic at the fast rate. Deadlines advance by the
+ * interval (no drift) unless the poller has fallen a whole interval behind, in which case they restart from now.
+ *
+ * Triggers are evaluated on each value as it is delivered (per tick, or per block from the async engine), chained by
+ * handle so registers without any cost one check. A trigger fires when its condition starts to hold and rearms once it
+ * no longer does, thresholds only past the hysteresis band, so a value hovering at the threshold fires once.
+ */
+
+typedef struct {
+    thermia_modbus_handle_t handle;
+    int interval_ms;
+    uint64_t due_ms;
+} poller_entry_t;
+
+#define TRIGGER_UNKNOWN 0 // before the first value
+#define TRIGGER_CLEAR 1
+#define TRIGGER_HOLDS 2
+
+typedef struct {
+    thermia_modbus_handle_t handle;
+    thermia_trigger_kind_t kind;
+    double threshold, hysteresis;
+    thermia_trigger_callback_t callback;
+    void *callback_arg;
+    int state;
+    int next; // next trigger on the same handle, -1 if last
+} poller_trigger_t;
+
+struct thermia_poller {
+    thermia_modbus_t *ctx;
+    thermia_poller_callback_t callback;
+    void *callback_arg;
+    poller_entry_t *heap;
+    int heap_count;
+    int *heap_position; // by handle, -1 if not scheduled
+    thermia_modbus_handle_t *due_handles;
+    int *due_values;
+    bool *due_valid;
+    poller_trigger_t *triggers;
+    int triggers_count, triggers_size;
+    int *trigger_first; // by handle, -1 if none
+};
+
+static void poller_heap_swap(thermia_poller_t *poller, int a, int b) {
+    const poller_entry_t entry = poller->heap[a];
+    poller->heap[a] = poller->heap[b];
+    poller->heap[b] = entry;
+    poller->heap_position[poller->heap[a].handle] = a;
+    poller->heap_position[poller->heap[b].handle] = b;
+}
+
+static void poller_heap_up(thermia_poller_t *poller, int position) {
+    while (position > 0 && poller->heap[(position - 1) / 2].due_ms > poller->heap[position].due_ms) {
+        poller_heap_swap(poller, position, (position - 1) / 2);
+        position = (position - 1) / 2;
+    }
+}
+
+static void poller_heap_down(thermia_poller_t *poller, int position) {
+    for (;;) {
+        int smallest = position;
+        const int left = 2 * position + 1, right = left + 1;
+        if (left < poller->heap_count && poller->heap[left].due_ms < poller->heap[smallest].due_ms)
+            smallest = left;
+        if (right < poller->heap_count && poller->heap[right].due_ms < poller->heap[smallest].due_ms)
+            smallest = right;
+        if (smallest == position)
+            return;
+        poller_heap_swap(poller, position, smallest);
+        position = smallest;
+    }
+}
+
+thermia_poller_t *thermia_poller_create(thermia_modbus_t *ctx, thermia_poller_callback_t callback, void *callback_arg) {
+    thermia_poller_t *poller = calloc(1, sizeof(thermia_poller_t));
+    if (poller == NULL || (poller->heap = malloc(sizeof(poller_entry_t) * (size_t)g_num_registers)) == NULL ||
+        (poller->heap_position = malloc(sizeof(int) * (size_t)g_num_registers)) == NULL ||
+        (poller->due_handles = malloc(sizeof(thermia_modbus_handle_t) * (size_t)g_num_registers)) == NULL ||
+        (poller->due_values = malloc(sizeof(int) * (size_t)g_num_registers)) == NULL ||
+        (poller->due_valid = malloc(sizeof(bool) * (size_t)g_num_registers)) == NULL ||
+        (poller->trigger_first = malloc(sizeof(int) * (size_t)g_num_registers)) == NULL) {
+        fprintf(stderr, "poller: failed to allocate\n");
+        thermia_poller_destroy(poller);
+        return NULL;
+    }
+    poller->ctx = ctx;
+    poller->callback = callback;
+    poller->callback_arg = callback_arg;
+    for (int i = 0; i < g_num_registers; i++)
+        poller->heap_position[i] = poller->trigger_first[i] = -1;
+    return poller;
+}
+
+void thermia_poller_destroy(thermia_poller_t *poller) {
+    if (poller != NULL) {
+        free(poller->heap);
+        free(poller->heap_position);
+        free(poller->due_handles);
+        free(poller->due_values);
+        free(poller->due_valid);
+        free(poller->triggers);
+        free(poller->trigger_first);
+        free(poller);
+    }
+}
+
+static void poller_schedule(thermia_poller_t *poller, thermia_modbus_handle_t handle, int interval_ms, uint64_t due_ms) {
+    int position = poller->heap_position[handle];
+    if (position == -1) {
+        position = poller->heap_count++;
+        poller->heap_position[handle] = position;
+    }
+    poller->heap[position] = (poller_entry_t){.handle = handle, .interval_ms = interval_ms, .due_ms = due_ms};
+    poller_heap_up(poller, position);
+    poller_heap_down(poller, poller->heap_position[handle]);
+}
+
+bool thermia_poller_add(thermia_poller_t *poller, const char *name, int interval_ms) {
+    thermia_modbus_handle_t handle;
+    if (interval_ms <= 0) {
+        fprintf(stderr, "poller: invalid interval %d for '%s'\n", interval_ms, name);
+        return false;
+    }
+    if (!thermia_modbus_resolve_register(poller->ctx, name, &handle))
+        return false;
+    poller_schedule(poller, handle, interval_ms, time_now_ms());
+    return true;
+}
+
+int thermia_poller_add_group(thermia_poller_t *poller, const char *system, const char *subsystem, int interval_ms) {
+    if (interval_ms <= 0) {
+        fprintf(stderr, "poller: invalid interval %d for group\n", interval_ms);
+        return 0;
+    }
+    const register_model_table_t *table = poller->ctx->table;
+    const uint64_t now_ms = time_now_ms();
+    int count = 0;
+    for (int group = 0; group < REGISTERS_GROUPS; group++) {
+        const register_group_t *names = &g_registers_groups[group];
+        if ((system == NULL || strcmp(names->system, system) == 0) && (subsystem == NULL || strcmp(names->subsystem, subsystem) == 0))
+            for (int i = 0; i < table->groups[group].count; i++, count++)
+                poller_schedule(poller, (thermia_modbus_handle_t)table->order[table->group_positions[table->groups[group].first + i]], interval_ms, now_ms);
+    }
+    return count;
+}
+
+bool thermia_poller_add_trigger(thermia_poller_t *poller, const char *name, thermia_trigger_kind_t kind, double threshold, double hysteresis,
+                                thermia_trigger_callback_t callback, void *callback_arg) {
+    thermia_modbus_handle_t handle;
+    if (callback == NULL || kind < THERMIA_TRIGGER_RISING || kind > THERMIA_TRIGGER_BELOW || !(hysteresis >= 0)) {
+        fprintf(stderr, "poller: invalid trigger for '%s'\n", name);
+        return false;
+    }
+    if (!thermia_modbus_resolve_register(poller->ctx, name, &handle))
+        return false;
+    if (poller->triggers_count == poller->triggers_size) {
+        const int size = poller->triggers_size > 0 ? poller->triggers_size * 2 : 16;
+        poller_trigger_t *triggers = realloc(poller->triggers, sizeof(poller_trigger_t) * (size_t)size);
+        if (triggers == NULL) {
+            fprintf(stderr, "poller: failed to allocate triggers\n");
+            return false;
+        }
+        poller->triggers = triggers;
+        poller->triggers_size = size;
+    }
+    const int trigger = poller->triggers_count++;
+    poller->triggers[trigger] = (poller_trigger_t){.handle = handle,
+                                                   .kind = kind,
+                                                   .threshold = threshold,
+                                                   .hysteresis = hysteresis,
+                                                   .callback = callback,
+                                                   .callback_arg = callback_arg,
+                                                   .state = TRIGGER_UNKNOWN,
+                                                   .next = -1};
+    int *link = &poller->trigger_first[handle]; // appended, so triggers on a register fire in the order added
+    while (*link >= 0)
+        link = &poller->triggers[*link].next;
+    *link = trigger;
+    return true;
+}
+
+static bool trigger_holds(const poller_trigger_t *trigger, double value) {
+    switch (trigger->kind) {
+    case THERMIA_TRIGGER_RISING:
+        return value != 0;
+    case THERMIA_TRIGGER_FALLING:
+        return value == 0;
+    case THERMIA_TRIGGER_ABOVE:
+        return value >= trigger->threshold - (trigger->state == TRIGGER_HOLDS ? trigger->hysteresis : 0);
+    default:
+        return value <= trigger->threshold + (trigger->state == TRIGGER_HOLDS ? trigger->hysteresis : 0);
+    }
+}
+
+// a falling edge needs a value seen set first, the other conditions fire on the first value too (an alarm present at start)
+static void poller_triggers(thermia_poller_t *poller, thermia_modbus_handle_t handle, int value) {
+    const double scaled = register_value(handle, value);
+    // followed by index, as a callback adding triggers may move them
+    for (int i = poller->trigger_first[handle]; i >= 0; i = poller->triggers[i].next) {
+        poller_trigger_t *trigger = &poller->triggers[i];
+        const bool holds = trigger_holds(trigger, scaled);
+        const bool fire = holds && (trigger->state == TRIGGER_CLEAR || (trigger->state == TRIGGER_UNKNOWN && trigger->kind != THERMIA_TRIGGER_FALLING));
+        trigger->state = holds ? TRIGGER_HOLDS : TRIGGER_CLEAR;
+        if (fire)
+            trigger->callback(trigger->callback_arg, handle, scaled);
+    }
+}
+
+static void poller_deliver(thermia_poller_t *poller, thermia_modbus_handle_t handle, int value) {
+    if (poller->callback != NULL)
+        poller->callback(poller->callback_arg, handle, value);
+    if (poller->trigger_first[handle] >= 0)
+        poller_triggers(poller, handle, value);
+}
+
+int thermia_poller_next_ms(const thermia_poller_t *poller) {
+    if (poller->heap_count == 0)
+        return -1;
+    const uint64_t now_ms = time_now_ms();
+    return poller->heap[0].due_ms > now_ms ? (int)(poller->heap[0].due_ms - now_ms) : 0;
+}
+
+// pops everything due into due_handles and schedules the next deadlines
+static int poller_take_due(thermia_poller_t *poller) {
+    const uint64_t now_ms = time_now_ms();
+    int due_count = 0;
+    while (poller->heap_count > 0 && poller->heap[0].due_ms <= now_ms) {
+        poller_entry_t *entry = &poller->heap[0];
+        poller->due_handles[due_count++] = entry->handle;
+        entry->due_ms += (uint64_t)entry->interval_ms;
+        if (entry->due_ms <= now_ms)
+            entry->due_ms = now_ms + (uint64_t)entry->interval_ms;
+        poller_heap_down(poller, 0);
+        // every popped entry is now due in the future, so the loop ends after each register is taken once
+    }
+    return due_count;
+}
+
+int thermia_poller_tick(thermia_poller_t *poller) {
+    const int due_count = poller_take_due(poller);
+    if (due_count == 0)
+        return 0;
+
+    thermia_modbus_read_handles(poller->ctx, poller->due_handles, due_count, poller->due_values, poller->due_valid);
+    int read_count = 0;
+    for (int i = 0; i < due_count; i++)
+        if (poller->due_valid[i]) {
+            poller_deliver(poller, poller->due_handles[i], poller->due_values[i]);
+            read_count++;
+        }
+    return read_count;
+}
+
+static void poller_async_callback(void *arg, thermia_modbus_handle_t handle, int value, bool valid) {
+    thermia_poller_t *poller = (thermia_poller_t *)arg;
+    if (valid)
+        poller_deliver(poller, handle, value);
+}
+
+int thermia_poller_tick_async(thermia_poller_t *poller, thermia_async_t *async) {
+    const int due_count = poller_take_due(poller);
+    if (due_count == 0)
+        return 0;
+    return thermia_async_read_handles(async, poller->ctx, poller->due_handles, due_count, poller_async_callback, poller) ? due_count : 0;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Write queue: setpoints are queued by handle instead of written at once. Queueing a register already pending just
+ * replaces its value, so a burst of adjustments collapses to the latest one, and flushes are paced to at most one per
+ * interval. A flush drops values equal to what the cache last saw on the controller, then sends the rest as one batch
+ * write (consecutive addresses in write multiple requests); anything that fails stays queued for the next flush unless
+ * a newer value was queued meanwhile. The cache is trusted as the controller's state: a change made on the controller's
+ * own display is not seen until the register is read again.
+ */
+
+struct thermia_write_queue {
+    thermia_modbus_t *ctx;
+    pthread_mutex_t lock;
+    int interval_ms;
+    uint64_t flushed_ms;
+    thermia_modbus_handle_t *pending; // in queued order
+    int pending_count;
+    int *values;  // by handle
+    bool *queued; // by handle
+    thermia_modbus_handle_t *flush_handles;
+    int *flush_values;
+    bool *flush_written;
+};
+
+thermia_write_queue_t *thermia_write_queue_create(thermia_modbus_t *ctx, int interval_ms) {
+    thermia_write_queue_t *queue = calloc(1, sizeof(thermia_write_queue_t));
+    if (queue == NULL) {
+        fprintf(stderr, "queue: failed to allocate\n");
+        return NULL;
+    }
+    pthread_mutex_init(&queue->lock, NULL);
+    if ((queue->pending = malloc(sizeof(thermia_modbus_handle_t) * (size_t)g_num_registers)) == NULL ||
+        (queue->values = malloc(sizeof(int) * (size_t)g_num_registers)) == NULL || (queue->queued = calloc((size_t)g_num_registers, sizeof(bool))) == NULL ||
+        (queue->flush_handles = malloc(sizeof(thermia_modbus_handle_t) * (size_t)g_num_registers)) == NULL ||
+        (queue->flush_values = malloc(sizeof(int) * (size_t)g_num_registers)) == NULL ||
+        (queue->flush_written = malloc(sizeof(bool) * (size_t)g_num_registers)) == NULL) {
+        fprintf(stderr, "queue: failed to allocate\n");
+        thermia_write_queue_destroy(queue);
+        return NULL;
+    }
+    queue->ctx = ctx;
+    queue->interval_ms = interval_ms > 0 ? interval_ms : 0;
+    return queue;
+}
+
+void thermia_write_queue_destroy(thermia_write_queue_t *queue) {
+    if (queue != NULL) {
+        pthread_mutex_destroy(&queue->lock);
+        free(queue->pending);
+        free(queue->values);
+        free(queue->queued);
+        free(queue->flush_handles);
+        free(queue->flush_values);
+        free(queue->flush_written);
+        free(queue);
+    }
+}
+
+// caller holds the queue lock
+static void write_queue_put(thermia_write_queue_t *queue, thermia_modbus_handle_t handle, int value) {
+    if (!queue->queued[handle]) {
+        queue->queued[handle] = true;
+        queue->pending[queue->pending_count++] = handle;
+    }
+    queue->values[handle] = value;
+}
+
+bool thermia_write_queue_set_handle(thermia_write_queue_t *queue, thermia_modbus_handle_t handle, int value) {
+    if (handle < 0 || handle >= g_num_registers || !(g_registers[handle].type & (REG_COIL_STATUS | REG_HOLDING)) ||
+        queue->ctx->table->positions[handle] < 0) {
+        fprintf(stderr, "register: handle %d invalid for operation\n", handle);
+        return false;
+    }
+    pthread_mutex_lock(&queue->lock);
+    write_queue_put(queue, handle, g_registers[handle].type == REG_COIL_STATUS ? value != 0 : value);
+    pthread_mutex_unlock(&queue->lock);
+    return true;
+}
+
+bool thermia_write_queue_set_bit(thermia_write_queue_t *queue, const char *name, bool value) {
+    const register_def_t *reg = find_register(name, REG_COIL_STATUS);
+    REGISTER_CHECK(queue->ctx, reg);
+
+    return thermia_write_queue_set_handle(queue, (thermia_modbus_handle_t)(reg - g_registers), value);
+}
+
+bool thermia_write_queue_set_int(thermia_write_queue_t *queue, const char *name, int value) {
+    const register_def_t *reg = find_register(name, REG_HOLDING);
+    REGISTER_CHECK(queue->ctx, reg);
+
+    return thermia_write_queue_set_handle(queue, (thermia_modbus_handle_t)(reg - g_registers), value);
+}
+
+int thermia_write_queue_pending(thermia_write_queue_t *queue) {
+    pthread_mutex_lock(&queue->lock);
+    const int pending_count = queue->pending_count;
+    pthread_mutex_unlock(&queue->lock);
+    return pending_count;
+}
+
+int thermia_write_queue_next_ms(thermia_write_queue_t *queue) {
+    if (thermia_write_queue_pending(queue) == 0)
+        return -1;
+    const uint64_t now_ms = time_now_ms(), due_ms = queue->flushed_ms + (uint64_t)queue->interval_ms;
+    return due_ms > now_ms ? (int)(due_ms - now_ms) : 0;
+}
+
+int thermia_write_queue_flush(thermia_write_queue_t *queue, bool force) {
+    const uint64_t now_ms = time_now_ms();
+    if (!force && now_ms < queue->flushed_ms + (uint64_t)queue->interval_ms)
+        return 0;
+
+    pthread_mutex_lock(&queue->lock);
+    int flush_count = 0;
+    for (int i = 0; i < queue->pending_count; i++) {
+        const thermia_modbus_handle_t handle = queue->pending[i];
+        const int value = queue->values[handle];
+        int cached;
+        queue->queued[handle] = false;
+        if (thermia_modbus_cache_get(queue->ctx, handle, &cached, NULL) && cached == (g_registers[handle].type == REG_COIL_STATUS ? value : (int16_t)value))
+            continue; // already the controller's value
+        queue->flush_handles[flush_count] = handle;
+        queue->flush_values[flush_count++] = value;
+    }
+    queue->pending_count = 0;
+    pthread_mutex_unlock(&queue->lock);
+    if (flush_count == 0)
+        return 0;
+    queue->flushed_ms = now_ms;
+
+    thermia_modbus_write_handles(queue->ctx, queue->flush_handles, queue->flush_values, flush_count, queue->flush_written, NULL);
+    int written_count = 0;
+    pthread_mutex_lock(&queue->lock);
+    for (int i = 0; i < flush_count; i++)
+        if (queue->flush_written[i])
+            written_count++;
+        else if (!queue->queued[queue->flush_handles[i]]) // retried next flush, unless superseded meanwhile
+            write_queue_put(queue, queue->flush_handles[i], queue->flush_values[i]);
+    pthread_mutex_unlock(&queue->lock);
+    return written_count;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Fleet: devices sit in one schedule shared by a fixed pool of worker threads. A free worker takes whichever device is
+ * due earliest and not already being polled (a linear scan, fleets are dozens of units), reads all its registers into
+ * the device context's cache, and returns it to the schedule. A unit that stops answering only holds the worker on
+ * it until its request policy gives up (and its breaker then fails fast); meanwhile the other workers carry on with
+ * the rest, and the unit is rescheduled with a backoff doubling up to a limit until it answers again. Devices that
+ * cannot be connected at all are opened again on the same backoff.
+ */
+
+#define FLEET_BACKOFF_MAX_MS 60000
+
+typedef struct {
+    char address[256];
+    int port;
+    model_t model;
+    thermia_modbus_t *ctx; // NULL until first connected
+    uint64_t due_ms;
+    bool busy;
+    int failures; // consecutive
+    uint64_t polled_ms;
+    thermia_fleet_status_t status;
+} fleet_device_t;
+
+struct thermia_fleet {
+    pthread_mutex_t lock;
+    pthread_cond_t changed; // schedule changed, or stopping
+    bool running;
+    int interval_ms;
+    fleet_device_t *devices;
+    int devices_count;
+    pthread_t *workers;
+    int workers_count;
+};
+
+static uint32_t fleet_backoff_ms(const thermia_fleet_t *fleet, int failures) {
+    uint64_t backoff_ms = (uint64_t)fleet->interval_ms;
+    for (int i = 1; i < failures && backoff_ms < FLEET_BACKOFF_MAX_MS; i++)
+        backoff_ms *= 2;
+    return backoff_ms < FLEET_BACKOFF_MAX_MS ? (uint32_t)backoff_ms : FLEET_BACKOFF_MAX_MS;
+}
+
+// the device due earliest, or NULL if all are being polled
+static fleet_device_t *fleet_next(thermia_fleet_t *fleet) {
+    fleet_device_t *next = NULL;
+    for (int i = 0; i < fleet->devices_count; i++)
+        if (!fleet->devices[i].busy && (next == NULL || fleet->devices[i].due_ms < next->due_ms))
+            next = &fleet->devices[i];
+    return next;
+}
+
+// without the fleet lock: only the worker holding the device (busy) uses its context
+static bool fleet_poll(thermia_fleet_t *fleet, fleet_device_t *device, int *values, bool *valid) {
+    if (device->ctx == NULL) {
+        thermia_modbus_t *ctx = thermia_modbus_open(device->address, device->port, device->model);
+        if (ctx == NULL)
+            return false;
+        pthread_mutex_lock(&fleet->lock);
+        device->ctx = ctx;
+        pthread_mutex_unlock(&fleet->lock);
+    }
+    thermia_modbus_read_all(device->ctx, values, valid);
+    for (int i = 0; i < g_num_registers; i++)
+        if (valid[i])
+            return true;
+    return false;
+}
+
+static void *fleet_worker(void *arg) {
+    thermia_fleet_t *fleet = (thermia_fleet_t *)arg;
+    int values[g_num_registers];
+    bool valid[g_num_registers];
+    pthread_mutex_lock(&fleet->lock);
+    while (fleet->running) {
+        fleet_device_t *device = fleet_next(fleet);
+        const uint64_t now_ms = time_now_ms();
+        if (device == NULL || device->due_ms > now_ms) {
+            if (device == NULL)
+                pthread_cond_wait(&fleet->changed, &fleet->lock);
+            else {
+                const struct timespec until = {.tv_sec = (time_t)(device->due_ms / 1000), .tv_nsec = (long)(device->due_ms % 1000) * 1000000};
+                pthread_cond_timedwait(&fleet->changed, &fleet->lock, &until);
+            }
+            continue;
+        }
+        device->busy = true;
+        const uint64_t due_ms = device->due_ms;
+        pthread_mutex_unlock(&fleet->lock);
+
+        const bool polled = fleet_poll(fleet, device, values, valid);
+        const uint64_t done_ms = time_now_ms();
+
+        pthread_mutex_lock(&fleet->lock);
+        thermia_fleet_status_t *status = &device->status;
+        status->lag_ms = (uint32_t)(now_ms - due_ms);
+        if (status->lag_ms > status->lag_max_ms)
+            status->lag_max_ms = status->lag_ms;
+        status->duration_ms = (uint32_t)(done_ms - now_ms);
+        status->polls++;
+        if (polled) {
+            if (!status->online && device->failures > 0)
+                fprintf(stderr, "fleet: %s:%d online again\n", device->address, device->port);
+            status->online = true;
+            device->failures = 0;
+            device->polled_ms = done_ms;
+            device->due_ms = due_ms + (uint64_t)fleet->interval_ms;
+            if (device->due_ms <= done_ms) // overran, skip the missed polls rather than bunch them up
+                device->due_ms = done_ms + (uint64_t)fleet->interval_ms;
+        } else {
+            if (status->online || device->failures == 0)
+                fprintf(stderr, "fleet: %s:%d offline, backing off\n", device->address, device->port);
+            status->online = false;
+            status->failures++;
+            device->due_ms = done_ms + fleet_backoff_ms(fleet, ++device->failures);
+        }
+        device->busy = false;
+        pthread_cond_broadcast(&fleet->changed);
+    }
+    pthread_mutex_unlock(&fleet->lock);
+    return NULL;
+}
+
+thermia_fleet_t *thermia_fleet_create(const thermia_fleet_device_t *devices, int count, int workers, int interval_ms) {
+    if (count <= 0 || workers <= 0 || interval_ms <= 0) {
+        fprintf(stderr, "fleet: invalid devices %d, workers %d or interval %d\n", count, workers, interval_ms);
+        return NULL;
+    }
+    thermia_fleet_t *fleet = calloc(1, sizeof(thermia_fleet_t));
+    if (fleet == NULL || (fleet->devices = calloc((size_t)count, sizeof(fleet_device_t))) == NULL ||
+        (fleet->workers = calloc((size_t)workers, sizeof(pthread_t))) == NULL) {
+        fprintf(stderr, "fleet: failed to allocate\n");
+        if (fleet != NULL)
+            free(fleet->devices);
+        free(fleet);
+        return NULL;
+    }
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC); // deadlines are time_now_ms
+    pthread_cond_init(&fleet->changed, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_mutex_init(&fleet->lock, NULL);
+    fleet->running = true;
+    fleet->interval_ms = interval_ms;
+    fleet->devices_count = count;
+    const uint64_t now_ms = time_now_ms();
+    for (int i = 0; i < count; i++) {
+        fleet_device_t *device = &fleet->devices[i];
+        snprintf(device->address, sizeof(device->address), "%s", devices[i].address);
+        device->port = devices[i].port;
+        device->model = devices[i].model;
+        device->due_ms = now_ms + (uint64_t)interval_ms * (uint64_t)i / (uint64_t)count; // spread over the first interval
+    }
+    for (; fleet->workers_count < workers; fleet->workers_count++) {
+        const int error = pthread_create(&fleet->workers[fleet->workers_count], NULL, fleet_worker, fleet);
+        if (error != 0) {
+            fprintf(stderr, "fleet: failed to start worker: %s\n", strerror(error));
+            thermia_fleet_destroy(fleet);
+            return NULL;
+        }
+    }
+    return fleet;
+}
+
+void thermia_fleet_destroy(thermia_fleet_t *fleet) {
+    if (fleet != NULL) {
+        pthread_mutex_lock(&fleet->lock);
+        fleet->running = false;
+        pthread_cond_broadcast(&fleet->changed);
+        pthread_mutex_unlock(&fleet->lock);
+        for (int i = 0; i < fleet->workers_count; i++)
+            pthread_join(fleet->workers[i], NULL);
+        for (int i = 0; i < fleet->devices_count; i++)
+            thermia_modbus_close(fleet->devices[i].ctx);
+        pthread_cond_destroy(&fleet->changed);
+        pthread_mutex_destroy(&fleet->lock);
+        free(fleet->devices);
+        free(fleet->workers);
+        free(fleet);
+    }
+}
+
+thermia_modbus_t *thermia_fleet_context(thermia_fleet_t *fleet, int device) {
+    if (device < 0 || device >= fleet->devices_count)
+        return NULL;
+    pthread_mutex_lock(&fleet->lock);
+    thermia_modbus_t *ctx = fleet->devices[device].ctx;
+    pthread_mutex_unlock(&fleet->lock);
+    return ctx;
+}
+
+bool thermia_fleet_status(thermia_fleet_t *fleet, int device, thermia_fleet_status_t *status) {
+    if (device < 0 || device >= fleet->devices_count)
+        return false;
+    pthread_mutex_lock(&fleet->lock);
+    *status = fleet->devices[device].status;
+    const uint64_t polled_ms = fleet->devices[device].polled_ms, due_ms = fleet->devices[device].due_ms;
+    pthread_mutex_unlock(&fleet->lock);
+    const uint64_t now_ms = time_now_ms();
+    status->behind_ms = due_ms < now_ms ? (uint32_t)(now_ms - due_ms) : 0;
+    status->age_ms = polled_ms != 0 ? (uint32_t)(now_ms - polled_ms) : UINT32_MAX;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Shared memory: one process (the one polling the controller) publishes its context cache into a POSIX shared memory
+ * segment, and any number of local readers map it and take snapshots with plain memory reads, so extra consumers cost
+ * neither syscalls nor controller traffic. The segment is a header and one slot per register, indexed by handle, kept
+ * consistent with a seqlock: the publisher makes the sequence odd, rewrites the slots and makes it even again, while a
+ * reader copies the slots and retries if the sequence was odd or moved meanwhile. Read times are CLOCK_MONOTONIC,
+ * which is system wide, so readers can compute ages against their own clock.
+ */
+
+#define SHM_MAGIC 0x4d524854 // 'THRM'
+#define SHM_VERSION 2
+#define SHM_SNAPSHOT_ATTEMPTS 1024
+
+typedef struct {
+    int16_t value;
+    bool valid;
+    uint64_t updated_ms;
+} shm_slot_t;
+
+typedef struct {
+    uint32_t magic, version, slot_size, count;
+    model_t model;
+    int32_t publisher; // pid, so a segment is only replaced once its publisher is gone
+    _Atomic uint32_t sequence; // odd while the publisher is writing
+    uint64_t published_ms;
+    shm_slot_t slots[]; // by handle
+} shm_segment_t;
+
+struct thermia_shm {
+    thermia_modbus_t *ctx; // publisher only
+    char name[256];
+    shm_segment_t *segment;
+    size_t size;
+    uint32_t cache_sequence; // last published
+    bool published;
+};
+
+static size_t shm_segment_size(void) { return sizeof(shm_segment_t) + sizeof(shm_slot_t) * (size_t)g_num_registers; }
+
+// the live process publishing the existing segment 'name', 0 if it is orphaned (publisher gone, or another layout)
+static pid_t shm_publisher(const char *name) {
+    const int fd = shm_open(name, O_RDONLY | O_CLOEXEC, 0);
+    if (fd == -1)
+        return 0;
+    pid_t publisher = 0;
+    struct stat st;
+    if (fstat(fd, &st) != -1 && (size_t)st.st_size >= sizeof(shm_segment_t)) {
+        shm_segment_t *segment = mmap(NULL, sizeof(shm_segment_t), PROT_READ, MAP_SHARED, fd, 0);
+        if (segment != MAP_FAILED) {
+            if (segment->version == SHM_VERSION)
+                publisher = segment->publisher;
+            munmap(segment, sizeof(shm_segment_t));
+        }
+    }
+    close(fd);
+    return publisher > 0 && (kill(publisher, 0) == 0 || errno == EPERM) ? publisher : 0;
+}
+
+thermia_shm_t *thermia_shm_create(thermia_modbus_t *ctx, const char *name) {
+    thermia_shm_t *shm = calloc(1, sizeof(thermia_shm_t));
+    if (shm == NULL) {
+        fprintf(stderr, "shm: initialisation failed: %s\n", strerror(errno));
+        return NULL;
+    }
+    shm->ctx = ctx;
+    snprintf(shm->name, sizeof(shm->name), "%s", name);
+    shm->size = shm_segment_size();
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0644);
+    if (fd == -1 && errno == EEXIST) {
+        const pid_t publisher = shm_publisher(name);
+        if (publisher != 0) {
+            fprintf(stderr, "shm: create '%s' failed: published by process %d\n", name, (int)publisher);
+            free(shm);
+            return NULL;
+        }
+        // left by a publisher that did not close: readers keep the old segment mapped, this one is laid out afresh
+        fprintf(stderr, "shm: replacing orphaned segment '%s'\n", name);
+        if (shm_unlink(name) == 0 || errno == ENOENT)
+            fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0644);
+    }
+    if (fd == -1 || ftruncate(fd, (off_t)shm->size) == -1 || (shm->segment = mmap(NULL, shm->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED) {
+        fprintf(stderr, "shm: create '%s' failed: %s\n", name, strerror(errno));
+        if (fd != -1) { // created by this call, nobody else's segment
+            close(fd);
+            shm_unlink(name);
+        }
+        free(shm);
+        return NULL;
+    }
+    close(fd);
+    shm_segment_t *segment = shm->segment; // new and zero filled by ftruncate
+    segment->publisher = (int32_t)getpid();
+    segment->version = SHM_VERSION;
+    segment->slot_size = sizeof(shm_slot_t);
+    segment->count = (uint32_t)g_num_registers;
+    segment->model = ctx->model;
+    atomic_store_explicit(&segment->sequence, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    segment->magic = SHM_MAGIC; // last, readers reject the segment until it is laid out
+    return shm;
+}
+
+bool thermia_shm_publish(thermia_shm_t *shm) {
+    if (shm == NULL || shm->ctx == NULL)
+        return false;
+    thermia_modbus_t *ctx = shm->ctx;
+    shm_segment_t *segment = shm->segment;
+    pthread_mutex_lock(&ctx->cache_lock);
+    if (shm->published && ctx->cache_sequence == shm->cache_sequence) { // nothing read since
+        pthread_mutex_unlock(&ctx->cache_lock);
+        return true;
+    }
+    const uint32_t sequence = atomic_load_explicit(&segment->sequence, memory_order_relaxed);
+    atomic_store_explicit(&segment->sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    for (int i = 0; i < g_num_registers; i++) {
+        const cache_entry_t *entry = &ctx->cache[i];
+        segment->slots[i] = (shm_slot_t){.value = entry->value, .valid = entry->valid, .updated_ms = entry->updated_ms};
+    }
+    segment->published_ms = time_now_ms();
+    atomic_store_explicit(&segment->sequence, sequence + 2, memory_order_release);
+    shm->cache_sequence = ctx->cache_sequence;
+    shm->published = true;
+    pthread_mutex_unlock(&ctx->cache_lock);
+    return true;
+}
+
+thermia_shm_t *thermia_shm_open(const char *name) {
+    const int fd = shm_open(name, O_RDONLY | O_CLOEXEC, 0);
+    if (fd == -1) {
+        fprintf(stderr, "shm: open '%s' failed: %s\n", name, strerror(errno));
+        return NULL;
+    }
+    struct stat st;
+    const size_t size = shm_segment_size();
+    if (fstat(fd, &st) == -1 || (size_t)st.st_size != size) {
+        fprintf(stderr, "shm: open '%s' failed: segment size does not match register table\n", name);
+        close(fd);
+        return NULL;
+    }
+    shm_segment_t *segment = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED) {
+        fprintf(stderr, "shm: open '%s' failed: %s\n", name, strerror(errno));
+        return NULL;
+    }
+    const bool initialised = segment->magic == SHM_MAGIC;
+    atomic_thread_fence(memory_order_acquire);
+    if (!initialised || segment->version != SHM_VERSION || segment->slot_size != sizeof(shm_slot_t) || segment->count != (uint32_t)g_num_registers) {
+        fprintf(stderr, "shm: open '%s' failed: segment %s\n", name, initialised ? "layout does not match" : "not initialised");
+        munmap(segment, size);
+        return NULL;
+    }
+    thermia_shm_t *shm = calloc(1, sizeof(thermia_shm_t));
+    if (shm == NULL) {
+        fprintf(stderr, "shm: initialisation failed: %s\n", strerror(errno));
+        munmap(segment, size);
+        return NULL;
+    }
+    snprintf(shm->name, sizeof(shm->name), "%s", name);
+    shm->segment = segment;
+    shm->size = size;
+    return shm;
+}
+
+void thermia_shm_close(thermia_shm_t *shm) {
+    if (shm != NULL) {
+        munmap(shm->segment, shm->size);
+        if (shm->ctx != NULL)
+            shm_unlink(shm->name);
+        free(shm);
+    }
+}
+
+model_t thermia_shm_model(const thermia_shm_t *shm) { return shm->segment->model; }
+
+bool thermia_shm_snapshot(const thermia_shm_t *shm, int *values, bool *valid, uint64_t *updated_ms, uint32_t *generation) {
+    const shm_segment_t *segment = shm->segment;
+    for (int attempt = 0; attempt < SHM_SNAPSHOT_ATTEMPTS; attempt++) {
+        const uint32_t sequence = atomic_load_explicit(&segment->sequence, memory_order_acquire);
+        if (sequence == 0) // nothing published yet
+            return false;
+        if (sequence & 1)
+            continue;
+        for (int i = 0; i < g_num_registers; i++) {
+            const shm_slot_t slot = segment->slots[i];
+            values[i] = slot.value;
+            valid[i] = slot.valid;
+            if (updated_ms != NULL)
+                updated_ms[i] = slot.updated_ms;
+        }
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&segment->sequence, memory_order_relaxed) == sequence) {
+            if (generation != NULL)
+                *generation = sequence / 2;
+            return true;
+        }
+    }
+    return false; // publisher busy (or stopped mid write)
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Recorder: appends one compact frame per recording (registers changed by more than their deadband since the last
+ * frame, as tracked by the cache) to a file, rotating it by size. Each file is self contained and starts with a header
+ * then a key frame of every valid register, all little endian:
+ *
+ *   header: "THRMREC1", u32 register count, u32 model, u64 start time (ms since the epoch)
+ *   frame:  zigzag varint change of the interval (ms from the previous frame or the start time; 0 on a steady cadence)
+ *           changed bitmap, in three levels: a block mask byte (bit b set if any of registers 64b..64b+63 changed),
+ *           a group mask byte per set block (bit g for registers 8g..8g+7 of the block), a bitmap byte per set group
+ *           zigzag varint value delta (from the previous recorded value, 0 at the start of a file) per changed register
+ *
+ * A frame without changes is not written, so a steady state second costs nothing and typical live data (a few
+ * temperatures moving) around ten bytes. Frames go out with one write each, a torn last frame (crash) is ignored by the
+ * replay. Replay maps a file and decodes frames in place, keeping the current value of every register.
+ */
+
+#define RECORDER_MAGIC "THRMREC1"
+#define RECORDER_HEADER_SIZE 24
+#define RECORDER_GROUPS ((REGISTERS_HASH_SLOTS + 7) / 8)
+#define RECORDER_BLOCKS ((RECORDER_GROUPS + 7) / 8)
+#define RECORDER_FRAME_MAX (10 + 1 + RECORDER_BLOCKS + RECORDER_GROUPS + 5 * REGISTERS_HASH_SLOTS)
+_Static_assert(RECORDER_BLOCKS <= 8, "recorder block mask holds at most 8 blocks");
+
+struct thermia_recorder {
+    thermia_modbus_t *ctx;
+    model_t model;
+    char path[4096];
+    size_t rotate_bytes;
+    int rotate_keep;
+    int fd;
+    size_t size;
+    bool key_frame; // next frame is the first in its file
+    uint64_t last_ms, interval_ms;
+    uint32_t cursor;
+    int16_t *recorded;               // by handle, as last written
+    thermia_modbus_handle_t *handles; // changed in the current frame
+    int *values;
+    uint8_t frame[RECORDER_FRAME_MAX];
+};
+
+struct thermia_replay {
+    uint8_t *data;
+    size_t size, offset;
+    model_t model;
+    uint64_t time_ms, interval_ms;
+    int16_t *values; // by handle
+    bool *valid;
+    thermia_modbus_handle_t *frame_handles; // decoded, applied once the whole frame is
+    int32_t *frame_deltas;
+};
+
+static uint64_t time_now_epoch_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+static size_t varint_put(uint8_t *buffer, uint64_t value) {
+    size_t length = 0;
+    for (; value >= 0x80; value >>= 7)
+        buffer[length++] = (uint8_t)(value | 0x80);
+    buffer[length++] = (uint8_t)value;
+    return length;
+}
+
+static uint64_t zigzag_encode(int64_t value) { return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63); }
+
+static int64_t zigzag_decode(uint64_t value) { return (int64_t)(value >> 1) ^ -(int64_t)(value & 1); }
+
+static bool varint_get(const uint8_t *buffer, size_t size, size_t *offset, uint64_t *value) {
+    uint64_t result = 0;
+    for (int shift = 0; *offset < size && shift < 64; shift += 7) {
+        const uint8_t byte = buffer[(*offset)++];
+        result |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void recorder_put_u32(uint8_t *buffer, uint32_t value) {
+    for (int i = 0; i < 4; i++)
+        buffer[i] = (uint8_t)(value >> (8 * i));
+}
+
+static void recorder_put_u64(uint8_t *buffer, uint64_t value) {
+    for (int i = 0; i < 8; i++)
+        buffer[i] = (uint8_t)(value >> (8 * i));
+}
+
+static uint32_t recorder_get_u32(const uint8_t *buffer) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++)
+        value |= (uint32_t)buffer[i] << (8 * i);
+    return value;
+}
+
+static uint64_t recorder_get_u64(const uint8_t *buffer) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++)
+        value |= (uint64_t)buffer[i] << (8 * i);
+    return value;
+}
+
+static bool recorder_write(thermia_recorder_t *recorder, const uint8_t *data, size_t length) {
+    while (length > 0) {
+        const ssize_t written = write(recorder->fd, data, length);
+        if (written == -1 && errno == EINTR)
+            continue;
+        if (written == -1) {
+            fprintf(stderr, "recorder: write '%s' failed: %s\n", recorder->path, strerror(errno));
+            return false;
+        }
+        data += written;
+        length -= (size_t)written;
+        recorder->size += (size_t)written;
+    }
+    return true;
+}
+
+// shift path.N-1 .. path.1 up by one (dropping the oldest), move path to path.1, start path afresh
+static bool recorder_rotate(thermia_recorder_t *recorder, uint64_t now_ms) {
+    if (recorder->fd != -1) {
+        close(recorder->fd);
+        recorder->fd = -1;
+    }
+    char from[4096 + 16], to[4096 + 16];
+    for (int i = recorder->rotate_keep; i > 0; i--) {
+        if (i > 1)
+            snprintf(from, sizeof(from), "%s.%d", recorder->path, i - 1);
+        else
+            snprintf(from, sizeof(from), "%s", recorder->path);
+        snprintf(to, sizeof(to), "%s.%d", recorder->path, i);
+        if (rename(from, to) == -1 && errno != ENOENT)
+            fprintf(stderr, "recorder: rotate '%s' failed: %s\n", from, strerror(errno));
+    }
+    if ((recorder->fd = open(recorder->path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644)) == -1) {
+        fprintf(stderr, "recorder: open '%s' failed: %s\n", recorder->path, strerror(errno));
+        return false;
+    }
+    recorder->size = 0;
+    recorder->key_frame = true;
+    recorder->last_ms = now_ms;
+    recorder->interval_ms = 0;
+    memset(recorder->recorded, 0, sizeof(int16_t) * (size_t)g_num_registers);
+    uint8_t header[RECORDER_HEADER_SIZE];
+    memcpy(header, RECORDER_MAGIC, 8);
+    recorder_put_u32(header + 8, (uint32_t)g_num_registers);
+    recorder_put_u32(header + 12, (uint32_t)recorder->model);
+    recorder_put_u64(header + 16, now_ms);
+    return recorder_write(recorder, header, sizeof(header));
+}
+
+// handles in ascending order
+static bool recorder_frame(thermia_recorder_t *recorder, uint64_t now_ms, const thermia_modbus_handle_t *handles, const int *values, int count) {
+    if (count == 0)
+        return true;
+    uint8_t *frame = recorder->frame, bitmaps[RECORDER_GROUPS] = {0}, groups[RECORDER_BLOCKS] = {0}, blocks = 0;
+    for (int i = 0; i < count; i++) {
+        bitmaps[handles[i] / 8] |= (uint8_t)(1 << (handles[i] % 8));
+        groups[handles[i] / 64] |= (uint8_t)(1 << (handles[i] / 8 % 8));
+        blocks |= (uint8_t)(1 << (handles[i] / 64));
+    }
+    const uint64_t interval_ms = now_ms > recorder->last_ms ? now_ms - recorder->last_ms : 0;
+    size_t length = varint_put(frame, zigzag_encode((int64_t)interval_ms - (int64_t)recorder->interval_ms));
+    frame[length++] = blocks;
+    for (int block = 0; block < RECORDER_BLOCKS; block++)
+        if (groups[block])
+            frame[length++] = groups[block];
+    for (int group = 0; group < RECORDER_GROUPS; group++)
+        if (bitmaps[group])
+            frame[length++] = bitmaps[group];
+    for (int i = 0; i < count; i++) {
+        length += varint_put(frame + length, zigzag_encode(values[i] - recorder->recorded[handles[i]]));
+        recorder->recorded[handles[i]] = (int16_t)values[i];
+    }
+    recorder->last_ms += interval_ms;
+    recorder->interval_ms = interval_ms;
+    recorder->key_frame = false;
+    return recorder_write(recorder, frame, length);
+}
+
+static thermia_recorder_t *recorder_open(model_t model, const char *path, size_t rotate_bytes, int rotate_keep) {
+    thermia_recorder_t *recorder = calloc(1, sizeof(thermia_recorder_t));
+    if (recorder == NULL || (recorder->recorded = calloc((size_t)g_num_registers, sizeof(int16_t))) == NULL ||
+        (recorder->handles = calloc((size_t)g_num_registers, sizeof(thermia_modbus_handle_t))) == NULL ||
+        (recorder->values = calloc((size_t)g_num_registers, sizeof(int))) == NULL) {
+        fprintf(stderr, "recorder: initialisation failed: %s\n", strerror(errno));
+        thermia_recorder_close(recorder);
+        return NULL;
+    }
+    recorder->model = model;
+    snprintf(recorder->path, sizeof(recorder->path), "%s", path);
+    recorder->rotate_bytes = rotate_bytes;
+    recorder->rotate_keep = rotate_keep < 1 ? 1 : rotate_keep;
+    recorder->fd = -1;
+    if (!recorder_rotate(recorder, time_now_epoch_ms())) { // an existing recording is kept as path.1
+        thermia_recorder_close(recorder);
+        return NULL;
+    }
+    return recorder;
+}
+
+thermia_recorder_t *thermia_recorder_open(thermia_modbus_t *ctx, const char *path, size_t rotate_bytes, int rotate_keep) {
+    thermia_recorder_t *recorder = recorder_open(ctx->model, path, rotate_bytes, rotate_keep);
+    if (recorder != NULL)
+        recorder->ctx = ctx;
+    return recorder;
+}
+
+void thermia_recorder_close(thermia_recorder_t *recorder) {
+    if (recorder != NULL) {
+        if (recorder->fd != -1)
+            close(recorder->fd);
+        free(recorder->recorded);
+        free(recorder->handles);
+        free(recorder->values);
+        free(recorder);
+    }
+}
+
+bool thermia_recorder_record(thermia_recorder_t *recorder) {
+    const uint64_t now_ms = time_now_epoch_ms();
+    if (recorder->rotate_bytes > 0 && recorder->size >= recorder->rotate_bytes && !recorder->key_frame && !recorder_rotate(recorder, now_ms))
+        return false;
+    thermia_modbus_t *ctx = recorder->ctx;
+    int count = 0;
+    if (recorder->key_frame) {
+        pthread_mutex_lock(&ctx->cache_lock);
+        for (int i = 0; i < g_num_registers; i++)
+            if (ctx->cache[i].valid) {
+                recorder->handles[count] = i;
+                recorder->values[count++] = ctx->cache[i].value;
+            }
+        recorder->cursor = ctx->cache_sequence;
+        pthread_mutex_unlock(&ctx->cache_lock);
+    } else {
+        count = thermia_modbus_cache_changed(ctx, &recorder->cursor, recorder->handles, g_num_registers);
+        for (int i = 0; i < count; i++)
+            thermia_modbus_cache_get(ctx, recorder->handles[i], &recorder->values[i], NULL);
+    }
+    return recorder_frame(recorder, now_ms, recorder->handles, recorder->values, count);
+}
+
+thermia_replay_t *thermia_replay_open(const char *path) {
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    struct stat st;
+    if (fd == -1 || fstat(fd, &st) == -1) {
+        fprintf(stderr, "replay: open '%s' failed: %s\n", path, strerror(errno));
+        if (fd != -1)
+            close(fd);
+        return NULL;
+    }
+    if (st.st_size < RECORDER_HEADER_SIZE) {
+        fprintf(stderr, "replay: open '%s' failed: not a recording\n", path);
+        close(fd);
+        return NULL;
+    }
+    uint8_t *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        fprintf(stderr, "replay: open '%s' failed: %s\n", path, strerror(errno));
+        return NULL;
+    }
+    const uint32_t count = recorder_get_u32(data + 8);
+    if (memcmp(data, RECORDER_MAGIC, 8) != 0 || count != (uint32_t)g_num_registers) {
+        fprintf(stderr, "replay: open '%s' failed: %s\n", path, memcmp(data, RECORDER_MAGIC, 8) != 0 ? "not a recording" : "register table does not match");
+        munmap(data, (size_t)st.st_size);
+        return NULL;
+    }
+    madvise(data, (size_t)st.st_size, MADV_SEQUENTIAL);
+    thermia_replay_t *replay = calloc(1, sizeof(thermia_replay_t));
+    if (replay == NULL || (replay->values = calloc(count, sizeof(int16_t))) == NULL || (replay->valid = calloc(count, sizeof(bool))) == NULL ||
+        (replay->frame_handles = calloc(count, sizeof(thermia_modbus_handle_t))) == NULL || (replay->frame_deltas = calloc(count, sizeof(int32_t))) == NULL) {
+        fprintf(stderr, "replay: initialisation failed: %s\n", strerror(errno));
+        munmap(data, (size_t)st.st_size);
+        thermia_replay_close(replay);
+        return NULL;
+    }
+    replay->data = data;
+    replay->size = (size_t)st.st_size;
+    replay->offset = RECORDER_HEADER_SIZE;
+    replay->model = (model_t)recorder_get_u32(data + 12);
+    replay->time_ms = recorder_get_u64(data + 16);
+    return replay;
+}
+
+void thermia_replay_close(thermia_replay_t *replay) {
+    if (replay != NULL) {
+        if (replay->data != NULL)
+            munmap(replay->data, replay->size);
+        free(replay->values);
+        free(replay->valid);
+        free(replay->frame_handles);
+        free(replay->frame_deltas);
+        free(replay);
+    }
+}
+
+model_t thermia_replay_model(const thermia_replay_t *replay) { return replay->model; }
+
+int thermia_replay_next(thermia_replay_t *replay, uint64_t *time_ms, thermia_modbus_handle_t *changed, int changed_max) {
+    const uint8_t *data = replay->data;
+    size_t offset = replay->offset;
+    uint64_t interval_change, value_delta;
+    if (!varint_get(data, replay->size, &offset, &interval_change) || offset >= replay->size)
+        return -1;
+    const uint8_t blocks = data[offset++];
+    const uint8_t *groups = data + offset;
+    offset += (size_t)__builtin_popcount(blocks);
+    if (offset > replay->size)
+        return -1;
+    int groups_count = 0;
+    for (int i = 0; i < __builtin_popcount(blocks); i++)
+        groups_count += __builtin_popcount(groups[i]);
+    const uint8_t *bitmaps = data + offset;
+    offset += (size_t)groups_count;
+    if (offset > replay->size)
+        return -1;
+    int count = 0;
+    for (unsigned block_bits = blocks; block_bits != 0; block_bits &= block_bits - 1)
+        for (unsigned group_bits = *groups++; group_bits != 0; group_bits &= group_bits - 1)
+            for (unsigned bits = *bitmaps++; bits != 0; bits &= bits - 1) {
+                const int handle = (__builtin_ctz(block_bits) * 8 + __builtin_ctz(group_bits)) * 8 + __builtin_ctz(bits);
+                if (handle >= g_num_registers || !varint_get(data, replay->size, &offset, &value_delta))
+                    return -1;
+                replay->frame_handles[count] = handle;
+                replay->frame_deltas[count++] = (int32_t)zigzag_decode(value_delta);
+            }
+    for (int i = 0; i < count; i++) {
+        const thermia_modbus_handle_t handle = replay->frame_handles[i];
+        replay->values[handle] = (int16_t)(replay->values[handle] + replay->frame_deltas[i]);
+        replay->valid[handle] = true;
+        if (changed != NULL && i < changed_max)
+            changed[i] = handle;
+    }
+    replay->offset = offset;
+    replay->interval_ms = (uint64_t)((int64_t)replay->interval_ms + zigzag_decode(interval_change));
+    replay->time_ms += replay->interval_ms;
+    if (time_ms != NULL)
+        *time_ms = replay->time_ms;
+    return count;
+}
+
+bool thermia_replay_get(const thermia_replay_t *replay, thermia_modbus_handle_t handle, int *value) {
+    if (handle < 0 || handle >= g_num_registers || !replay->valid[handle])
+        return false;
+    *value = replay->values[handle];
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * MQTT: publishes the cache over one persistent broker connection (libmosquitto, with its network thread handling
+ * reconnects), built only with THERMIA_MQTT. Each register is addressed by its path 'system/subsystem/name'. On
+ * the first connection a retained '<prefix>/config' message describes every register the model supports; each publish
+ * then sends one '<prefix>/state' message holding just the values changed beyond their deadband since the previous
+ * one (scaled, as JSON keyed by path), or nothing if none changed. Every 'full_every' state messages carry all values,
+ * so with retain a late subscriber is never far from a complete picture. A state message the broker connection could
+ * not take is not lost: its changes go out with the next one.
+ */
+
+#ifdef THERMIA_MQTT
+
+#include <mosquitto.h>
+#include <stdarg.h>
+
+#define MQTT_PORT_DEFAULT 1883
+#define MQTT_KEEPALIVE_S 30
+#define MQTT_RECONNECT_MIN_S 1
+#define MQTT_RECONNECT_MAX_S 60
+
+typedef struct {
+    char *data;
+    size_t length, size;
+} mqtt_buffer_t;
+
+struct thermia_mqtt {
+    thermia_modbus_t *ctx;
+    struct mosquitto *mosquitto;
+    char host[256];
+    int port;
+    char prefix[128];
+    int qos;
+    bool retain;
+    int full_every, state_count;
+    bool started, configured;
+    _Atomic bool connected; // set by the network thread
+    uint32_t cursor;
+    thermia_modbus_handle_t *handles;
+    mqtt_buffer_t buffer;
+};
+
+static pthread_once_t g_mqtt_once = PTHREAD_ONCE_INIT;
+
+static void mqtt_init(void) { mosquitto_lib_init(); }
+
+static bool mqtt_append(mqtt_buffer_t *buffer, const char *format, ...) {
+    for (;;) {
+        va_list args;
+        va_start(args, format);
+        const int length = vsnprintf(buffer->data + buffer->length, buffer->size - buffer->length, format, args);
+        va_end(args);
+        if (length < 0)
+            return false;
+        if (buffer->length + (size_t)length < buffer->size) {
+            buffer->length += (size_t)length;
+            return true;
+        }
+        const size_t size = (buffer->length + (size_t)length + 1) * 2;
+        char *data = realloc(buffer->data, size);
+        if (data == NULL)
+            return false;
+        buffer->data = data;
+        buffer->size = size;
+    }
+}
+
+static bool mqtt_append_string(mqtt_buffer_t *buffer, const char *string) {
+    bool ok = mqtt_append(buffer, "\"");
+    for (; ok && *string; string++)
+        ok = *string == '"' || *string == '\\' ? mqtt_append(buffer, "\\%c", *string)
+             : (unsigned char)*string < 0x20  ? mqtt_append(buffer, "\\u%04x", *string)
+                                               : mqtt_append(buffer, "%c", *string);
+    return ok && mqtt_append(buffer, "\"");
+}
+
+static bool mqtt_append_path(mqtt_buffer_t *buffer, const register_def_t *reg) { return mqtt_append(buffer, "\"%s/%s/%s\":", register_system(reg), register_subsystem(reg), reg->name); }
+
+static void mqtt_on_connect(struct mosquitto *mosquitto, void *arg, int result) {
+    (void)mosquitto;
+    thermia_mqtt_t *mqtt = (thermia_mqtt_t *)arg;
+    if (result != 0) {
+        fprintf(stderr, "mqtt: connection to %s:%d refused: %s\n", mqtt->host, mqtt->port, mosquitto_connack_string(result));
+        return;
+    }
+    fprintf(stderr, "mqtt: connected to %s:%d\n", mqtt->host, mqtt->port);
+    mqtt->connected = true;
+}
+
+static void mqtt_on_disconnect(struct mosquitto *mosquitto, void *arg, int result) {
+    (void)mosquitto;
+    thermia_mqtt_t *mqtt = (thermia_mqtt_t *)arg;
+    if (mqtt->connected && result != 0)
+        fprintf(stderr, "mqtt: connection to %s:%d lost, reconnecting\n", mqtt->host, mqtt->port);
+    mqtt->connected = false;
+}
+
+static bool mqtt_send(thermia_mqtt_t *mqtt, const char *topic_suffix, bool retain) {
+    char topic[192];
+    snprintf(topic, sizeof(topic), "%s/%s", mqtt->prefix, topic_suffix);
+    const int result = mosquitto_publish(mqtt->mosquitto, NULL, topic, (int)mqtt->buffer.length, mqtt->buffer.data, mqtt->qos, retain);
+    if (result != MOSQ_ERR_SUCCESS && result != MOSQ_ERR_NO_CONN)
+        fprintf(stderr, "mqtt: publish '%s' failed: %s\n", topic, mosquitto_strerror(result));
+    return result == MOSQ_ERR_SUCCESS;
+}
+
+static bool mqtt_config(thermia_mqtt_t *mqtt) {
+    mqtt_buffer_t *buffer = &mqtt->buffer;
+    buffer->length = 0;
+    bool ok = mqtt_append(buffer, "{\"model\":\"%s\",\"state\":\"%s/state\",\"registers\":{", mqtt->ctx->model == MODEL_MEGA ? "mega" : "inverter", mqtt->prefix);
+    for (int position = 0; ok && position < mqtt->ctx->table->count; position++) {
+        const register_def_t *reg = &g_registers[mqtt->ctx->table->order[position]];
+        ok = mqtt_append(buffer, "%s", position ? "," : "") && mqtt_append_path(buffer, reg) && mqtt_append(buffer, "{\"description\":") &&
+             mqtt_append_string(buffer, register_description(reg)) &&
+             mqtt_append(buffer, ",\"scale\":%d,\"bit\":%s,\"writable\":%s}", reg->scale, is_register_type_bit(reg->type) ? "true" : "false",
+                         reg->type == REG_COIL_STATUS || reg->type == REG_HOLDING ? "true" : "false");
+    }
+    return ok && mqtt_append(buffer, "}}") && mqtt_send(mqtt, "config", true);
+}
+
+thermia_mqtt_t *thermia_mqtt_open(thermia_modbus_t *ctx, const char *host, int port, const char *prefix) {
+    pthread_once(&g_mqtt_once, mqtt_init);
+    thermia_mqtt_t *mqtt = calloc(1, sizeof(thermia_mqtt_t));
+    if (mqtt == NULL || (mqtt->handles = calloc((size_t)g_num_registers, sizeof(thermia_modbus_handle_t))) == NULL ||
+        (mqtt->mosquitto = mosquitto_new(NULL, true, mqtt)) == NULL) {
+        fprintf(stderr, "mqtt: initialisation failed: %s\n", strerror(errno));
+        if (mqtt != NULL)
+            free(mqtt->handles);
+        free(mqtt);
+        return NULL;
+    }
+    mqtt->ctx = ctx;
+    snprintf(mqtt->host, sizeof(mqtt->host), "%s", host);
+    mqtt->port = port > 0 ? port : MQTT_PORT_DEFAULT;
+    snprintf(mqtt->prefix, sizeof(mqtt->prefix), "%s", prefix != NULL ? prefix : "thermia");
+    mosquitto_connect_callback_set(mqtt->mosquitto, mqtt_on_connect);
+    mosquitto_disconnect_callback_set(mqtt->mosquitto, mqtt_on_disconnect);
+    mosquitto_reconnect_delay_set(mqtt->mosquitto, MQTT_RECONNECT_MIN_S, MQTT_RECONNECT_MAX_S, true);
+    return mqtt;
+}
+
+void thermia_mqtt_close(thermia_mqtt_t *mqtt) {
+    if (mqtt != NULL) {
+        if (mqtt->started) {
+            mosquitto_disconnect(mqtt->mosquitto);
+            mosquitto_loop_stop(mqtt->mosquitto, false);
+        }
+        mosquitto_destroy(mqtt->mosquitto);
+        free(mqtt->handles);
+        free(mqtt->buffer.data);
+        free(mqtt);
+    }
+}
+
+bool thermia_mqtt_set_auth(thermia_mqtt_t *mqtt, const char *username, const char *password) {
+    const int result = mosquitto_username_pw_set(mqtt->mosquitto, username, password);
+    if (result != MOSQ_ERR_SUCCESS) {
+        fprintf(stderr, "mqtt: credentials invalid: %s\n", mosquitto_strerror(result));
+        return false;
+    }
+    return true;
+}
+
+bool thermia_mqtt_set_publish(thermia_mqtt_t *mqtt, int qos, bool retain, int full_every) {
+    if (qos < 0 || qos > 2 || full_every < 0) {
+        fprintf(stderr, "mqtt: publish options invalid: qos %d, full every %d\n", qos, full_every);
+        return false;
+    }
+    mqtt->qos = qos;
+    mqtt->retain = retain;
+    mqtt->full_every = full_every;
+    return true;
+}
+
+bool thermia_mqtt_publish(thermia_mqtt_t *mqtt) {
+    if (!mqtt->started) { // connect on first use, so options set after open apply
+        const int result = mosquitto_connect_async(mqtt->mosquitto, mqtt->host, mqtt->port, MQTT_KEEPALIVE_S);
+        if (result != MOSQ_ERR_SUCCESS && result != MOSQ_ERR_ERRNO) // an unreachable broker is retried by the network thread
+            fprintf(stderr, "mqtt: connection to %s:%d failed: %s\n", mqtt->host, mqtt->port, mosquitto_strerror(result));
+        if (mosquitto_loop_start(mqtt->mosquitto) != MOSQ_ERR_SUCCESS) {
+            fprintf(stderr, "mqtt: network thread failed to start\n");
+            return false;
+        }
+        mqtt->started = true;
+    }
+    if (!mqtt->connected)
+        return false;
+    if (!mqtt->configured && !(mqtt->configured = mqtt_config(mqtt)))
+        return false;
+
+    thermia_modbus_t *ctx = mqtt->ctx;
+    uint32_t cursor = mqtt->cursor;
+    const bool full = mqtt->state_count == 0 || (mqtt->full_every > 0 && mqtt->state_count % mqtt->full_every == 0);
+    int count = 0;
+    if (full) {
+        pthread_mutex_lock(&ctx->cache_lock);
+        for (int position = 0; position < ctx->table->count; position++)
+            if (ctx->cache[ctx->table->order[position]].valid)
+                mqtt->handles[count++] = ctx->table->order[position];
+        cursor = ctx->cache_sequence;
+        pthread_mutex_unlock(&ctx->cache_lock);
+    } else
+        count = thermia_modbus_cache_changed(ctx, &cursor, mqtt->handles, g_num_registers);
+    if (count == 0) {
+        mqtt->cursor = cursor;
+        return true;
+    }
+
+    mqtt_buffer_t *buffer = &mqtt->buffer;
+    buffer->length = 0;
+    bool ok = mqtt_append(buffer, "{\"time\":%llu,\"full\":%s,\"values\":{", (unsigned long long)time_now_epoch_ms(), full ? "true" : "false");
+    for (int i = 0, fields = 0; ok && i < count; i++) {
+        const register_def_t *reg = &g_registers[mqtt->handles[i]];
+        int value;
+        char formatted[32];
+        if (!thermia_modbus_cache_get(ctx, mqtt->handles[i], &value, NULL))
+            continue;
+        format_register_scaled(formatted, sizeof(formatted), reg, value);
+        ok = mqtt_append(buffer, "%s", fields++ ? "," : "") && mqtt_append_path(buffer, reg) && mqtt_append(buffer, "%s", formatted);
+    }
+    if (!ok || !mqtt_append(buffer, "}}")) {
+        fprintf(stderr, "mqtt: state message failed: %s\n", strerror(ENOMEM));
+        return false;
+    }
+    if (!mqtt_send(mqtt, "state", mqtt->retain))
+        return false; // cursor kept, the changes go out with the next message
+    mqtt->cursor = cursor;
+    mqtt->state_count++;
+    return true;
+}
+
+#else
+
+thermia_mqtt_t *thermia_mqtt_open(thermia_modbus_t *ctx, const char *host, int port, const char *prefix) {
+    (void)ctx;
+    (void)host;
+    (void)port;
+    (void)prefix;
+    fprintf(stderr, "mqtt: not supported (build with THERMIA_MQTT)\n");
+    return NULL;
+}
+
+void thermia_mqtt_close(thermia_mqtt_t *mqtt) { (void)mqtt; }
+
+bool thermia_mqtt_set_auth(thermia_mqtt_t *mqtt, const char *username, const char *password) {
+    (void)mqtt;
+    (void)username;
+    (void)password;
+    return false;
+}
+
+bool thermia_mqtt_set_publish(thermia_mqtt_t *mqtt, int qos, bool retain, int full_every) {
+    (void)mqtt;
+    (void)qos;
+    (void)retain;
+    (void)full_every;
+    return false;
+}
+
+bool thermia_mqtt_publish(thermia_mqtt_t *mqtt) {
+    (void)mqtt;
+    return false;
+}
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Exporter: serves the cache as Prometheus text exposition on 'GET /metrics', never reading the controller itself. The
+ * whole response is rendered once, one gauge per register the model supports (named thermia_<system>_<subsystem>_<name>
+ * in snake case, with the description as help), each value in a fixed width field. A scrape then only rewrites, in
+ * place, the fields of registers changed since the previous scrape (per the cache, so within their deadband values lag)
+ * and sends a copy of the buffer, so a slow client never holds back the refresh for the others. A client gets
+ * EXPORTER_CLIENT_TIMEOUT_MS from connecting to send its request and again to take the response, and is closed if it
+ * stalls, so idle connections cannot hold every slot. Registers not read yet show NaN. Single threaded like async:
+ * dispatch from one thread, waiting on the fd or letting dispatch wait; it returns the number of scrapes served.
+ */
+
+#define EXPORTER_CLIENTS_MAX 16
+#define EXPORTER_CLIENT_TIMEOUT_MS 10000
+#define EXPORTER_REQUEST_MAX 2048
+#define EXPORTER_VALUE_WIDTH 10 // a 16 bit value under a 16 bit scale (as the generator checks) prints in at most 7
+
+typedef struct {
+    int fd;
+    char request[EXPORTER_REQUEST_MAX];
+    size_t request_length;
+    char header[160];
+    size_t header_length;
+    const char *body;
+    size_t body_length, sent; // of header then body
+    bool sending;
+    char *metrics; // the response as it was when the scrape came in, kept for the slot's next clients
+    uint64_t deadline_ms;
+} exporter_client_t;
+
+struct thermia_exporter {
+    thermia_modbus_t *ctx;
+    int listen_fd, epoll_fd;
+    char *metrics;
+    size_t metrics_length;
+    size_t *value_offsets; // by handle, 0 if not exported
+    uint32_t cursor;
+    bool rendered;
+    exporter_client_t clients[EXPORTER_CLIENTS_MAX];
+};
+
+static size_t exporter_name(char *buffer, size_t size, const char *string) {
+    size_t length = 0;
+    for (const char *c = string; *c && length + 2 < size; c++) {
+        if (*c >= 'A' && *c <= 'Z') {
+            if (c != string && ((c[-1] >= 'a' && c[-1] <= 'z') || (c[-1] >= '0' && c[-1] <= '9')))
+                buffer[length++] = '_';
+            buffer[length++] = (char)(*c - 'A' + 'a');
+        } else
+            buffer[length++] = (*c >= 'a' && *c <= 'z') || (*c >= '0' && *c <= '9') ? *c : '_';
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+// two passes: measure (buffer NULL), then render and note where each value goes
+static size_t exporter_render(thermia_exporter_t *exporter, char *buffer, size_t size) {
+    const register_model_table_t *table = exporter->ctx->table;
+    size_t length = 0;
+    for (int position = 0; position < table->count; position++) {
+        const thermia_modbus_handle_t handle = table->order[position];
+        const register_def_t *reg = &g_registers[handle];
+        char name[256], system[64], subsystem[64];
+        exporter_name(system, sizeof(system), register_system(reg));
+        exporter_name(subsystem, sizeof(subsystem), register_subsystem(reg));
+        exporter_name(name, sizeof(name), reg->name);
+        length += (size_t)snprintf(buffer != NULL ? buffer + length : NULL, buffer != NULL ? size - length : 0,
+                                   "# HELP thermia_%s_%s_%s %s\n# TYPE thermia_%s_%s_%s gauge\nthermia_%s_%s_%s ", system, subsystem, name, register_description(reg),
+                                   system, subsystem, name, system, subsystem, name);
+        if (buffer != NULL) {
+            exporter->value_offsets[handle] = length;
+            snprintf(buffer + length, size - length, "%*s\n", EXPORTER_VALUE_WIDTH, "NaN");
+        }
+        length += EXPORTER_VALUE_WIDTH + 1;
+    }
+    return length;
+}
+
+static void exporter_value(thermia_exporter_t *exporter, thermia_modbus_handle_t handle, int value) {
+    char formatted[32];
+    int length = format_register_scaled(formatted, sizeof(formatted), &g_registers[handle], value);
+    if (length <= 0 || length > EXPORTER_VALUE_WIDTH) { // never served stale: unknown rather than the previous value
+        fprintf(stderr, "exporter: value %d of '%s' does not fit %d characters, exported as NaN\n", value, g_registers[handle].name, EXPORTER_VALUE_WIDTH);
+        length = snprintf(formatted, sizeof(formatted), "NaN");
+    }
+    char *field = exporter->metrics + exporter->value_offsets[handle];
+    memset(field, ' ', EXPORTER_VALUE_WIDTH - (size_t)length);
+    memcpy(field + EXPORTER_VALUE_WIDTH - length, formatted, (size_t)length);
+}
+
+static void exporter_refresh(thermia_exporter_t *exporter) {
+    thermia_modbus_t *ctx = exporter->ctx;
+    if (!exporter->rendered) { // first scrape: every value, from then on changes only
+        pthread_mutex_lock(&ctx->cache_lock);
+        for (int position = 0; position < ctx->table->count; position++) {
+            const thermia_modbus_handle_t handle = ctx->table->order[position];
+            if (ctx->cache[handle].valid)
+                exporter_value(exporter, handle, ctx->cache[handle].value);
+        }
+        exporter->cursor = ctx->cache_sequence;
+        pthread_mutex_unlock(&ctx->cache_lock);
+        exporter->rendered = true;
+        return;
+    }
+    thermia_modbus_handle_t handles[g_num_registers];
+    const int count = thermia_modbus_cache_changed(ctx, &exporter->cursor, handles, g_num_registers);
+    for (int i = 0; i < count; i++) {
+        int value;
+        if (exporter->value_offsets[handles[i]] != 0 && thermia_modbus_cache_get(ctx, handles[i], &value, NULL))
+            exporter_value(exporter, handles[i], value);
+    }
+}
+
+static void exporter_client_close(thermia_exporter_t *exporter, exporter_client_t *client) {
+    epoll_ctl(exporter->epoll_fd, EPOLL_CTL_DEL, client->fd, NULL);
+    close(client->fd);
+    client->fd = -1;
+}
+
+// returns false once the response is sent (or the client failed), the connection is then closed
+static bool exporter_client_send(exporter_client_t *client) {
+    while (client->sent < client->header_length + client->body_length) {
+        struct iovec iov[2];
+        int iov_count = 0;
+        if (client->sent < client->header_length)
+            iov[iov_count++] = (struct iovec){.iov_base = client->header + client->sent, .iov_len = client->header_length - client->sent};
+        const size_t body_sent = client->sent > client->header_length ? client->sent - client->header_length : 0;
+        iov[iov_count++] = (struct iovec){.iov_base = (void *)(client->body + body_sent), .iov_len = client->body_length - body_sent};
+        const ssize_t sent = writev(client->fd, iov, iov_count);
+        if (sent == -1 && errno == EINTR)
+            continue;
+        if (sent == -1)
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        client->sent += (size_t)sent;
+    }
+    return false;
+}
+
+static int exporter_client_service(thermia_exporter_t *exporter, exporter_client_t *client, uint32_t events) {
+    if (client->sending) {
+        if (!exporter_client_send(client))
+            exporter_client_close(exporter, client);
+        return 0;
+    }
+    if (events & (EPOLLERR | EPOLLHUP) && !(events & EPOLLIN)) {
+        exporter_client_close(exporter, client);
+        return 0;
+    }
+    const ssize_t received = recv(client->fd, client->request + client->request_length, sizeof(client->request) - 1 - client->request_length, 0);
+    if (received <= 0) {
+        if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+            exporter_client_close(exporter, client);
+        return 0;
+    }
+    client->request_length += (size_t)received;
+    client->request[client->request_length] = '\0';
+    if (strstr(client->request, "\r\n\r\n") == NULL) {
+        if (client->request_length == sizeof(client->request) - 1)
+            exporter_client_close(exporter, client);
+        return 0;
+    }
+
+    const bool metrics = strncmp(client->request, "GET /metrics ", 13) == 0 || strncmp(client->request, "GET /metrics?", 13) == 0;
+    if (metrics) {
+        if (client->metrics == NULL && (client->metrics = malloc(exporter->metrics_length)) == NULL) {
+            fprintf(stderr, "exporter: failed to allocate response: %s\n", strerror(errno));
+            exporter_client_close(exporter, client);
+            return 0;
+        }
+        exporter_refresh(exporter);
+        memcpy(client->metrics, exporter->metrics, exporter->metrics_length);
+        client->body = client->metrics;
+        client->body_length = exporter->metrics_length;
+    } else {
+        client->body = "not found\n";
+        client->body_length = strlen(client->body);
+    }
+    client->header_length = (size_t)snprintf(client->header, sizeof(client->header),
+                                             "HTTP/1.1 %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n",
+                                             metrics ? "200 OK" : "404 Not Found", metrics ? "text/plain; version=0.0.4" : "text/plain", client->body_length);
+    client->sent = 0;
+    client->sending = true;
+    client->deadline_ms = time_now_ms() + EXPORTER_CLIENT_TIMEOUT_MS;
+    struct epoll_event event = {.events = EPOLLOUT, .data.ptr = client};
+    epoll_ctl(exporter->epoll_fd, EPOLL_CTL_MOD, client->fd, &event);
+    if (!exporter_client_send(client))
+        exporter_client_close(exporter, client);
+    return metrics;
+}
+
+static void exporter_accept(thermia_exporter_t *exporter) {
+    for (;;) {
+        const int fd = accept(exporter->listen_fd, NULL, NULL);
+        if (fd == -1) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                fprintf(stderr, "exporter: accept failed: %s\n", strerror(errno));
+            return;
+        }
+        exporter_client_t *client = NULL;
+        for (int i = 0; i < EXPORTER_CLIENTS_MAX && client == NULL; i++)
+            if (exporter->clients[i].fd == -1)
+                client = &exporter->clients[i];
+        if (client == NULL || fcntl(fd, F_SETFL, O_NONBLOCK) == -1 || fcntl(fd, F_SETFD, FD_CLOEXEC) == -1) {
+            close(fd);
+            continue;
+        }
+        *client = (exporter_client_t){.fd = fd, .metrics = client->metrics, .deadline_ms = time_now_ms() + EXPORTER_CLIENT_TIMEOUT_MS};
+        struct epoll_event event = {.events = EPOLLIN, .data.ptr = client};
+        if (epoll_ctl(exporter->epoll_fd, EPOLL_CTL_ADD, fd, &event) == -1) {
+            close(fd);
+            client->fd = -1;
+        }
+    }
+}
+
+thermia_exporter_t *thermia_exporter_open(thermia_modbus_t *ctx, const char *address, int port) {
+    thermia_exporter_t *exporter = calloc(1, sizeof(thermia_exporter_t));
+    if (exporter == NULL || (exporter->value_offsets = calloc((size_t)g_num_registers, sizeof(size_t))) == NULL) {
+        fprintf(stderr, "exporter: initialisation failed: %s\n", strerror(errno));
+        free(exporter);
+        return NULL;
+    }
+    exporter->ctx = ctx;
+    exporter->listen_fd = exporter->epoll_fd = -1;
+    for (int i = 0; i < EXPORTER_CLIENTS_MAX; i++)
+        exporter->clients[i].fd = -1;
+    exporter->metrics_length = exporter_render(exporter, NULL, 0);
+    if ((exporter->metrics = malloc(exporter->metrics_length + 1)) == NULL) {
+        fprintf(stderr, "exporter: initialisation failed: %s\n", strerror(errno));
+        thermia_exporter_close(exporter);
+        return NULL;
+    }
+    exporter_render(exporter, exporter->metrics, exporter->metrics_length + 1);
+
+    char service[16];
+    snprintf(service, sizeof(service), "%d", port);
+    struct addrinfo hints = {.ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM, .ai_flags = AI_PASSIVE}, *addresses = NULL;
+    const int result = getaddrinfo(address, service, &hints, &addresses);
+    if (result != 0) {
+        fprintf(stderr, "exporter: address '%s' invalid: %s\n", address != NULL ? address : "*", gai_strerror(result));
+        thermia_exporter_close(exporter);
+        return NULL;
+    }
+    const int reuse = 1;
+    if ((exporter->listen_fd = socket(addresses->ai_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)) == -1 ||
+        setsockopt(exporter->listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) == -1 ||
+        bind(exporter->listen_fd, addresses->ai_addr, addresses->ai_addrlen) == -1 || listen(exporter->listen_fd, EXPORTER_CLIENTS_MAX) == -1 ||
+        (exporter->epoll_fd = epoll_create1(EPOLL_CLOEXEC)) == -1 ||
+        epoll_ctl(exporter->epoll_fd, EPOLL_CTL_ADD, exporter->listen_fd, &(struct epoll_event){.events = EPOLLIN, .data.ptr = NULL}) == -1) {
+        fprintf(stderr, "exporter: listen on port %d failed: %s\n", port, strerror(errno));
+        freeaddrinfo(addresses);
+        thermia_exporter_close(exporter);
+        return NULL;
+    }
+    freeaddrinfo(addresses);
+    return exporter;
+}
+
+void thermia_exporter_close(thermia_exporter_t *exporter) {
+    if (exporter != NULL) {
+        for (int i = 0; i < EXPORTER_CLIENTS_MAX; i++) {
+            if (exporter->clients[i].fd != -1)
+                close(exporter->clients[i].fd);
+            free(exporter->clients[i].metrics);
+        }
+        if (exporter->listen_fd != -1)
+            close(exporter->listen_fd);
+        if (exporter->epoll_fd != -1)
+            close(exporter->epoll_fd);
+        free(exporter->metrics);
+        free(exporter->value_offsets);
+        free(exporter);
+    }
+}
+
+int thermia_exporter_fd(const thermia_exporter_t *exporter) { return exporter->epoll_fd; }
+
+int thermia_exporter_dispatch(thermia_exporter_t *exporter, int timeout_ms) {
+    uint64_t now_ms = time_now_ms();
+    for (int i = 0; i < EXPORTER_CLIENTS_MAX; i++) {
+        const exporter_client_t *client = &exporter->clients[i];
+        if (client->fd != -1 && (timeout_ms < 0 || client->deadline_ms < now_ms + (uint64_t)timeout_ms))
+            timeout_ms = client->deadline_ms > now_ms ? (int)(client->deadline_ms - now_ms) : 0;
+    }
+    struct epoll_event events[EXPORTER_CLIENTS_MAX + 1];
+    const int count = epoll_wait(exporter->epoll_fd, events, EXPORTER_CLIENTS_MAX + 1, timeout_ms);
+    if (count == -1) {
+        if (errno == EINTR)
+            return 0;
+        fprintf(stderr, "exporter: wait failed: %s\n", strerror(errno));
+        return -1;
+    }
+    int served = 0;
+    for (int i = 0; i < count; i++) {
+        if (events[i].data.ptr == NULL)
+            exporter_accept(exporter);
+        else if (((exporter_client_t *)events[i].data.ptr)->fd != -1)
+            served += exporter_client_service(exporter, (exporter_client_t *)events[i].data.ptr, events[i].events);
+    }
+    now_ms = time_now_ms();
+    for (int i = 0; i < EXPORTER_CLIENTS_MAX; i++)
+        if (exporter->clients[i].fd != -1 && exporter->clients[i].deadline_ms <= now_ms)
+            exporter_client_close(exporter, &exporter->clients[i]); // stalled: request or response not through in time
+    return served;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+#if defined(TEST) || defined(MOCK) || defined(BENCH)
+
+static bool parse_model(const char *model_str, model_t *model) {
+    if (strcmp(model_str, "mega") == 0)
+        *model = MODEL_MEGA;
+    else if (strcmp(model_str, "inverter") == 0)
+        *model = MODEL_INVERTER;
+    else {
+        fprintf(stderr, "model unknown, must be 'mega' or 'inverter': %s\n", model_str);
+        return false;
+    }
+    return true;
+}
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+#ifdef TEST
+
+#include <poll.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <sys/un.h>
+
+static int format_register(char *buffer, size_t size, const register_def_t *reg, int value, const char *operation) {
+    if (is_register_type_bit(reg->type))
+        return snprintf(buffer, size, "%s = %d (%s)", reg->name, value ? 1 : 0, operation);
+    else if (reg->scale > 1)
+        return snprintf(buffer, size, "%s = %.2f (%s) (raw = %d)", reg->name, (double)value / reg->scale, operation, value);
+    else
+        return snprintf(buffer, size, "%s = %d (%s)", reg->name, value, operation);
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Output: results as text for people, or one sample per line as JSON Lines or CSV for scripts and log shippers. Lines
+ * are gathered in one buffer, kept between flushes, and written with as few write calls as the pipe allows.
+ */
+
+typedef enum { OUTPUT_TEXT, OUTPUT_JSONL, OUTPUT_CSV } output_format_t;
+
+typedef struct {
+    output_format_t format;
+    bool header_written;
+    char *data;
+    size_t length, size;
+} output_t;
+
+static output_t g_output = {.format = OUTPUT_TEXT};
+
+static bool parse_output_format(const char *format_str, output_format_t *format) {
+    if (strcmp(format_str, "text") == 0)
+        *format = OUTPUT_TEXT;
+    else if (strcmp(format_str, "jsonl") == 0)
+        *format = OUTPUT_JSONL;
+    else if (strcmp(format_str, "csv") == 0)
+        *format = OUTPUT_CSV;
+    else {
+        fprintf(stderr, "format unknown, must be 'text', 'jsonl' or 'csv': %s\n", format_str);
+        return false;
+    }
+    return true;
+}
+
+static bool output_append(output_t *output, const char *format, ...) {
+    for (;;) {
+        va_list args;
+        va_start(args, format);
+        const int length = vsnprintf(output->data + output->length, output->size - output->length, format, args);
+        va_end(args);
+        if (length < 0)
+            return false;
+        if (output->length + (size_t)length < output->size) {
+            output->length += (size_t)length;
+            return true;
+        }
+        const size_t size = output->size * 2 > output->length + (size_t)length + 1 ? output->size * 2 : output->length + (size_t)length + 4096;
+        char *data = realloc(output->data, size);
+        if (data == NULL) {
+            fprintf(stderr, "output: failed to allocate\n");
+            return false;
+        }
+        output->data = data;
+        output->size = size;
+    }
+}
+
+// one sample: time (epoch ms), name, unit metadata, raw and scaled value
+static bool output_sample(output_t *output, thermia_modbus_handle_t handle, int value, double scaled, uint64_t time_ms, const char *operation) {
+    const register_def_t *reg = &g_registers[handle];
+    char formatted[32];
+    format_value(formatted, sizeof(formatted), handle, scaled);
+    switch (output->format) {
+    case OUTPUT_JSONL:
+        return output_append(output, "{\"time\":%llu,\"name\":\"%s\",\"system\":\"%s\",\"subsystem\":\"%s\",\"raw\":%d,\"value\":%s}\n", (unsigned long long)time_ms,
+                             reg->name, register_system(reg), register_subsystem(reg), value, formatted);
+    case OUTPUT_CSV:
+        if (!output->header_written && !output_append(output, "time,name,system,subsystem,raw,value\n"))
+            return false;
+        output->header_written = true;
+        return output_append(output, "%llu,%s,%s,%s,%d,%s\n", (unsigned long long)time_ms, reg->name, register_system(reg), register_subsystem(reg), value, formatted);
+    default: {
+        char buffer[256];
+        format_register(buffer, sizeof(buffer), reg, value, operation);
+        return output_append(output, "%s\n", buffer);
+    }
+    }
+}
+
+static bool output_flush(output_t *output) {
+    size_t written = 0;
+    while (written < output->length) {
+        const ssize_t rc = write(STDOUT_FILENO, output->data + written, output->length - written);
+        if (rc == -1 && errno == EINTR)
+            continue;
+        if (rc == -1) {
+            fprintf(stderr, "output: failed to write: %s\n", strerror(errno));
+            output->length = 0;
+            return false;
+        }
+        written += (size_t)rc;
+    }
+    output->length = 0;
+    return true;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Dump: one block read pass over every register the model supports, printed as a single record, either a JSON object
+ * or a CSV header line and value line (registers that failed to read are null / empty), or without a record format as
+ * one sample per register in the output format
+ */
+
+static int dump_run(thermia_modbus_t *ctx, const char *format) {
+    const bool csv = format != NULL && strcmp(format, "csv") == 0;
+    if (format != NULL && !csv && strcmp(format, "json") != 0) {
+        fprintf(stderr, "dump: format unknown, must be 'json' or 'csv': %s\n", format);
+        return EXIT_FAILURE;
+    }
+    int values[g_num_registers];
+    bool valid[g_num_registers];
+    double scaled[g_num_registers];
+    thermia_modbus_read_all(ctx, values, valid);
+    thermia_modbus_scale_values(values, valid, scaled);
+    if (format == NULL) {
+        const uint64_t time_ms = time_now_epoch_ms();
+        for (int i = 0; i < g_num_registers; i++)
+            if (valid[i] && !output_sample(&g_output, i, values[i], scaled[i], time_ms, "dump"))
+                return EXIT_FAILURE;
+        return output_flush(&g_output) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    size_t size = 64;
+    for (int i = 0; i < g_num_registers; i++)
+        size += strlen(g_registers[i].name) + 32;
+    char *output = malloc(size), value[32];
+    if (output == NULL) {
+        fprintf(stderr, "dump: failed to allocate output\n");
+        return EXIT_FAILURE;
+    }
+    size_t length = 0;
+    if (csv) {
+        for (int i = 0, fields = 0; i < g_num_registers; i++)
+            if (is_register_supported(ctx, &g_registers[i]))
+                length += (size_t)snprintf(output + length, size - length, "%s%s", fields++ ? "," : "", g_registers[i].name);
+        length += (size_t)snprintf(output + length, size - length, "\n");
+        for (int i = 0, fields = 0; i < g_num_registers; i++)
+            if (is_register_supported(ctx, &g_registers[i])) {
+                if (!isnan(scaled[i]))
+                    format_value(value, sizeof(value), i, scaled[i]);
+                length += (size_t)snprintf(output + length, size - length, "%s%s", fields++ ? "," : "", !isnan(scaled[i]) ? value : "");
+            }
+    } else {
+        length += (size_t)snprintf(output + length, size - length, "{");
+        for (int i = 0, fields = 0; i < g_num_registers; i++)
+            if (is_register_supported(ctx, &g_registers[i])) {
+                if (!isnan(scaled[i]))
+                    format_value(value, sizeof(value), i, scaled[i]);
+                length += (size_t)snprintf(output + length, size - length, "%s\"%s\":%s", fields++ ? "," : "", g_registers[i].name, !isnan(scaled[i]) ? value : "null");
+            }
+        length += (size_t)snprintf(output + length, size - length, "}");
+    }
+    length += (size_t)snprintf(output + length, size - length, "\n");
+    fwrite(output, 1, length, stdout);
+    free(output);
+    return EXIT_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+// Group: the registers of one or more system/subsystem groups, read by their generated block plan, one sample each
+
+static int group_run(thermia_modbus_t *ctx, const char *pattern) {
+    const int count = thermia_modbus_resolve_group(ctx, pattern, NULL, 0);
+    if (count < 0)
+        return EXIT_FAILURE;
+    thermia_modbus_handle_t handles[count > 0 ? count : 1];
+    int values[count > 0 ? count : 1];
+    bool valid[count > 0 ? count : 1];
+    if (thermia_modbus_read_group(ctx, pattern, handles, values, valid, count) < 0)
+        return EXIT_FAILURE;
+    const uint64_t time_ms = time_now_epoch_ms();
+    for (int i = 0; i < count; i++)
+        if (valid[i] && !output_sample(&g_output, handles[i], values[i], register_value(handles[i], values[i]), time_ms, "group"))
+            return EXIT_FAILURE;
+    return output_flush(&g_output) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+static int format_stats(char *buffer, size_t size, const thermia_modbus_stats_t *stats) {
+    return snprintf(buffer, size,
+                    "%s count=%llu errors=%llu timeouts=%llu retries=%llu bytes_sent=%llu bytes_received=%llu p50_us=%u p90_us=%u p99_us=%u max_us=%u",
+                    stats->function_name, (unsigned long long)stats->count, (unsigned long long)stats->errors, (unsigned long long)stats->timeouts,
+                    (unsigned long long)stats->retries, (unsigned long long)stats->bytes_sent, (unsigned long long)stats->bytes_received, stats->latency_p50_us,
+                    stats->latency_p90_us, stats->latency_p99_us, stats->latency_max_us);
+}
+
+/*
+ * Stats: read every register 'rounds' times, then print the transaction stats (built with THERMIA_STATS)
+ */
+
+static int stats_run(thermia_modbus_t *ctx, int rounds) {
+    int values[g_num_registers];
+    bool valid[g_num_registers];
+    for (int round = 0; round < rounds; round++)
+        thermia_modbus_read_all(ctx, values, valid);
+    thermia_modbus_stats_t stats[16];
+    const int stats_count = thermia_modbus_stats(ctx, stats, 16);
+    if (stats_count == 0)
+        fprintf(stderr, "stats: none recorded (build with THERMIA_STATS)\n");
+    for (int i = 0; i < stats_count; i++) {
+        char buffer[512];
+        format_stats(buffer, sizeof(buffer), &stats[i]);
+        printf("%s\n", buffer);
+    }
+    return EXIT_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Publish and record: poll every register each interval (on an absolute cadence) until interrupted, then publish the
+ * cache to a shared memory segment for local readers (see thermia_shm_open; removed on exit), append a frame to a
+ * rotating recording (see thermia_replay_open), publish changes to an MQTT broker (credentials, if any, from
+ * THERMIA_MQTT_USERNAME and THERMIA_MQTT_PASSWORD; every value is sent every MQTT_FULL_EVERY messages) or serve
+ * Prometheus scrapes in between polls.
+ */
+
+#define RECORD_ROTATE_KEEP 8
+#define MQTT_FULL_EVERY 60
+
+typedef struct {
+    thermia_shm_t *shm;
+    thermia_recorder_t *recorder;
+    thermia_mqtt_t *mqtt;
+    thermia_exporter_t *exporter;
+} poll_stages_t;
+
+static volatile sig_atomic_t g_poll_running = 1;
+
+static void poll_signal(int signum) {
+    (void)signum;
+    g_poll_running = 0;
+}
+
+static void timespec_add_ms(struct timespec *ts, int ms) {
+    ts->tv_nsec += (long)(ms % 1000) * 1000000;
+    ts->tv_sec += ms / 1000 + ts->tv_nsec / 1000000000;
+    ts->tv_nsec %= 1000000000;
+}
+
+static int poll_run(thermia_modbus_t *ctx, int interval_ms, const poll_stages_t *stages) {
+    signal(SIGINT, poll_signal);
+    signal(SIGTERM, poll_signal);
+    int values[g_num_registers];
+    bool valid[g_num_registers];
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    while (g_poll_running) {
+        thermia_modbus_read_all(ctx, values, valid);
+        if (stages->shm != NULL)
+            thermia_shm_publish(stages->shm);
+        if (stages->recorder != NULL && !thermia_recorder_record(stages->recorder))
+            return EXIT_FAILURE;
+        if (stages->mqtt != NULL)
+            thermia_mqtt_publish(stages->mqtt);
+        timespec_add_ms(&next, interval_ms);
+        const uint64_t next_ms = (uint64_t)next.tv_sec * 1000 + (uint64_t)next.tv_nsec / 1000000;
+        if (stages->exporter != NULL) {
+            for (uint64_t now_ms; g_poll_running && (now_ms = time_now_ms()) < next_ms;)
+                if (thermia_exporter_dispatch(stages->exporter, (int)(next_ms - now_ms)) < 0)
+                    return EXIT_FAILURE;
+        } else
+            while (g_poll_running && clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+                ;
+    }
+    return EXIT_SUCCESS;
+}
+
+static int publish_run(thermia_modbus_t *ctx, const char *name, int interval_ms) {
+    if (interval_ms <= 0) {
+        fprintf(stderr, "shm: interval invalid: %d\n", interval_ms);
+        return EXIT_FAILURE;
+    }
+    thermia_shm_t *shm = thermia_shm_create(ctx, name);
+    if (shm == NULL)
+        return EXIT_FAILURE;
+    printf("shm: publishing to '%s' every %d ms\n", name, interval_ms);
+    const int result = poll_run(ctx, interval_ms, &(poll_stages_t){.shm = shm});
+    thermia_shm_close(shm);
+    return result;
+}
+
+static int record_run(thermia_modbus_t *ctx, const char *path, int interval_ms, int rotate_mb) {
+    if (interval_ms <= 0 || rotate_mb < 0) {
+        fprintf(stderr, "recorder: %s invalid: %d\n", interval_ms <= 0 ? "interval" : "rotate size", interval_ms <= 0 ? interval_ms : rotate_mb);
+        return EXIT_FAILURE;
+    }
+    thermia_recorder_t *recorder = thermia_recorder_open(ctx, path, (size_t)rotate_mb * 1024 * 1024, RECORD_ROTATE_KEEP);
+    if (recorder == NULL)
+        return EXIT_FAILURE;
+    printf("recorder: recording to '%s' every %d ms\n", path, interval_ms);
+    const int result = poll_run(ctx, interval_ms, &(poll_stages_t){.recorder = recorder});
+    thermia_recorder_close(recorder);
+    return result;
+}
+
+static int mqtt_run(thermia_modbus_t *ctx, const char *broker, int interval_ms, const char *prefix, int qos, bool retain) {
+    if (interval_ms <= 0) {
+        fprintf(stderr, "mqtt: interval invalid: %d\n", interval_ms);
+        return EXIT_FAILURE;
+    }
+    char host[256];
+    snprintf(host, sizeof(host), "%s", broker);
+    char *port = strrchr(host, ':');
+    if (port != NULL)
+        *port++ = '\0';
+    thermia_mqtt_t *mqtt = thermia_mqtt_open(ctx, host, port != NULL ? atoi(port) : 0, prefix);
+    if (mqtt == NULL)
+        return EXIT_FAILURE;
+    if (!thermia_mqtt_set_publish(mqtt, qos, retain, MQTT_FULL_EVERY) ||
+        (getenv("THERMIA_MQTT_USERNAME") != NULL && !thermia_mqtt_set_auth(mqtt, getenv("THERMIA_MQTT_USERNAME"), getenv("THERMIA_MQTT_PASSWORD")))) {
+        thermia_mqtt_close(mqtt);
+        return EXIT_FAILURE;
+    }
+    printf("mqtt: publishing to %s every %d ms\n", broker, interval_ms);
+    const int result = poll_run(ctx, interval_ms, &(poll_stages_t){.mqtt = mqtt});
+    thermia_mqtt_close(mqtt);
+    return result;
+}
+
+static int exporter_run(thermia_modbus_t *ctx, int port, int interval_ms) {
+    if (interval_ms <= 0) {
+        fprintf(stderr, "exporter: interval invalid: %d\n", interval_ms);
+        return EXIT_FAILURE;
+    }
+    thermia_exporter_t *exporter = thermia_exporter_open(ctx, NULL, port);
+    if (exporter == NULL)
+        return EXIT_FAILURE;
+    printf("exporter: serving http://*:%d/metrics, polling every %d ms\n", port, interval_ms);
+    const int result = poll_run(ctx, interval_ms, &(poll_stages_t){.exporter = exporter});
+    thermia_exporter_close(exporter);
+    return result;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Watch: read the given registers every interval in coalesced block reads, on absolute deadlines so the rate does not
+ * drift with read time, and stream each round as samples in the output format until interrupted. A round that overruns
+ * its deadline is not made up: the deadlines it passed count as missed and sampling resumes at the next one. On exit
+ * the achieved rate and missed deadlines go to stderr.
+ */
+
+static int watch_run(thermia_modbus_t *ctx, int interval_ms, char *const *names, int count) {
+    if (interval_ms <= 0) {
+        fprintf(stderr, "watch: interval invalid: %d\n", interval_ms);
+        return EXIT_FAILURE;
+    }
+    thermia_modbus_handle_t handles[count];
+    int values[count];
+    bool valid[count];
+    for (int i = 0; i < count; i++)
+        if (!thermia_modbus_resolve_register(ctx, names[i], &handles[i]))
+            return EXIT_FAILURE;
+
+    signal(SIGINT, poll_signal);
+    signal(SIGTERM, poll_signal);
+    uint64_t rounds = 0, samples = 0, missed = 0;
+    struct timespec next, now;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    const uint64_t start_us = time_now_us();
+    uint64_t round_us = start_us;
+    int result = EXIT_SUCCESS;
+    while (g_poll_running) {
+        round_us = time_now_us();
+        thermia_modbus_read_handles(ctx, handles, count, values, valid);
+        const uint64_t time_ms = time_now_epoch_ms();
+        for (int i = 0; i < count; i++)
+            if (valid[i] && !output_sample(&g_output, handles[i], values[i], register_value(handles[i], values[i]), time_ms, "watch"))
+                result = EXIT_FAILURE;
+        if (result != EXIT_SUCCESS || !output_flush(&g_output)) {
+            result = EXIT_FAILURE;
+            break;
+        }
+        rounds++;
+        for (int i = 0; i < count; i++)
+            samples += valid[i];
+
+        timespec_add_ms(&next, interval_ms);
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        while (now.tv_sec > next.tv_sec || (now.tv_sec == next.tv_sec && now.tv_nsec >= next.tv_nsec)) {
+            timespec_add_ms(&next, interval_ms);
+            missed++;
+        }
+        while (g_poll_running && clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+            ;
+    }
+    // the rate over the intervals between the first and last round
+    const double elapsed_s = (double)(round_us - start_us) / 1e6;
+    fprintf(stderr, "watch: %llu rounds (%llu samples) in %.1f s, %.2f Hz achieved of %.2f Hz, %llu deadlines missed\n", (unsigned long long)rounds,
+            (unsigned long long)samples, elapsed_s, elapsed_s > 0 ? (double)(rounds - 1) / elapsed_s : 0.0, 1000.0 / interval_ms, (unsigned long long)missed);
+    return result;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Alarms: polls every alarm bit the model supports and reports each one as it is raised or cleared, as a sample in
+ * the output format, from poller triggers evaluated as values arrive. Alarms already raised are reported at start.
+ */
+
+static void alarms_event(void *arg, thermia_modbus_handle_t handle, double value) {
+    if (!output_sample(&g_output, handle, (int)value, value, time_now_epoch_ms(), (const char *)arg) || !output_flush(&g_output))
+        g_poll_running = 0;
+}
+
+static int alarms_run(thermia_modbus_t *ctx, int interval_ms) {
+    if (interval_ms <= 0) {
+        fprintf(stderr, "alarms: interval invalid: %d\n", interval_ms);
+        return EXIT_FAILURE;
+    }
+    thermia_poller_t *poller = thermia_poller_create(ctx, NULL, NULL);
+    if (poller == NULL)
+        return EXIT_FAILURE;
+    int count = 0;
+    for (int i = 0; i < g_num_registers; i++) {
+        const register_def_t *reg = &g_registers[i];
+        if (reg->type != REG_INPUT_STATUS || strncmp(reg->name, "alarm", 5) != 0 || !is_register_supported(ctx, reg))
+            continue;
+        if (!thermia_poller_add(poller, reg->name, interval_ms) ||
+            !thermia_poller_add_trigger(poller, reg->name, THERMIA_TRIGGER_RISING, 0, 0, alarms_event, (void *)"alarm raised") ||
+            !thermia_poller_add_trigger(poller, reg->name, THERMIA_TRIGGER_FALLING, 0, 0, alarms_event, (void *)"alarm cleared")) {
+            thermia_poller_destroy(poller);
+            return EXIT_FAILURE;
+        }
+        count++;
+    }
+    fprintf(stderr, "alarms: watching %d alarms every %d ms\n", count, interval_ms);
+
+    signal(SIGINT, poll_signal);
+    signal(SIGTERM, poll_signal);
+    while (g_poll_running) {
+        const int next_ms = thermia_poller_next_ms(poller);
+        if (next_ms > 0)
+            nanosleep(&(struct timespec){.tv_sec = next_ms / 1000, .tv_nsec = (long)(next_ms % 1000) * 1000000}, NULL); // cut short by a signal
+        else
+            thermia_poller_tick(poller);
+    }
+    thermia_poller_destroy(poller);
+    return EXIT_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Daemon: keeps one connection open and serves a line protocol on a UNIX socket, so callers avoid a TCP connect and
+ * libmodbus setup per request, e.g. 'echo "read valueHeatpumpBrineInTemperature" | socat - UNIX-CONNECT:/run/thermia.sock'
+ *
+ *   read <register_name> [<register_name> ...]   -> one '<name> = <value> (read)' line per register
+ *   write <register_name> <value> [...]         -> one '<name> = <value> (write)' line per register
+ *   stats                                        -> one '<function> count=<n> ...' line per Modbus function used
+ *
+ * Each response ends with 'ok' or 'error <reason>'. Failed Modbus requests are retried on a fresh connection by the
+ * context's request policy, which fails fast while the controller is unavailable. With a maximum age, reads are served
+ * from the cache when fresh enough, shielding the controller from bursty clients.
+ */
+
+#define DAEMON_CLIENTS_MAX 16
+#define DAEMON_LINE_MAX 8192
+#define DAEMON_READS_MAX 512
+
+typedef struct {
+    int fd;
+    char line[DAEMON_LINE_MAX];
+    size_t length;
+} daemon_client_t;
+
+typedef struct {
+    char data[DAEMON_READS_MAX * 128];
+    size_t length;
+} daemon_response_t;
+
+static volatile sig_atomic_t g_daemon_running = 1;
+static uint32_t g_daemon_max_age_ms = 0;
+
+static void daemon_signal(int signum) {
+    (void)signum;
+    g_daemon_running = 0;
+}
+
+static void daemon_respond(daemon_response_t *response, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(response->data + response->length, sizeof(response->data) - response->length, format, args);
+    va_end(args);
+    if (length > 0)
+        response->length = response->length + (size_t)length < sizeof(response->data) ? response->length + (size_t)length : sizeof(response->data) - 1;
+}
+
+static void daemon_request_read(thermia_modbus_t *ctx, char **save, daemon_response_t *response) {
+    thermia_modbus_read_t reads[DAEMON_READS_MAX];
+    int reads_count = 0;
+    for (const char *name; (name = strtok_r(NULL, " \t", save)) != NULL;) {
+        const register_def_t *reg = find_register(name, REG_COIL_STATUS | REG_INPUT_STATUS | REG_INPUT | REG_HOLDING);
+        if (reg == NULL || !is_register_supported(ctx, reg)) {
+            daemon_respond(response, "error register %s '%s'\n", reg == NULL ? "not found" : "not supported by model", name);
+            return;
+        }
+        if (reads_count == DAEMON_READS_MAX) {
+            daemon_respond(response, "error too many registers\n");
+            return;
+        }
+        reads[reads_count++] = (thermia_modbus_read_t){.name = name};
+    }
+    thermia_modbus_read_registers_cached(ctx, reads, reads_count, g_daemon_max_age_ms);
+    bool complete = true;
+    for (int i = 0; i < reads_count; i++) {
+        if (reads[i].valid) {
+            char buffer[256];
+            format_register(buffer, sizeof(buffer), find_register(reads[i].name, REG_COIL_STATUS | REG_INPUT_STATUS | REG_INPUT | REG_HOLDING), reads[i].value, "read");
+            daemon_respond(response, "%s\n", buffer);
+        } else
+            complete = false;
+    }
+    daemon_respond(response, complete ? "ok\n" : "error read failed\n");
+}
+
+static void daemon_request_write(thermia_modbus_t *ctx, char **save, daemon_response_t *response) {
+    thermia_modbus_write_t writes[DAEMON_READS_MAX];
+    int writes_count = 0;
+    for (const char *name; (name = strtok_r(NULL, " \t", save)) != NULL;) {
+        const char *value_str = strtok_r(NULL, " \t", save);
+        if (value_str == NULL) {
+            daemon_respond(response, "error missing value for write '%s'\n", name);
+            return;
+        }
+        const register_def_t *reg = find_register(name, REG_COIL_STATUS | REG_HOLDING);
+        if (reg == NULL || !is_register_supported(ctx, reg)) {
+            daemon_respond(response, "error register %s '%s'\n", reg == NULL ? "not found" : "not supported by model", name);
+            return;
+        }
+        if (writes_count == DAEMON_READS_MAX) {
+            daemon_respond(response, "error too many registers\n");
+            return;
+        }
+        writes[writes_count++] = (thermia_modbus_write_t){.name = name, .value = atoi(value_str)};
+    }
+    if (writes_count == 0) {
+        daemon_respond(response, "error missing register or value for write\n");
+        return;
+    }
+    thermia_modbus_write_registers(ctx, writes, writes_count, false);
+    bool complete = true;
+    for (int i = 0; i < writes_count; i++) {
+        if (writes[i].written)
+            daemon_respond(response, "%s = %d (write)\n", writes[i].name, writes[i].value);
+        else
+            complete = false;
+    }
+    daemon_respond(response, complete ? "ok\n" : "error write failed\n");
+}
+
+static void daemon_request_stats(thermia_modbus_t *ctx, daemon_response_t *response) {
+    thermia_modbus_stats_t stats[16];
+    const int stats_count = thermia_modbus_stats(ctx, stats, 16);
+    for (int i = 0; i < stats_count; i++) {
+        char buffer[512];
+        format_stats(buffer, sizeof(buffer), &stats[i]);
+        daemon_respond(response, "%s\n", buffer);
+    }
+    daemon_respond(response, "ok\n");
+}
+
+static void daemon_request(thermia_modbus_t *ctx, char *line, daemon_response_t *response) {
+    char *save;
+    const char *operation = strtok_r(line, " \t\r", &save);
+    if (operation == NULL)
+        return;
+    if (strcmp(operation, "read") == 0)
+        daemon_request_read(ctx, &save, response);
+    else if (strcmp(operation, "write") == 0)
+        daemon_request_write(ctx, &save, response);
+    else if (strcmp(operation, "stats") == 0)
+        daemon_request_stats(ctx, response);
+    else
+        daemon_respond(response, "error operation unknown '%s'\n", operation);
+}
+
+static bool daemon_send(int fd, const char *data, size_t length) {
+    while (length > 0) {
+        const ssize_t sent = send(fd, data, length, MSG_NOSIGNAL);
+        if (sent <= 0)
+            return false;
+        data += sent;
+        length -= (size_t)sent;
+    }
+    return true;
+}
+
+// reads what is available and serves every complete line, returns false when the client should be dropped
+static bool daemon_client_service(thermia_modbus_t *ctx, daemon_client_t *client) {
+    const ssize_t received = recv(client->fd, client->line + client->length, sizeof(client->line) - client->length - 1, 0);
+    if (received <= 0)
+        return false;
+    client->length += (size_t)received;
+    char *start = client->line, *end;
+    while ((end = memchr(start, '\n', client->length - (size_t)(start - client->line))) != NULL) {
+        *end = '\0';
+        static daemon_response_t response;
+        response.length = 0;
+        daemon_request(ctx, start, &response);
+        if (!daemon_send(client->fd, response.data, response.length))
+            return false;
+        start = end + 1;
+    }
+    client->length -= (size_t)(start - client->line);
+    memmove(client->line, start, client->length);
+    if (client->length == sizeof(client->line) - 1) {
+        fprintf(stderr, "daemon: request too long, dropping client\n");
+        return false;
+    }
+    return true;
+}
+
+static int daemon_run(thermia_modbus_t *ctx, const char *socket_path, uint32_t max_age_ms) {
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    if (strlen(socket_path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "daemon: socket path too long: %s\n", socket_path);
+        return EXIT_FAILURE;
+    }
+    strcpy(addr.sun_path, socket_path);
+    const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(socket_path);
+    if (listen_fd == -1 || bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) == -1 || listen(listen_fd, DAEMON_CLIENTS_MAX) == -1) {
+        fprintf(stderr, "daemon: failed to listen on '%s': %s\n", socket_path, strerror(errno));
+        if (listen_fd != -1)
+            close(listen_fd);
+        return EXIT_FAILURE;
+    }
+    g_daemon_max_age_ms = max_age_ms;
+    signal(SIGINT, daemon_signal);
+    signal(SIGTERM, daemon_signal);
+    printf("daemon: listening on %s\n", socket_path);
+    fflush(stdout);
+
+    daemon_client_t clients[DAEMON_CLIENTS_MAX];
+    int clients_count = 0;
+    while (g_daemon_running) {
+        struct pollfd fds[DAEMON_CLIENTS_MAX + 1] = {{.fd = listen_fd, .events = POLLIN}};
+        for (int i = 0; i < clients_count; i++)
+            fds[i + 1] = (struct pollfd){.fd = clients[i].fd, .events = POLLIN};
+        if (poll(fds, (nfds_t)clients_count + 1, -1) == -1) {
+            if (errno == EINTR)
+                continue;
+            fprintf(stderr, "daemon: poll failed: %s\n", strerror(errno));
+            break;
+        }
+        for (int i = clients_count - 1; i >= 0; i--)
+            if (fds[i + 1].revents && !daemon_client_service(ctx, &clients[i])) {
+                close(clients[i].fd);
+                clients[i] = clients[--clients_count];
+            }
+        if (fds[0].revents & POLLIN) {
+            const int fd = accept(listen_fd, NULL, NULL);
+            if (fd == -1)
+                fprintf(stderr, "daemon: accept failed: %s\n", strerror(errno));
+            else if (clients_count == DAEMON_CLIENTS_MAX) {
+                fprintf(stderr, "daemon: too many clients\n");
+                close(fd);
+            } else
+                clients[clients_count++] = (daemon_client_t){.fd = fd};
+        }
+    }
+
+    for (int i = 0; i < clients_count; i++)
+        close(clients[i].fd);
+    close(listen_fd);
+    unlink(socket_path);
+    return EXIT_SUCCESS;
+}
+
+// ------------------------------------------------------------------------------------------------------------------------
+
+void print_usage(const char *prog) {
+    printf("Usage:\n");
+    printf("  %s [--format text|jsonl|csv] <address> <model> read <register_name> [<register_name> ...]\n", prog);
+    printf("  %s <address> <model> write <register_name> <value> [<register_name> <value> ...]\n", prog);
+    printf("  %s [--format text|jsonl|csv] <address> <model> dump [<json|csv>]\n", prog);
+    printf("  %s [--format text|jsonl|csv] <address> <model> group <system>[/<subsystem>|/*]\n", prog);
+    printf("  %s [--format text|jsonl|csv] <address> <model> watch <interval_ms> <register_name> [<register_name> ...]\n", prog);
+    printf("  %s [--format text|jsonl|csv] <address> <model> alarms <interval_ms>\n", prog);
+    printf("  %s <address> <model> stats <rounds>\n", prog);
+    printf("  %s <address> <model> daemon <socket_path> [<max_age_ms>]\n", prog);
+    printf("  %s <address> <model> publish <shm_name> <interval_ms>\n", prog);
+    printf("  %s <address> <model> record <path> <interval_ms> [<rotate_mb>]\n", prog);
+    printf("  %s <address> <model> mqtt <host[:port]> <interval_ms> [<prefix> [<qos> [retain]]]\n", prog);
+    printf("  %s <address> <model> exporter <port> <interval_ms>\n", prog);
+    printf("\n");
+    printf("Models: mega, inverter\n");
+    printf("Formats: text (default), or jsonl and csv with one sample per line: time (epoch ms), name, system, subsystem, raw, value\n");
+    printf("\n");
+    printf("Examples:\n");
+    printf("  %s 192.168.0.106 mega read valueHeatpumpBrineInTemperature\n", prog);
+    printf("  %s 192.168.0.106 mega read alarmHeatpumpBrineInSensor\n", prog);
+    printf("  %s --format jsonl 192.168.0.106 mega dump\n", prog);
+    printf("  %s 192.168.0.106 mega group Heating/MixValve2\n", prog);
+    printf("  %s --format jsonl 192.168.0.106 mega group 'Tapwater/*'\n", prog);
+    printf("  %s --format csv 192.168.0.106 mega watch 1000 valueHeatpumpCompressorSpeedRpm valueHeatpumpBrineInTemperature valueHeatpumpBrineOutTemperature\n", prog);
+    printf("  %s --format jsonl 192.168.0.106 mega alarms 5000\n", prog);
+    printf("  %s 192.168.0.106 mega write enableHeatpumpResetAllAlarms 1\n", prog);
+    printf("  %s 192.168.0.106 mega daemon /run/thermia.sock\n", prog);
+    printf("  %s 192.168.0.106 mega publish /thermia 1000\n", prog);
+    printf("  %s 192.168.0.106 mega record /var/lib/thermia/history 1000 64\n", prog);
+    printf("  %s 192.168.0.106 mega mqtt localhost 5000 thermia 1 retain\n", prog);
+    printf("  %s 192.168.0.106 mega exporter 9464 5000\n", prog);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 2 && strcmp(argv[1], "--format") == 0) {
+        if (!parse_output_format(argv[2], &g_output.format))
+            return EXIT_FAILURE;
+        argv[2] = argv[0];
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc < 5 && !(argc == 4 && strcmp(argv[3], "dump") == 0)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    const char *address = argv[1], *model_str = argv[2], *operation = argv[3];
+
+    model_t model;
+    if (!parse_model(model_str, &model))
+        return EXIT_FAILURE;
+
+    thermia_modbus_t *ctx = thermia_modbus_open(address, 502, model);
+    if (ctx == NULL)
+        return EXIT_FAILURE;
+
+    if (strcmp(operation, "read") == 0) {
+        const int reads_count = argc - 4;
+        thermia_modbus_read_t reads[reads_count];
+        for (int argi = 4; argi < argc; argi++) {
+            const char *reg_name = argv[argi];
+            if (find_register(reg_name, REG_COIL_STATUS | REG_INPUT_STATUS | REG_INPUT | REG_HOLDING) == NULL) {
+                fprintf(stderr, "register: not found '%s'\n", reg_name);
+                goto failure;
+            }
+            reads[argi - 4] = (thermia_modbus_read_t){.name = reg_name};
+        }
+        thermia_modbus_read_registers(ctx, reads, reads_count);
+        const uint64_t time_ms = time_now_epoch_ms();
+        for (int i = 0; i < reads_count; i++) {
+            if (!reads[i].valid)
+                continue;
+            const thermia_modbus_handle_t handle =
+                (thermia_modbus_handle_t)(find_register(reads[i].name, REG_COIL_STATUS | REG_INPUT_STATUS | REG_INPUT | REG_HOLDING) - g_registers);
+            if (!output_sample(&g_output, handle, reads[i].value, register_value(handle, reads[i].value), time_ms, "read"))
+                goto failure;
+        }
+        if (!output_flush(&g_output))
+            goto failure;
+    } else if (strcmp(operation, "write") == 0) {
+        if (argc < 6 || (argc - 4) % 2 != 0) {
+            fprintf(stderr, "register: missing value for write operation\n");
+            goto failure;
+        }
+        const int writes_count = (argc - 4) / 2;
+        thermia_modbus_write_t writes[writes_count];
+        for (int argi = 4; argi < argc; argi += 2) {
+            const char *reg_name = argv[argi];
+            if (find_register(reg_name, REG_COIL_STATUS | REG_HOLDING) == NULL) {
+                fprintf(stderr, "register: not found '%s'\n", reg_name);
+                goto failure;
+            }
+            writes[(argi - 4) / 2] = (thermia_modbus_write_t){.name = reg_name, .value = atoi(argv[argi + 1])};
+        }
+        thermia_modbus_write_registers(ctx, writes, writes_count, writes_count > 1);
+        for (int i = 0; i < writes_count; i++)
+            if (writes[i].written)
+                printf("%s = %d (write%s)\n", writes[i].name, writes[i].value, writes[i].verified ? ", verified" : "");
+    } else if (strcmp(operation, "dump") == 0) {
+        if (dump_run(ctx, argc > 4 ? argv[4] : NULL) != EXIT_SUCCESS)
+            goto failure;
+    } else if (strcmp(operation, "group") == 0) {
+        if (group_run(ctx, argv[4]) != EXIT_SUCCESS)
+            goto failure;
+    } else if (strcmp(operation, "stats") == 0) {
+        if (stats_run(ctx, atoi(argv[4])) != EXIT_SUCCESS)
+            goto failure;
+    } else if (strcmp(operation, "daemon") == 0) {
+        if (daemon_run(ctx, argv[4], argc > 5 ? (uint32_t)atoi(argv[5]) : 0) != EXIT_SUCCESS)
+            goto failure;
+    } else if (strcmp(operation, "publish") == 0) {
+        if (argc < 6) {
+            fprintf(stderr, "shm: missing interval for publish operation\n");
+            goto failure;
+        }
+        if (publish_run(ctx, argv[4], atoi(argv[5])) != EXIT_SUCCESS)
+            goto failure;
+    } else if (strcmp(operation, "record") == 0) {
+        if (argc < 6) {
+            fprintf(stderr, "recorder: missing interval for record operation\n");
+            goto failure;
+        }
+        if (record_run(ctx, argv[4], atoi(argv[5]), argc > 6 ? atoi(argv[6]) : 0) != EXIT_SUCCESS)
+            goto failure;
+    } else if (strcmp(operation, "watch") == 0) {
+        if (argc < 6) {
+            fprintf(stderr, "watch: missing register for watch operation\n");
+            goto failure;
+        }
+        if (watch_run(ctx, atoi(argv[4]), &argv[5], argc - 5) != EXIT_SUCCESS)
+            goto failure;
+    } else if (strcmp(operation, "alarms") == 0) {
+        if (alarms_run(ctx, atoi(argv[4])) != EXIT_SUCCESS)
+            goto failure;
+    } else if (strcmp(operation, "exporter") == 0) {
+        if (argc < 6) {
+            fprintf(stderr, "exporter: missing interval for exporter operation\n");
+            goto failure;
+        }
+        if (exporter_run(ctx, atoi(argv[4]), atoi(argv[5])) != EXIT_SUCCESS)
+            goto failure;
+    } else if (strcmp(operation, "mqtt") == 0) {
+        if (argc < 6) {
+            fprintf(stderr, "mqtt: missing interval for mqtt operation\n");
+            goto failure;
+        }
+        if (mqtt_run(ctx, argv[4], atoi(argv[5]), argc > 6 ? argv[6] : NULL, argc > 7 ? atoi(argv[7]) : 0, argc > 8 && strcmp(argv[8], "retain") == 0) != EXIT_SUCCESS)
+            goto failure;
+    } else {
+        fprintf(stderr, "operation unknown: %s\n", operation);
+        goto failure;
+    }
+
+    thermia_modbus_close(ctx);
+    return EXIT_SUCCESS;
+
+failure:
+    thermia_modbus_close(ctx);
+    return EXIT_FAILURE;
+}
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+#ifdef MOCK
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/timerfd.h>
+
+/*
+ * Mock controller: a Modbus TCP server holding every register of the model's table, for measuring the library
+ * without a heat pump. Responses leave in request order, each no sooner than latency +/- jitter after its request
+ * arrived, so pipelined requests overlap their waits as they would on a LAN round trip. Writes are kept, function
+ * codes the library uses are served, and with 'strict' an address outside the table is an illegal data address, as
+ * a controller that does not tolerate gaps would answer.
+ */
+
+#define MOCK_CLIENTS_MAX 16
+#define MOCK_PENDING_MAX 64
+
+typedef struct {
+    uint64_t due_us;
+    size_t length;
+    uint8_t data[ASYNC_FRAME_MAX];
+} mock_response_t;
+
+typedef struct {
+    int fd;
+    uint8_t rx[ASYNC_FRAME_MAX * 2];
+    size_t rx_length;
+    mock_response_t pending[MOCK_PENDING_MAX];
+    int pending_head, pending_count;
+} mock_client_t;
+
+static uint16_t g_mock_values[4][65536]; // by type slot (coil, input status, input, holding) and address
+static bool g_mock_exists[4][65536];
+static bool g_mock_strict = false;
+static uint32_t g_mock_latency_us = 2000, g_mock_jitter_us = 500;
+static volatile sig_atomic_t g_mock_running = 1;
+
+static void mock_signal(int signum) {
+    (void)signum;
+    g_mock_running = 0;
+}
+
+static int mock_slot(reg_type_t type) { return type == REG_COIL_STATUS ? 0 : type == REG_INPUT_STATUS ? 1 : type == REG_INPUT ? 2 : 3; }
+
+static void mock_seed(model_t model) {
+    for (int i = 0; i < g_num_registers; i++) {
+        const register_def_t *reg = &g_registers[i];
+        if (reg->model & model) {
+            const int slot = mock_slot(reg->type);
+            g_mock_exists[slot][reg->address] = true;
+            g_mock_values[slot][reg->address] = is_register_type_bit(reg->type) ? (uint16_t)(reg->address & 1) : (uint16_t)(reg->scale * 20 + reg->address % 10);
+        }
+    }
+}
+
+static bool mock_range(int slot, int address, int quantity, int limit) {
+    if (quantity < 1 || quantity > limit || address + quantity > 65536)
+        return false;
+    for (int i = 0; g_mock_strict && i < quantity; i++)
+        if (!g_mock_exists[slot][address + i])
+            return false;
+    return true;
+}
+
+// builds the response PDU after the MBAP header into 'reply', returns its length
+static size_t mock_reply(const uint8_t *request, size_t length, uint8_t *reply) {
+    const uint8_t function = request[7];
+    const int address = request[8] << 8 | request[9], quantity = request[10] << 8 | request[11];
+    uint8_t exception = 0;
+    size_t reply_length = 0;
+    reply[0] = function;
+    if (length < 12)
+        exception = MODBUS_EXCEPTION_ILLEGAL_DATA_VALUE;
+    else if (function == 0x01 || function == 0x02) {
+        const int slot = function == 0x01 ? 0 : 1;
+        if (!mock_range(slot, address, quantity, MODBUS_MAX_READ_BITS))
+            exception = MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS;
+        else {
+            reply[1] = (uint8_t)((quantity + 7) / 8);
+            memset(reply + 2, 0, reply[1]);
+            for (int i = 0; i < quantity; i++)
+                if (g_mock_values[slot][address + i])
+                    reply[2 + i / 8] |= (uint8_t)(1 << (i % 8));
+            reply_length = 2 + reply[1];
+        }
+    } else if (function == 0x03 || function == 0x04) {
+        const int slot = function == 0x04 ? 2 : 3;
+        if (!mock_range(slot, address, quantity, MODBUS_MAX_READ_REGISTERS))
+            exception = MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS;
+        else {
+            reply[1] = (uint8_t)(quantity * 2);
+            for (int i = 0; i < quantity; i++) {
+                reply[2 + 2 * i] = (uint8_t)(g_mock_values[slot][address + i] >> 8);
+                reply[3 + 2 * i] = (uint8_t)g_mock_values[slot][address + i];
+            }
+            reply_length = 2 + reply[1];
+        }
+    } else if (function == 0x05 || function == 0x06) {
+        const int slot = function == 0x05 ? 0 : 3;
+        if (!mock_range(slot, address, 1, 1))
+            exception = MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS;
+        else {
+            g_mock_values[slot][address] = function == 0x05 ? quantity == 0xFF00 : (uint16_t)quantity;
+            memcpy(reply, request + 7, 5);
+            reply_length = 5;
+        }
+    } else if (function == 0x0F || function == 0x10) {
+        const int slot = function == 0x0F ? 0 : 3;
+        const size_t bytes = function == 0x0F ? (size_t)(quantity + 7) / 8 : (size_t)quantity * 2;
+        if (length < 13 || request[12] != bytes || length < 13 + bytes)
+            exception = MODBUS_EXCEPTION_ILLEGAL_DATA_VALUE;
+        else if (!mock_range(slot, address, quantity, function == 0x0F ? MODBUS_MAX_WRITE_BITS : MODBUS_MAX_WRITE_REGISTERS))
+            exception = MODBUS_EXCEPTION_ILLEGAL_DATA_ADDRESS;
+        else {
+            const uint8_t *data = request + 13;
+            for (int i = 0; i < quantity; i++)
+                g_mock_values[slot][address + i] = function == 0x0F ? (data[i / 8] >> (i % 8)) & 1 : (uint16_t)(data[2 * i] << 8 | data[2 * i + 1]);
+            memcpy(reply, request + 7, 5);
+            reply_length = 5;
+        }
+    } else
+        exception = MODBUS_EXCEPTION_ILLEGAL_FUNCTION;
+    if (exception != 0) {
+        reply[0] = function | 0x80;
+        reply[1] = exception;
+        reply_length = 2;
+    }
+    return reply_length;
+}
+
+// parses complete requests and queues their responses, returns false when the client should be dropped
+static bool mock_client_service(mock_client_t *client) {
+    const ssize_t received = recv(client->fd, client->rx + client->rx_length, sizeof(client->rx) - client->rx_length, 0);
+    if (received <= 0)
+        return false;
+    client->rx_length += (size_t)received;
+    const uint64_t now_us = time_now_us();
+    size_t offset = 0;
+    while (client->rx_length - offset >= 8) {
+        const uint8_t *request = client->rx + offset;
+        const size_t length = 6 + (size_t)(request[4] << 8 | request[5]);
+        if (length < 8 || length > ASYNC_FRAME_MAX || client->pending_count == MOCK_PENDING_MAX)
+            return false;
+        if (client->rx_length - offset < length)
+            break;
+        mock_response_t *response = &client->pending[(client->pending_head + client->pending_count) % MOCK_PENDING_MAX];
+        const mock_response_t *previous = client->pending_count > 0 ? &client->pending[(client->pending_head + client->pending_count - 1) % MOCK_PENDING_MAX] : NULL;
+        const int64_t jitter = g_mock_jitter_us > 0 ? (int64_t)(rand() % (int)(2 * g_mock_jitter_us + 1)) - (int64_t)g_mock_jitter_us : 0;
+        response->due_us = now_us + (uint64_t)((int64_t)g_mock_latency_us + jitter > 0 ? (int64_t)g_mock_latency_us + jitter : 0);
+        if (previous != NULL && previous->due_us > response->due_us)
+            response->due_us = previous->due_us;
+        const size_t pdu_length = mock_reply(request, length, response->data + 7);
+        memcpy(response->data, request, 4);
+        response->data[4] = (uint8_t)((pdu_length + 1) >> 8);
+        response->data[5] = (uint8_t)(pdu_length + 1);
+        response->data[6] = request[6];
+        response->length = 7 + pdu_length;
+        client->pending_count++;
+        offset += length;
+    }
+    client->rx_length -= offset;
+    memmove(client->rx, client->rx + offset, client->rx_length);
+    return true;
+}
+
+static bool mock_client_flush(mock_client_t *client, uint64_t now_us) {
+    while (client->pending_count > 0 && client->pending[client->pending_head].due_us <= now_us) {
+        const mock_response_t *response = &client->pending[client->pending_head];
+        if (send(client->fd, response->data, response->length, MSG_NOSIGNAL) != (ssize_t)response->length)
+            return false;
+        client->pending_head = (client->pending_head + 1) % MOCK_PENDING_MAX;
+        client->pending_count--;
+    }
+    return true;
+}
+
+static int mock_run(int port) {
+    const int listen_fd = socket(AF_INET, SOCK_STREAM, 0), reuse = 1;
+    struct sockaddr_in addr = {.sin_family = AF_INET, .sin_port = htons((uint16_t)port), .sin_addr.s_addr = htonl(INADDR_ANY)};
+    if (listen_fd == -1 || setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) == -1 ||
+        bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) == -1 || listen(listen_fd, MOCK_CLIENTS_MAX) == -1) {
+        fprintf(stderr, "mock: failed to listen on port %d: %s\n", port, strerror(errno));
+        if (listen_fd != -1)
+            close(listen_fd);
+        return EXIT_FAILURE;
+    }
+    const int timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC); // microsecond wakeups, poll only has milliseconds
+    if (timer_fd == -1) {
+        fprintf(stderr, "mock: failed to create timer: %s\n", strerror(errno));
+        close(listen_fd);
+        return EXIT_FAILURE;
+    }
+    signal(SIGINT, mock_signal);
+    signal(SIGTERM, mock_signal);
+    printf("mock: listening on port %d (latency %u us, jitter %u us%s)\n", port, g_mock_latency_us, g_mock_jitter_us, g_mock_strict ? ", strict" : "");
+    fflush(stdout);
+
+    static mock_client_t clients[MOCK_CLIENTS_MAX];
+    int clients_count = 0;
+    while (g_mock_running) {
+        uint64_t due_us = UINT64_MAX;
+        struct pollfd fds[MOCK_CLIENTS_MAX + 2] = {{.fd = listen_fd, .events = POLLIN}, {.fd = timer_fd, .events = POLLIN}};
+        for (int i = 0; i < clients_count; i++) {
+            fds[i + 2] = (struct pollfd){.fd = clients[i].fd, .events = POLLIN};
+            if (clients[i].pending_count > 0 && clients[i].pending[clients[i].pending_head].due_us < due_us)
+                due_us = clients[i].pending[clients[i].pending_head].due_us;
+        }
+        const struct itimerspec timer = {.it_value = {.tv_sec = due_us == UINT64_MAX ? 0 : (time_t)(due_us / 1000000),
+                                                       .tv_nsec = due_us == UINT64_MAX ? 0 : (long)(due_us % 1000000) * 1000}};
+        timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &timer, NULL); // an absolute time already passed fires at once
+        if (poll(fds, (nfds_t)clients_count + 2, -1) == -1) {
+            if (errno == EINTR)
+                continue;
+            fprintf(stderr, "mock: poll failed: %s\n", strerror(errno));
+            break;
+        }
+        if (fds[1].revents & POLLIN) {
+            uint64_t expirations;
+            if (read(timer_fd, &expirations, sizeof(expirations)) == -1 && errno != EAGAIN)
+                fprintf(stderr, "mock: timer read failed: %s\n", strerror(errno));
+        }
+        for (int i = clients_count - 1; i >= 0; i--)
+            if ((fds[i + 2].revents && !mock_client_service(&clients[i])) || !mock_client_flush(&clients[i], time_now_us())) {
+                close(clients[i].fd);
+                clients[i] = clients[--clients_count];
+            }
+        if (fds[0].revents & POLLIN) {
+            const int fd = accept(listen_fd, NULL, NULL), nodelay = 1;
+            if (fd == -1)
+                fprintf(stderr, "mock: accept failed: %s\n", strerror(errno));
+            else if (clients_count == MOCK_CLIENTS_MAX) {
+                fprintf(stderr, "mock: too many clients\n");
+                close(fd);
+            } else {
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+                clients[clients_count] = (mock_client_t){.fd = fd};
+                clients_count++;
+            }
+        }
+    }
+
+    for (int i = 0; i < clients_count; i++)
+        close(clients[i].fd);
+    close(timer_fd);
+    close(listen_fd);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        printf("Usage:\n");
+        printf("  %s <port> <model> [<latency_us> [<jitter_us> [strict]]]\n", argv[0]);
+        printf("\n");
+        printf("Models: mega, inverter\n");
+        return EXIT_FAILURE;
+    }
+    model_t model;
+    if (!parse_model(argv[2], &model))
+        return EXIT_FAILURE;
+    if (argc > 3)
+        g_mock_latency_us = (uint32_t)atoi(argv[3]);
+    if (argc > 4)
+        g_mock_jitter_us = (uint32_t)atoi(argv[4]);
+    g_mock_strict = argc > 5 && strcmp(argv[5], "strict") == 0;
+    mock_seed(model);
+    return mock_run(atoi(argv[1]));
+}
+
+#endif
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+#ifdef BENCH
+
+#define BENCH_LOOKUP_ROUNDS 2000
+
+static const register_def_t *find_register_linear(const char *name, reg_type_t type) {
+    for (int i = 0; i < g_num_registers; i++)
+        if (strcmp(g_registers[i].name, name) == 0 && g_registers[i].type & type)
+            return &g_registers[i];
+    return NULL;
+}
+
+static double bench_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void bench_lookup(const char *label, const register_def_t *(*lookup)(const char *, reg_type_t)) {
+    const reg_type_t types = REG_COIL_STATUS | REG_INPUT_STATUS | REG_INPUT | REG_HOLDING;
+    int found = 0;
+    const double start = bench_seconds();
+    for (int round = 0; round < BENCH_LOOKUP_ROUNDS; round++)
+        for (int i = 0; i < g_num_registers; i++)
+            found += lookup(g_registers[i].name, types) != NULL;
+    const double elapsed = bench_seconds() - start;
+    if (found != BENCH_LOOKUP_ROUNDS * g_num_registers)
+        fprintf(stderr, "bench: %s: lookup failures (%d of %d found)\n", label, found, BENCH_LOOKUP_ROUNDS * g_num_registers);
+    printf("lookup %-8s %12.0f lookups/sec\n", label, (double)found / elapsed);
+}
+
+/*
+ * Recorder: a week of one second frames of synthetic data (a few dozen analog registers drifting, a few of them
+ * changing per second), written through the recorder then replayed, reporting the file size and replay rate.
+ */
+
+#define BENCH_RECORD_SECONDS (7 * 24 * 3600)
+#define BENCH_RECORD_DRIFTING 40
+
+static bool bench_recorder(void) {
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/thermia_bench_record.%d", (int)getpid());
+    thermia_recorder_t *recorder = recorder_open(MODEL_MEGA, path, 0, 1);
+    if (recorder == NULL)
+        return false;
+    thermia_modbus_handle_t handles[g_num_registers];
+    int values[g_num_registers], drift[BENCH_RECORD_DRIFTING], count = 0;
+    for (int i = 0; i < g_num_registers; i++) {
+        handles[count] = i;
+        values[count++] = g_registers_info[i].defacto;
+    }
+    const uint64_t start_ms = time_now_epoch_ms();
+    double start = bench_seconds();
+    bool ok = recorder_frame(recorder, start_ms, handles, values, count);
+    for (int i = 0; i < BENCH_RECORD_DRIFTING; i++)
+        drift[i] = g_registers_info[i * (g_num_registers / BENCH_RECORD_DRIFTING)].defacto;
+    uint32_t random = 1;
+    for (int second = 1; ok && second <= BENCH_RECORD_SECONDS; second++) {
+        count = 0;
+        for (int i = 0; i < BENCH_RECORD_DRIFTING; i++) {
+            random = random * 1103515245 + 12345;
+            if ((random >> 16) % 10 == 0) { // each drifting register changes about every 10 s
+                drift[i] += (random >> 27) & 1 ? 1 : -1;
+                handles[count] = i * (g_num_registers / BENCH_RECORD_DRIFTING);
+                values[count++] = drift[i];
+            }
+        }
+        ok = recorder_frame(recorder, start_ms + (uint64_t)second * 1000, handles, values, count);
+    }
+    const double record_seconds = bench_seconds() - start;
+    const size_t size = recorder->size;
+    thermia_recorder_close(recorder);
+
+    thermia_replay_t *replay = ok ? thermia_replay_open(path) : NULL;
+    if (replay == NULL) {
+        unlink(path);
+        return false;
+    }
+    start = bench_seconds();
+    long frames = 0, samples = 0;
+    for (int changed; (changed = thermia_replay_next(replay, NULL, NULL, 0)) >= 0; frames++)
+        samples += changed;
+    const double replay_seconds = bench_seconds() - start;
+    thermia_replay_close(replay);
+    unlink(path);
+    printf("record   %10.3f MB/week %12.0f frames/sec   replay %12.0f frames/sec %12.0f samples/sec\n", (double)size / (1024 * 1024),
+           BENCH_RECORD_SECONDS / record_seconds, (double)frames / replay_seconds, (double)samples / replay_seconds);
+    return true;
+}
+
+/*
+ * Transport: full polls of every register the model supports against a controller (or the mock), as single reads,
+ * block reads, cached block reads (served from a warm cache) and async pipelined block reads. Latency percentiles
+ * are per request for single reads and per poll otherwise.
+ */
+
+#define BENCH_POLL_ROUNDS 20
+#define BENCH_SINGLE_ROUNDS 2
+
+static int bench_sample_compare(const void *a, const void *b) {
+    const double sample_a = *(const double *)a, sample_b = *(const double *)b;
+    return sample_a < sample_b ? -1 : sample_a > sample_b;
+}
+
+static void bench_report(const char *label, double *samples_us, int samples_count, double poll_us, int registers_count) {
+    qsort(samples_us, (size_t)samples_count, sizeof(double), bench_sample_compare);
+    printf("poll %-8s %10.3f ms %12.0f registers/sec   p50 %9.0f us   p99 %9.0f us\n", label, poll_us / 1000.0, registers_count / (poll_us / 1e6),
+           samples_us[(samples_count - 1) * 50 / 100], samples_us[(samples_count - 1) * 99 / 100]);
+}
+
+static void bench_async_callback(void *arg, thermia_modbus_handle_t handle, int value, bool valid) {
+    (void)handle;
+    (void)value;
+    *(int *)arg += !valid;
+}
+
+static bool bench_transport(const char *address, int port, model_t model) {
+    thermia_modbus_t *ctx = thermia_modbus_open(address, port, model);
+    if (ctx == NULL)
+        return false;
+    const register_model_table_t *table = ctx->table;
+    const int count = table->count;
+    thermia_modbus_handle_t handles[count];
+    int values[g_num_registers];
+    bool valid[g_num_registers];
+    double samples[count * BENCH_SINGLE_ROUNDS > BENCH_POLL_ROUNDS ? count * BENCH_SINGLE_ROUNDS : BENCH_POLL_ROUNDS];
+    for (int position = 0; position < count; position++)
+        handles[position] = table->order[position];
+
+    double start = bench_seconds();
+    for (int round = 0; round < BENCH_SINGLE_ROUNDS; round++)
+        for (int i = 0; i < count; i++) {
+            const double request_start = bench_seconds();
+            if (is_register_type_bit(g_registers[handles[i]].type)) {
+                bool bit;
+                thermia_modbus_read_handle_bit(ctx, handles[i], &bit);
+            } else
+                thermia_modbus_read_handle_int(ctx, handles[i], &values[0]);
+            samples[round * count + i] = (bench_seconds() - request_start) * 1e6;
+        }
+    bench_report("single", samples, count * BENCH_SINGLE_ROUNDS, (bench_seconds() - start) * 1e6 / BENCH_SINGLE_ROUNDS, count);
+
+    start = bench_seconds();
+    for (int round = 0; round < BENCH_POLL_ROUNDS; round++) {
+        const double poll_start = bench_seconds();
+        thermia_modbus_read_all(ctx, values, valid);
+        samples[round] = (bench_seconds() - poll_start) * 1e6;
+    }
+    bench_report("block", samples, BENCH_POLL_ROUNDS, (bench_seconds() - start) * 1e6 / BENCH_POLL_ROUNDS, count);
+
+    thermia_modbus_read_handles(ctx, handles, count, values, valid);
+    start = bench_seconds();
+    for (int round = 0; round < BENCH_POLL_ROUNDS; round++) {
+        const double poll_start = bench_seconds();
+        thermia_modbus_read_handles_cached(ctx, handles, count, 60000, values, valid);
+        samples[round] = (bench_seconds() - poll_start) * 1e6;
+    }
+    bench_report("cached", samples, BENCH_POLL_ROUNDS, (bench_seconds() - start) * 1e6 / BENCH_POLL_ROUNDS, count);
+
+    thermia_async_t *async = thermia_async_create();
+    int failed = 0;
+    if (async != NULL && thermia_async_attach(async, ctx)) {
+        start = bench_seconds();
+        for (int round = 0; round < BENCH_POLL_ROUNDS; round++) {
+            const double poll_start = bench_seconds();
+            thermia_async_read_handles(async, ctx, handles, count, bench_async_callback, &failed);
+            while (thermia_async_pending(async) > 0 && thermia_async_dispatch(async, -1) >= 0)
+                ;
+            samples[round] = (bench_seconds() - poll_start) * 1e6;
+        }
+        bench_report("async", samples, BENCH_POLL_ROUNDS, (bench_seconds() - start) * 1e6 / BENCH_POLL_ROUNDS, count);
+        if (failed > 0)
+            fprintf(stderr, "bench: async: %d reads failed\n", failed);
+    }
+    thermia_async_destroy(async);
+    thermia_modbus_close(ctx);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    bench_lookup("linear", find_register_linear);
+    bench_lookup("hash", find_register);
+    if (!bench_recorder())
+        return EXIT_FAILURE;
+    if (argc >= 4) {
+        model_t model;
+        if (!parse_model(argv[3], &model) || !bench_transport(argv[1], atoi(argv[2]), model))
+            return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
 }
 
 #endif
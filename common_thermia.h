@@ -5,23 +5,59 @@
 // ------------------------------------------------------------------------------------------------------------------------
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 typedef enum { MODEL_MEGA = 0x01, MODEL_INVERTER = 0x2 } model_t;
 
 // ------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------
 
-bool thermia_modbus_open(const char *address, int port, model_t model);
-void thermia_modbus_close(void);
+/*
+ * Each open returns an independent device context: any number of heat pumps can be used from one process, and
+ * contexts share no state so they may be used concurrently from different threads. Requests on one context are
+ * serialised internally, so a context may also be shared between threads.
+ */
+typedef struct thermia_modbus thermia_modbus_t;
 
-bool thermia_modbus_read_register_bit(const char *name, bool *value);
+thermia_modbus_t *thermia_modbus_open(const char *address, int port, model_t model);
+void thermia_modbus_close(thermia_modbus_t *ctx);
+/*
+ * Drop and re-establish the connection, e.g. after a failed request on a long lived context
+ */
+bool thermia_modbus_reconnect(thermia_modbus_t *ctx);
+/*
+ * Request policy (may be changed at any time):
+ *   - timeouts: libmodbus response timeout (first byte) and byte timeout (between bytes), default 500 ms each
+ *   - retry: requests without a response are retried on a fresh connection up to 'retries' times, waiting 'backoff_ms'
+ *     and doubling up to 'backoff_max_ms' in between (default 2 retries, 100..1000 ms); exceptions are not retried
+ *   - breaker: after 'threshold' consecutive requests fail (0 disables, default 3) requests fail immediately, and cached
+ *     reads serve the last known values at any age, until a probe succeeds; probes run every 'probe_interval_ms'
+ *     (default 5000) from the context's background thread (see heartbeat), so no request waits on them
+ */
+bool thermia_modbus_set_timeouts(thermia_modbus_t *ctx, uint32_t response_timeout_ms, uint32_t byte_timeout_ms);
+bool thermia_modbus_set_retry(thermia_modbus_t *ctx, int retries, uint32_t backoff_ms, uint32_t backoff_max_ms);
+bool thermia_modbus_set_breaker(thermia_modbus_t *ctx, int threshold, uint32_t probe_interval_ms);
+bool thermia_modbus_breaker_is_open(thermia_modbus_t *ctx);
+/*
+ * Idle connections (dropped by the controller or a NAT in between after a quiet period):
+ *   - keepalive: TCP keepalive probes after 'idle_s' without traffic, every 'interval_s', giving up after 'count'
+ *     unanswered (0 idle disables, default off); kept across reconnects
+ *   - heartbeat: a background thread reconnects as soon as the controller closes the connection and reads a single
+ *     register once the connection has been idle for 'idle_ms' (0 stops it, default off), so a stale connection is
+ *     found and replaced between polls rather than stalling the next one; the same thread runs the breaker probes
+ */
+bool thermia_modbus_set_keepalive(thermia_modbus_t *ctx, uint32_t idle_s, uint32_t interval_s, uint32_t count);
+bool thermia_modbus_set_heartbeat(thermia_modbus_t *ctx, uint32_t idle_ms);
+
+bool thermia_modbus_read_register_bit(thermia_modbus_t *ctx, const char *name, bool *value);
 /*
  * Note: Values are returned raw. Apply scaling if needed:
  *   - Most temperatures: divide by 10
  *   - Currents: divide by 100
  */
-bool thermia_modbus_read_register_int(const char *name, int *value);
-bool thermia_modbus_write_register_bit(const char *name, bool value);
+bool thermia_modbus_read_register_int(thermia_modbus_t *ctx, const char *name, int *value);
+bool thermia_modbus_write_register_bit(thermia_modbus_t *ctx, const char *name, bool value);
 /*
  * Write an integer register (holding register only)
  *
@@ -29,7 +65,302 @@ bool thermia_modbus_write_register_bit(const char *name, bool value);
  *   - For 22.0°C, write 220 (scale factor 10)
  *   - For 15.50A, write 1550 (scale factor 100)
  */
-bool thermia_modbus_write_register_int(const char *name, int value);
+bool thermia_modbus_write_register_int(thermia_modbus_t *ctx, const char *name, int value);
+
+/*
+ * Handles: resolve a name once (validating it exists and is supported by the model) then use the handle in hot polling
+ * loops, avoiding name lookups and model checks. A handle is an opaque index, only valid for the connection's model.
+ */
+typedef int thermia_modbus_handle_t;
+bool thermia_modbus_resolve_register(thermia_modbus_t *ctx, const char *name, thermia_modbus_handle_t *handle);
+const char *thermia_modbus_handle_name(thermia_modbus_handle_t handle);
+bool thermia_modbus_read_handle_bit(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, bool *value);
+bool thermia_modbus_read_handle_int(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, int *value);
+bool thermia_modbus_write_handle_bit(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, bool value);
+bool thermia_modbus_write_handle_int(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, int value);
+
+typedef struct {
+    const char *name;
+    int value;
+    bool valid;
+} thermia_modbus_read_t;
+/*
+ * Read many registers (bits and ints, in any order) with as few Modbus requests as possible: registers are grouped by
+ * type and merged into block reads over nearby addresses. Values are raw as per the single register functions.
+ *
+ * Returns true if every register was read, otherwise check 'valid' on each entry.
+ */
+bool thermia_modbus_read_registers(thermia_modbus_t *ctx, thermia_modbus_read_t *reads, int count);
+bool thermia_modbus_read_handles(thermia_modbus_t *ctx, const thermia_modbus_handle_t *handles, int count, int *values, bool *valid);
+/*
+ * Block reads learn the addresses the controller rejects (holes in its register map) and split later blocks around
+ * them. Set a planner file to keep what was learned across runs: it is keyed by model and the firmware version read
+ * from the controller, created if missing and rewritten whenever something new is learned.
+ */
+bool thermia_modbus_set_planner_file(thermia_modbus_t *ctx, const char *path);
+/*
+ * Read every register supported by the model in one pass: 'values' and 'valid' are indexed by handle and sized by
+ * thermia_modbus_register_count(), unsupported registers are left invalid
+ */
+int thermia_modbus_register_count(void);
+bool thermia_modbus_read_all(thermia_modbus_t *ctx, int *values, bool *valid);
+/*
+ * Read a group of registers by system and subsystem, e.g. "Heating/MixValve2": block reads are planned per group when
+ * generated, so one circuit costs a request per register run it touches rather than a pass over the whole table. Either
+ * part may be "*" to match any, a bare system ("Tapwater") is all of its subsystems.
+ *
+ * Both return the count of supported registers in the matching groups, or -1 if none match, filling handles (and
+ * values and valid) group by group in type and address order. read_group fails if they do not fit in 'max': resolve
+ * with max 0 to size the arrays.
+ */
+int thermia_modbus_resolve_group(thermia_modbus_t *ctx, const char *pattern, thermia_modbus_handle_t *handles, int max);
+int thermia_modbus_read_group(thermia_modbus_t *ctx, const char *pattern, thermia_modbus_handle_t *handles, int *values, bool *valid, int max);
+/*
+ * Engineering values: registers read and scaled (e.g. 215 -> 21.5 for scale 10) as the type the register holds, so
+ * counters and versions read unsigned and either half of a 32 bit pair (e.g. operating hours) reads the whole value.
+ *
+ * scale_values converts a whole read_all result at once: 'scaled' is indexed by handle, invalid registers are NaN.
+ */
+bool thermia_modbus_read_value(thermia_modbus_t *ctx, const char *name, double *value);
+bool thermia_modbus_read_handle_value(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, double *value);
+void thermia_modbus_scale_values(const int *values, const bool *valid, double *scaled);
+
+typedef struct {
+    const char *name;
+    int value;
+    bool written, verified;
+} thermia_modbus_write_t;
+/*
+ * Write many registers (coils and holding registers, in any order) as one batch: registers at consecutive addresses
+ * go out in a single write multiple request. Values are raw as per the single register functions. Nothing is written
+ * if any register is unknown, unsupported or repeated; otherwise each entry reports whether it was written and, when
+ * verifying, whether it read back unchanged (the read back is coalesced into block reads too). No other request on
+ * the context runs in between, but the controller has no rollback: a batch that fails part way stays part written.
+ *
+ * Returns true if every register was written (and verified), otherwise check each entry. 'verified' may be NULL.
+ */
+bool thermia_modbus_write_registers(thermia_modbus_t *ctx, thermia_modbus_write_t *writes, int count, bool verify);
+bool thermia_modbus_write_handles(thermia_modbus_t *ctx, const thermia_modbus_handle_t *handles, const int *values, int count, bool *written, bool *verified);
+
+/*
+ * Last-value cache: each context keeps the last raw value and read time of every register read or written through it.
+ *
+ * Change detection: a register counts as changed when it moves by more than its deadband (set in engineering units,
+ * per register or for every register with a given scale, e.g. 0.2 for scale 10 temperatures). Each consumer keeps its
+ * own cursor (start at 0): cache_changed fills 'handles' with registers changed since the cursor and advances it.
+ */
+bool thermia_modbus_cache_get(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, int *value, uint32_t *age_ms);
+bool thermia_modbus_cache_set_deadband(thermia_modbus_t *ctx, thermia_modbus_handle_t handle, double deadband);
+int thermia_modbus_cache_set_deadband_scale(thermia_modbus_t *ctx, int scale, double deadband);
+int thermia_modbus_cache_changed(thermia_modbus_t *ctx, uint32_t *cursor, thermia_modbus_handle_t *handles, int handles_max);
+/*
+ * Cached block reads: registers read within the last 'max_age_ms' are served from the cache, the rest are fetched. A
+ * context may be shared by several threads; concurrent requests for the same stale registers share one fetch.
+ */
+bool thermia_modbus_read_registers_cached(thermia_modbus_t *ctx, thermia_modbus_read_t *reads, int count, uint32_t max_age_ms);
+bool thermia_modbus_read_handles_cached(thermia_modbus_t *ctx, const thermia_modbus_handle_t *handles, int count, uint32_t max_age_ms, int *values, bool *valid);
+
+/*
+ * Transaction stats, per context and Modbus function code, only recorded when built with THERMIA_STATS (otherwise
+ * the query returns 0 and nothing is measured). Latencies are from request to response in microseconds.
+ */
+typedef struct {
+    uint8_t function;
+    const char *function_name;
+    uint64_t count, errors, timeouts, retries, bytes_sent, bytes_received;
+    uint32_t latency_p50_us, latency_p90_us, latency_p99_us, latency_max_us;
+} thermia_modbus_stats_t;
+int thermia_modbus_stats(thermia_modbus_t *ctx, thermia_modbus_stats_t *stats, int stats_max);
+void thermia_modbus_stats_reset(thermia_modbus_t *ctx);
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Async: non-blocking reads with many Modbus transactions in flight, to one or more attached contexts (each gets a
+ * second, non-blocking connection to its controller). Submitting returns at once; values are delivered to the callback
+ * (and the context cache) as responses arrive, or with 'valid' false on exception, timeout or connection failure.
+ * Single threaded: submit and dispatch from one thread, waiting on the fd with poll/epoll or letting dispatch wait
+ * (timeout in ms, -1 for as long as needed). Dispatch returns the number of completed transactions.
+ */
+typedef struct thermia_async thermia_async_t;
+typedef void (*thermia_async_callback_t)(void *arg, thermia_modbus_handle_t handle, int value, bool valid);
+
+thermia_async_t *thermia_async_create(void);
+void thermia_async_destroy(thermia_async_t *async);
+bool thermia_async_attach(thermia_async_t *async, thermia_modbus_t *ctx);
+bool thermia_async_read_handles(thermia_async_t *async, thermia_modbus_t *ctx, const thermia_modbus_handle_t *handles, int count,
+                                thermia_async_callback_t callback, void *callback_arg);
+int thermia_async_dispatch(thermia_async_t *async, int timeout_ms);
+int thermia_async_fd(const thermia_async_t *async);
+int thermia_async_pending(const thermia_async_t *async);
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Poller: registers are polled at their own intervals, either by name or by system/subsystem group (NULL matches any).
+ * Call tick when next_ms says something is due (or on a fixed cadence); it reads everything due in block reads and
+ * delivers each value (raw) to the callback. next_ms returns -1 if nothing is scheduled.
+ */
+typedef struct thermia_poller thermia_poller_t;
+typedef void (*thermia_poller_callback_t)(void *arg, thermia_modbus_handle_t handle, int value);
+
+thermia_poller_t *thermia_poller_create(thermia_modbus_t *ctx, thermia_poller_callback_t callback, void *callback_arg);
+void thermia_poller_destroy(thermia_poller_t *poller);
+bool thermia_poller_add(thermia_poller_t *poller, const char *name, int interval_ms);
+int thermia_poller_add_group(thermia_poller_t *poller, const char *system, const char *subsystem, int interval_ms);
+int thermia_poller_next_ms(const thermia_poller_t *poller);
+int thermia_poller_tick(thermia_poller_t *poller);
+/*
+ * As tick, but submits what is due to an async engine (the poller's context must be attached) and returns at once:
+ * values reach the callback from dispatch. Returns the count of registers submitted.
+ */
+int thermia_poller_tick_async(thermia_poller_t *poller, thermia_async_t *async);
+/*
+ * Triggers: a callback fired from tick (or dispatch) as soon as a polled value meets a condition, e.g. an alarm bit
+ * rising, rather than by diffing samples later. Edges fire on a bit (or value) becoming set or clear, thresholds on the
+ * scaled value reaching or passing the threshold, and rearm only once it is back beyond the hysteresis band. A
+ * condition already met by the first value fires too, except falling edges. The register must also be polled.
+ */
+typedef enum { THERMIA_TRIGGER_RISING, THERMIA_TRIGGER_FALLING, THERMIA_TRIGGER_ABOVE, THERMIA_TRIGGER_BELOW } thermia_trigger_kind_t;
+typedef void (*thermia_trigger_callback_t)(void *arg, thermia_modbus_handle_t handle, double value);
+
+bool thermia_poller_add_trigger(thermia_poller_t *poller, const char *name, thermia_trigger_kind_t kind, double threshold, double hysteresis,
+                                thermia_trigger_callback_t callback, void *callback_arg);
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Write queue: coils and holding registers (e.g. setpoints adjusted by a control loop) are queued rather than written
+ * at once. Repeated sets of a register keep only the latest value, and flush sends what is pending as one batch write,
+ * at most once per interval, skipping values equal to the last value cached from the controller. Values are raw as
+ * per the single register functions. Sets may come from any thread; flush from one. next_ms returns -1 if nothing is
+ * pending; flush returns the count of registers written (failed ones stay queued) and 'force' ignores the interval.
+ */
+typedef struct thermia_write_queue thermia_write_queue_t;
+
+thermia_write_queue_t *thermia_write_queue_create(thermia_modbus_t *ctx, int interval_ms);
+void thermia_write_queue_destroy(thermia_write_queue_t *queue);
+bool thermia_write_queue_set_bit(thermia_write_queue_t *queue, const char *name, bool value);
+bool thermia_write_queue_set_int(thermia_write_queue_t *queue, const char *name, int value);
+bool thermia_write_queue_set_handle(thermia_write_queue_t *queue, thermia_modbus_handle_t handle, int value);
+int thermia_write_queue_pending(thermia_write_queue_t *queue);
+int thermia_write_queue_next_ms(thermia_write_queue_t *queue);
+int thermia_write_queue_flush(thermia_write_queue_t *queue, bool force);
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Fleet: many heat pumps polled by a fixed pool of worker threads, each unit read in full every interval into its own
+ * context's cache (read it with the cache functions; the context is NULL until the unit first connects, then stays).
+ * A slow or offline unit holds at most one worker while the rest keep to schedule, and is retried with a growing
+ * backoff until it answers. Status reports per unit lag: how late its last poll started and how far behind schedule
+ * it is now, plus the age of its last successful poll (UINT32_MAX if none yet).
+ */
+typedef struct {
+    const char *address;
+    int port;
+    model_t model;
+} thermia_fleet_device_t;
+
+typedef struct {
+    bool online;
+    uint64_t polls, failures;
+    uint32_t lag_ms, lag_max_ms, duration_ms; // of polls done
+    uint32_t behind_ms, age_ms;               // now
+} thermia_fleet_status_t;
+
+typedef struct thermia_fleet thermia_fleet_t;
+
+thermia_fleet_t *thermia_fleet_create(const thermia_fleet_device_t *devices, int count, int workers, int interval_ms);
+void thermia_fleet_destroy(thermia_fleet_t *fleet);
+thermia_modbus_t *thermia_fleet_context(thermia_fleet_t *fleet, int device);
+bool thermia_fleet_status(thermia_fleet_t *fleet, int device, thermia_fleet_status_t *status);
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Shared memory snapshots: the process polling the controller creates a named POSIX shared memory segment (e.g.
+ * "/thermia") and publishes its context cache after each poll; local readers open it by name and take consistent
+ * snapshots of every register without syscalls or controller traffic. Snapshots are indexed by handle and sized by
+ * thermia_modbus_register_count(); read times are CLOCK_MONOTONIC in ms. The generation counts publishes that carried
+ * new reads, so a reader can skip unchanged snapshots. Snapshot returns false if nothing was published yet or the
+ * publisher kept the segment busy. Create fails while another live process publishes under the same name, and
+ * replaces a segment whose publisher exited without closing it; readers of that one must reopen to follow. Closing
+ * the publisher removes the segment.
+ */
+typedef struct thermia_shm thermia_shm_t;
+
+thermia_shm_t *thermia_shm_create(thermia_modbus_t *ctx, const char *name);
+bool thermia_shm_publish(thermia_shm_t *shm);
+thermia_shm_t *thermia_shm_open(const char *name);
+void thermia_shm_close(thermia_shm_t *shm);
+model_t thermia_shm_model(const thermia_shm_t *shm);
+bool thermia_shm_snapshot(const thermia_shm_t *shm, int *values, bool *valid, uint64_t *updated_ms, uint32_t *generation);
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Recorder: call record after each poll to append a compact binary frame (time plus the registers changed beyond their
+ * cache deadband since the previous frame, delta encoded) to 'path'. Once the file reaches 'rotate_bytes' (0 never
+ * rotates) it moves to path.1, path.1 to path.2 and so on, keeping 'rotate_keep' old files; an existing file at open
+ * is rotated too. Every file starts with a key frame and replays on its own.
+ *
+ * Replay: maps one recording and steps through its frames. Next returns the number of registers changed in the frame
+ * (filling up to 'changed_max' handles) and its time in ms since the epoch, or -1 at the end of the recording; get
+ * returns the value of a register as of the current frame.
+ */
+typedef struct thermia_recorder thermia_recorder_t;
+typedef struct thermia_replay thermia_replay_t;
+
+thermia_recorder_t *thermia_recorder_open(thermia_modbus_t *ctx, const char *path, size_t rotate_bytes, int rotate_keep);
+void thermia_recorder_close(thermia_recorder_t *recorder);
+bool thermia_recorder_record(thermia_recorder_t *recorder);
+thermia_replay_t *thermia_replay_open(const char *path);
+void thermia_replay_close(thermia_replay_t *replay);
+model_t thermia_replay_model(const thermia_replay_t *replay);
+int thermia_replay_next(thermia_replay_t *replay, uint64_t *time_ms, thermia_modbus_handle_t *changed, int changed_max);
+bool thermia_replay_get(const thermia_replay_t *replay, thermia_modbus_handle_t handle, int *value);
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * MQTT publisher (only when built with THERMIA_MQTT, otherwise open fails): call publish after each poll to send the
+ * registers changed since the previous publish, scaled, as one JSON '<prefix>/state' message keyed by
+ * 'system/subsystem/name' (prefix NULL for "thermia", port 0 for 1883). The broker connection is made on the first
+ * publish and kept, reconnecting as needed; a retained '<prefix>/config' message describing the registers goes out
+ * once, when first connected. Publish options: QoS 0..2, whether state messages are retained, and every how many state
+ * messages one carries every value (0 for only the first, default). Returns false if the state could not be sent yet.
+ */
+typedef struct thermia_mqtt thermia_mqtt_t;
+
+thermia_mqtt_t *thermia_mqtt_open(thermia_modbus_t *ctx, const char *host, int port, const char *prefix);
+void thermia_mqtt_close(thermia_mqtt_t *mqtt);
+bool thermia_mqtt_set_auth(thermia_mqtt_t *mqtt, const char *username, const char *password);
+bool thermia_mqtt_set_publish(thermia_mqtt_t *mqtt, int qos, bool retain, int full_every);
+bool thermia_mqtt_publish(thermia_mqtt_t *mqtt);
+
+// ------------------------------------------------------------------------------------------------------------------------
+// ------------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Prometheus exporter: an HTTP endpoint (address NULL for any) answering 'GET /metrics' from the context cache, one
+ * gauge per supported register, scaled; scrapes never touch the controller, so keep the cache fresh by polling. Single
+ * threaded: wait on the fd with poll/epoll or let dispatch wait (timeout in ms, -1 for as long as needed; dispatch
+ * wakes earlier to close clients stalled for 10 s). Dispatch returns the number of scrapes served, or -1 on failure.
+ */
+typedef struct thermia_exporter thermia_exporter_t;
+
+thermia_exporter_t *thermia_exporter_open(thermia_modbus_t *ctx, const char *address, int port);
+void thermia_exporter_close(thermia_exporter_t *exporter);
+int thermia_exporter_fd(const thermia_exporter_t *exporter);
+int thermia_exporter_dispatch(thermia_exporter_t *exporter, int timeout_ms);
 
 // ------------------------------------------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------------------------------------------
@@ -1,444 +1,900 @@
 // Auto-generated from CSV - do not edit manually
-// Generated: 2025-11-25T16:45:53.728Z
+// Generated: 2026-10-14T11:33:47.493Z
 
 /* clang-format off */
 
-{"enableHeatpumpResetAllAlarms", REG_COIL_STATUS, 3, 4, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Reset all alarms"},
-{"enableHeatpumpInternalAdditionalHeater", REG_COIL_STATUS, 4, 5, 1, MODEL_INVERTER, "Heatpump", "Unit", "Enable internal additional heater"},
-{"enableHeatpumpExternalAdditionalHeater", REG_COIL_STATUS, 5, 6, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable external additional heater"},
-{"enableTapwaterHgw", REG_COIL_STATUS, 6, 7, 1, MODEL_INVERTER, "Tapwater", "HGW", "Enable HGW"},
-{"enableHeatpumpFlowPressureSwitch", REG_COIL_STATUS, 7, 8, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable flow switch/pressure switch"},
-{"enableHeatpumpTapWater", REG_COIL_STATUS, 8, 9, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable tap water"},
-{"enableHeatpumpHeat", REG_COIL_STATUS, 9, 10, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable heat"},
-{"enableCoolingActiveCooling", REG_COIL_STATUS, 10, 11, 1, MODEL_MEGA | MODEL_INVERTER, "Cooling", "Unit", "Enable active cooling"},
-{"enableHeatingMixValve1", REG_COIL_STATUS, 11, 12, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Enable mix valve 1"},
-{"enableTapwaterTwc", REG_COIL_STATUS, 12, 13, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "Enable TWC"}, {"enableTapwaterWcs", REG_COIL_STATUS, 13, 14, 1, MODEL_MEGA, "Tapwater", "WCS", "Enable WCS"},
-{"enableTapwaterHotGasPump", REG_COIL_STATUS, 14, 15, 1, MODEL_MEGA, "Tapwater", "Unit", "Enable hot gas pump"},
-{"enableHeatingMixValve2", REG_COIL_STATUS, 16, 17, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Enable mix valve 2 (EM)"},
-{"enableHeatingMixValve3", REG_COIL_STATUS, 17, 18, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Enable mix valve 3 (EM)"},
-{"enableHeatingMixValve4", REG_COIL_STATUS, 18, 19, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Enable mix valve 4 (EM)"},
-{"enableHeatingMixValve5", REG_COIL_STATUS, 19, 20, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Enable mix valve 5 (EM)"},
-{"enableHeatpumpBrineOutMonitoring", REG_COIL_STATUS, 20, 21, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable brine out monitoring"},
-{"enableHeatpumpBrinePumpContinuousOperation", REG_COIL_STATUS, 21, 22, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable brine pump continuous operation"},
-{"enableHeatpumpSystemCirculationPump", REG_COIL_STATUS, 22, 23, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable system circulation pump"},
-{"enableCoolingDewPointCalculation", REG_COIL_STATUS, 23, 24, 1, MODEL_MEGA, "Cooling", "CoolingCircuit", "Enable dew point calculation"},
-{"enableTapwaterAntiLegionella", REG_COIL_STATUS, 24, 25, 1, MODEL_INVERTER, "Tapwater", "Unit", "Enable anti legionella"},
-{"enableHeatpumpAdditionalHeaterOnly", REG_COIL_STATUS, 25, 26, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable additional heater only (No compressor). Requires Operation mode: Standby"},
-{"enableElectricCurrentLimitation", REG_COIL_STATUS, 26, 27, 1, MODEL_INVERTER, "Electric", "Unit", "Enable current limitation"},
-{"enablePoolPool", REG_COIL_STATUS, 28, 29, 1, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Enable pool (EM)"},
-{"enableCoolingSurplusHeatChiller", REG_COIL_STATUS, 29, 30, 1, MODEL_MEGA, "Cooling", "SurplusHeat", "Enable surplus heat, chiller (no borehole)"},
-{"enableCoolingSurplusHeatBorehole", REG_COIL_STATUS, 30, 31, 1, MODEL_MEGA, "Cooling", "Unit", "Enable surplus heat, borehole (no chiller)"},
-{"enablePoolExternalAdditionalHeater", REG_COIL_STATUS, 31, 32, 1, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Enable external additional heater for pool (EM)"},
-{"enablePoolInternalAdditionalHeater", REG_COIL_STATUS, 32, 33, 1, MODEL_INVERTER, "Pool", "Unit", "Enable internal additional heater for pool (EM)"},
-{"enableCoolingPassiveCooling", REG_COIL_STATUS, 33, 34, 1, MODEL_MEGA | MODEL_INVERTER, "Cooling", "Unit", "Enable passive cooling (EM)"},
-{"enableHeatpumpVariableSpeedCondenserPump", REG_COIL_STATUS, 34, 35, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable variable speed mode for condenser pump"},
-{"enableHeatpumpVariableSpeedBrinePump", REG_COIL_STATUS, 35, 36, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable variable speed mode for brine pump"},
-{"enableHeatingMixValve1CoolingMode", REG_COIL_STATUS, 36, 37, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Enable cooling mode for mixing valve 1"},
-{"enableHeatingMixValve1OutdoorTempCooling", REG_COIL_STATUS, 37, 38, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Enable outdoor temp dependent for cooling with mixing valve 1"},
-{"enableHeatingMixValve1BrinePumpOnCooling", REG_COIL_STATUS, 38, 39, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Enable internal brine pump to start when cooling is active for mixing valve 1"},
-{"enableHeatpumpOutdoorTempExternalHeater", REG_COIL_STATUS, 39, 40, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable outdoor temp dependent for external heater"},
-{"enableHeatpumpBrineInMonitoring", REG_COIL_STATUS, 40, 41, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable brine in monitoring"},
-{"enableHeatingFixedSystemSupplySetPoint", REG_COIL_STATUS, 41, 42, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Enable fixed system supply set point, allows defacto address 40117"},
-{"enableHeatpumpEvaporatorFreezeProtection", REG_COIL_STATUS, 42, 43, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Enable evaporator freeze protection"},
-{"enableHeatingMixValve2OutdoorTempCooling", REG_COIL_STATUS, 43, 44, 1, MODEL_MEGA, "Heating", "MixValve2", "Enable outdoor temp dependent for cooling with mixing valve 2 (EM3 only)"},
-{"enableHeatingMixValve2DewPointCalculation", REG_COIL_STATUS, 44, 45, 1, MODEL_MEGA, "Heating", "MixValve2", "Enable dew point calculation on mixing valve 2, requires room sensor for mixing valve 2 (EM3 only)"},
-{"enableHeatingMixValve2OutdoorTempHeating", REG_COIL_STATUS, 45, 46, 1, MODEL_MEGA, "Heating", "MixValve2", "Enable outdoor temp dependent for heating with mixing valve 2 (EM3 only)"},
-{"enableHeatingMixValve3OutdoorTempCooling", REG_COIL_STATUS, 46, 47, 1, MODEL_MEGA, "Heating", "MixValve3", "Enable outdoor temp dependent for cooling with mixing valve 3 (EM3 only)"},
-{"enableHeatingMixValve3DewPointCalculation", REG_COIL_STATUS, 47, 48, 1, MODEL_MEGA, "Heating", "MixValve3", "Enable dew point calculation on mixing valve 3, requires room sensor for mixing valve 3 (EM3 only)"},
-{"enableHeatingMixValve3OutdoorTempHeating", REG_COIL_STATUS, 48, 49, 1, MODEL_MEGA, "Heating", "MixValve3", "Enable outdoor temp dependent for heating with mixing valve 3 (EM3 only)"},
-{"enableHeatingMixValve4OutdoorTempCooling", REG_COIL_STATUS, 49, 50, 1, MODEL_MEGA, "Heating", "MixValve4", "Enable outdoor temp dependent for cooling with mixing valve 4 (EM3 only)"},
-{"enableHeatingMixValve4DewPointCalculation", REG_COIL_STATUS, 50, 51, 1, MODEL_MEGA, "Heating", "MixValve4", "Enable dew point calculation on mixing valve 4, requires room sensor for mixing valve 4 (EM3 only)"},
-{"enableHeatingMixValve4OutdoorTempHeating", REG_COIL_STATUS, 51, 52, 1, MODEL_MEGA, "Heating", "MixValve4", "Enable outdoor temp dependent for heating with mixing valve 4 (EM3 only)"},
-{"enableHeatingMixValve5OutdoorTempCooling", REG_COIL_STATUS, 52, 53, 1, MODEL_MEGA, "Heating", "MixValve5", "Enable outdoor temp dependent for cooling with mixing valve 5 (EM3 only)"},
-{"enableHeatingMixValve5DewPointCalculation", REG_COIL_STATUS, 53, 54, 1, MODEL_MEGA, "Heating", "MixValve5", "Enable dew point calculation on mixing valve 5, requires room sensor for mixing valve 5 (EM3 only)"},
-{"enableHeatingMixValve5OutdoorTempHeating", REG_COIL_STATUS, 54, 55, 1, MODEL_MEGA, "Heating", "MixValve5", "Enable outdoor temp dependent for heating with mixing valve 5 (EM3 only)"},
-{"enableHeatingMixValve2BrinePumpOnCooling", REG_COIL_STATUS, 55, 56, 1, MODEL_MEGA, "Heating", "MixValve2", "Enable internal brine pump to start when cooling is active for mixing valve 2 (EM3 only)"},
-{"enableHeatingMixValve3BrinePumpOnCooling", REG_COIL_STATUS, 56, 57, 1, MODEL_MEGA, "Heating", "MixValve3", "Enable internal brine pump to start when cooling is active for mixing valve 3 (EM3 only)"},
-{"enableHeatingMixValve4BrinePumpOnCooling", REG_COIL_STATUS, 57, 58, 1, MODEL_MEGA, "Heating", "MixValve4", "Enable internal brine pump to start when cooling is active for mixing valve 4 (EM3 only)"},
-{"enableHeatingMixValve5BrinePumpOnCooling", REG_COIL_STATUS, 58, 59, 1, MODEL_MEGA, "Heating", "MixValve5", "Enable internal brine pump to start when cooling is active for mixing valve 5 (EM3 only)"},
-{"alarmHeatpumpClassA", REG_INPUT_STATUS, 0, 10001, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Alarm active, Class: A"},
-{"alarmHeatpumpClassB", REG_INPUT_STATUS, 1, 10002, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Alarm active, Class: B"},
-{"alarmHeatpumpClassC", REG_INPUT_STATUS, 2, 10003, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Alarm active, Class: C"},
-{"alarmHeatpumpClassDGenesisSecondary", REG_INPUT_STATUS, 3, 10004, 1, MODEL_MEGA, "Heatpump", "Unit", "Alarm active, Class: D - Genesis secondary"},
-{"alarmHeatpumpClassELegacySecondary", REG_INPUT_STATUS, 4, 10005, 1, MODEL_MEGA, "Heatpump", "Unit", "Alarm active, Class: E - Legacy secondary"},
-{"alarmHeatpumpHighPressureSwitch", REG_INPUT_STATUS, 9, 10010, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "High pressure switch alarm"},
-{"alarmHeatpumpLowPressureLevel", REG_INPUT_STATUS, 10, 10011, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Low pressure level alarm"},
-{"alarmHeatpumpHighDischargePipeTemperature", REG_INPUT_STATUS, 11, 10012, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "High discharge pipe temperature alarm"},
-{"alarmHeatpumpOperatingPressureLimit", REG_INPUT_STATUS, 12, 10013, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Operating pressure limit indication"},
-{"alarmHeatpumpDischargePipeSensor", REG_INPUT_STATUS, 13, 10014, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Discharge pipe sensor alarm"},
-{"alarmHeatpumpLiquidLineSensor", REG_INPUT_STATUS, 14, 10015, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Liquid line sensor alarm"},
-{"alarmHeatpumpSuctionGasSensor", REG_INPUT_STATUS, 15, 10016, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Suction gas sensor alarm"},
-{"alarmHeatpumpFlowPressureSwitch", REG_INPUT_STATUS, 16, 10017, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Flow/pressure switch alarm"},
-{"alarmHeatpumpPowerInputPhaseDetection", REG_INPUT_STATUS, 22, 10023, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Power input phase detection alarm"},
-{"alarmHeatpumpInverterUnit", REG_INPUT_STATUS, 23, 10024, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Inverter unit alarm"},
-{"alarmHeatingSystemSupplyLowTemperature", REG_INPUT_STATUS, 24, 10025, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "System supply low temperature alarm"},
-{"alarmHeatpumpCompressorLowSpeed", REG_INPUT_STATUS, 25, 10026, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor low speed alarm"},
-{"alarmHeatpumpLowSuperHeat", REG_INPUT_STATUS, 26, 10027, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Low super heat alarm"},
-{"alarmHeatpumpPressureRatioOutOfRange", REG_INPUT_STATUS, 27, 10028, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Pressure ratio out of range alarm"},
-{"alarmHeatpumpCompressorPressureOutsideEnvelope", REG_INPUT_STATUS, 28, 10029, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor pressure outside envelope alarm"},
-{"alarmHeatpumpBrineTemperatureOutOfRange", REG_INPUT_STATUS, 29, 10030, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine temperature out of range alarm"},
-{"alarmHeatpumpBrineInSensor", REG_INPUT_STATUS, 30, 10031, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine in sensor alarm"},
-{"alarmHeatpumpBrineOutSensor", REG_INPUT_STATUS, 31, 10032, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine out sensor alarm"},
-{"alarmHeatpumpCondenserInSensor", REG_INPUT_STATUS, 32, 10033, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Condenser in sensor alarm"},
-{"alarmHeatpumpCondenserOutSensor", REG_INPUT_STATUS, 33, 10034, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Condenser out sensor alarm"},
-{"alarmHeatpumpOutdoorSensor", REG_INPUT_STATUS, 34, 10035, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Outdoor sensor alarm"},
-{"alarmHeatingSystemSupplyLineSensor", REG_INPUT_STATUS, 35, 10036, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "System supply line sensor alarm"},
-{"alarmHeatingMixValve1SupplyLineSensor", REG_INPUT_STATUS, 36, 10037, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Mix valve 1 supply line sensor alarm"},
-{"alarmHeatingMixValve2SupplyLineSensor", REG_INPUT_STATUS, 37, 10038, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Mix valve 2 supply line sensor alarm (EM)"},
-{"alarmHeatingMixValve3SupplyLineSensor", REG_INPUT_STATUS, 38, 10039, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Mix valve 3 supply line sensor alarm (EM)"},
-{"alarmHeatingMixValve4SupplyLineSensor", REG_INPUT_STATUS, 39, 10040, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Mix valve 4 supply line sensor alarm (EM)"},
-{"alarmHeatingMixValve5SupplyLineSensor", REG_INPUT_STATUS, 40, 10041, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Mix valve 5 supply line sensor alarm (EM)"},
-{"alarmTapwaterWcsReturnLineSensor", REG_INPUT_STATUS, 44, 10045, 1, MODEL_MEGA, "Tapwater", "WCS", "WCS return line sensor alarm (EM)"},
-{"alarmTapwaterTwcSupplyLineSensor", REG_INPUT_STATUS, 45, 10046, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC supply line sensor alarm (EM)"},
-{"alarmCoolingTankSensor", REG_INPUT_STATUS, 46, 10047, 1, MODEL_MEGA, "Cooling", "CoolingTank", "Cooling tank sensor alarm (EM)"},
-{"alarmCoolingSupplyLineSensor", REG_INPUT_STATUS, 47, 10048, 1, MODEL_MEGA | MODEL_INVERTER, "Cooling", "CoolingTank", "Cooling supply line sensor alarm (EM)"},
-{"alarmCoolingCircuitReturnLineSensor", REG_INPUT_STATUS, 48, 10049, 1, MODEL_MEGA, "Cooling", "CoolingCircuit", "Cooling circuit return line sensor alarm (EM)"},
-{"alarmHeatpumpBrineDeltaOutOfRange", REG_INPUT_STATUS, 49, 10050, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine delta out of range alarm"},
-{"alarmTapwaterMidSensor", REG_INPUT_STATUS, 50, 10051, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "Unit", "Tap water mid sensor alarm"},
-{"alarmTapwaterTwcCirculationReturnSensor", REG_INPUT_STATUS, 51, 10052, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC circulation return sensor alarm (EM)"},
-{"alarmTapwaterHgwSensor", REG_INPUT_STATUS, 52, 10053, 1, MODEL_INVERTER, "Tapwater", "HGW", "HGW sensor alarm"},
-{"alarmHeatpumpInternalAdditionalHeater", REG_INPUT_STATUS, 53, 10054, 1, MODEL_INVERTER, "Heatpump", "Unit", "Internal additional heater alarm"},
-{"alarmHeatpumpBrineInHighTemperature", REG_INPUT_STATUS, 55, 10056, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine in high temperature alarm"},
-{"alarmHeatpumpBrineInLowTemperature", REG_INPUT_STATUS, 56, 10057, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine in low temperature alarm"},
-{"alarmHeatpumpBrineOutLowTemperature", REG_INPUT_STATUS, 57, 10058, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine out low temperature alarm"},
-{"alarmTapwaterTwcCirculationReturnLowTemperature", REG_INPUT_STATUS, 58, 10059, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC circulation return low temperature alarm (EM)"},
-{"alarmTapwaterTwcSupplyLowTemperature", REG_INPUT_STATUS, 59, 10060, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC supply low temperature alarm (EM)"},
-{"alarmHeatingMixValve1SupplyTemperatureDeviation", REG_INPUT_STATUS, 60, 10061, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Mix valve 1 supply temperature deviation alarm"},
-{"alarmHeatingMixValve2SupplyTemperatureDeviation", REG_INPUT_STATUS, 61, 10062, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Mix valve 2 supply temperature deviation alarm (EM)"},
-{"alarmHeatingMixValve3SupplyTemperatureDeviation", REG_INPUT_STATUS, 62, 10063, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Mix valve 3 supply temperature deviation alarm (EM)"},
-{"alarmHeatingMixValve4SupplyTemperatureDeviation", REG_INPUT_STATUS, 63, 10064, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Mix valve 4 supply temperature deviation alarm (EM)"},
-{"alarmHeatingMixValve5SupplyTemperatureDeviation", REG_INPUT_STATUS, 64, 10065, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Mix valve 5 supply temperature deviation alarm (EM)"},
-{"alarmTapwaterWcsReturnLineTemperatureDeviation", REG_INPUT_STATUS, 65, 10066, 1, MODEL_MEGA, "Tapwater", "WCS", "WCS return line temperature deviation alarm (EM)"},
-{"alarmHeatpumpSum", REG_INPUT_STATUS, 66, 10067, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Sum alarm"},
-{"alarmCoolingCircuitSupplyLineTemperatureDeviation", REG_INPUT_STATUS, 67, 10068, 1, MODEL_MEGA, "Cooling", "CoolingCircuit", "Cooling circuit supply line temperature deviation alarm (EM)"},
-{"alarmCoolingTankTemperatureDeviation", REG_INPUT_STATUS, 68, 10069, 1, MODEL_MEGA, "Cooling", "CoolingTank", "Cooling tank temperature deviation alarm (EM)"},
-{"alarmCoolingSurplusHeatTemperatureDeviation", REG_INPUT_STATUS, 69, 10070, 1, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat temperature deviation alarm (EM)"},
-{"alarmCoolingHumidityRoomSensor", REG_INPUT_STATUS, 70, 10071, 1, MODEL_MEGA, "Cooling", "CoolingCircuit", "Humidity room sensor alarm"},
-{"alarmCoolingSurplusHeatSupplyLineSensor", REG_INPUT_STATUS, 71, 10072, 1, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat supply line sensor alarm (EM)"},
-{"alarmCoolingSurplusHeatReturnLineSensor", REG_INPUT_STATUS, 72, 10073, 1, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat return line sensor alarm (EM)"},
-{"alarmCoolingTankReturnLineSensor", REG_INPUT_STATUS, 73, 10074, 1, MODEL_MEGA, "Cooling", "CoolingTank", "Cooling tank return line sensor alarm (EM)"},
-{"alarmHeatingTemperatureRoomSensor", REG_INPUT_STATUS, 74, 10075, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Temperature room sensor alarm"},
-{"alarmHeatpumpInverterUnitCommunication", REG_INPUT_STATUS, 75, 10076, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Inverter unit communication alarm"},
-{"alarmPoolReturnLineSensor", REG_INPUT_STATUS, 76, 10077, 1, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Pool return line sensor alarm"},
-{"statusPoolExternalStop", REG_INPUT_STATUS, 77, 10078, 1, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "External stop for pool, read only"},
-{"statusCoolingExternalStartBrinePump", REG_INPUT_STATUS, 78, 10079, 1, MODEL_MEGA | MODEL_INVERTER, "Cooling", "Unit", "External start brine pump, read only"},
-{"statusHeatpumpExternalRelayBrineGroundWaterPump", REG_INPUT_STATUS, 79, 10080, 1, MODEL_MEGA, "Heatpump", "Unit", "External relay for brine/ground water pump."},
-{"alarmTapwaterEndTankSensor", REG_INPUT_STATUS, 81, 10082, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "Tap water end tank sensor alarm"},
-{"alarmTapwaterMaxTimeAntiLegionellaExceeded", REG_INPUT_STATUS, 82, 10083, 1, MODEL_INVERTER, "Tapwater", "Unit", "Maximum time for anti-legionella exceeded alarm"},
-{"alarmHeatpumpGenesisSecondaryUnitCommunication", REG_INPUT_STATUS, 83, 10084, 1, MODEL_MEGA, "Heatpump", "Unit", "Genesis secondary unit alarm - this specific secondary unit can't communicate with its primary unit"},
-{"alarmHeatpumpPrimaryUnitNetworkConflict", REG_INPUT_STATUS, 84, 10085, 1, MODEL_MEGA, "Heatpump", "Unit", "Primary unit alarm - the primary has detected other primary units on the same network with a network mask that is allowing conflict. Change network settings in order to avoid problem. For instance change port number on the primary " "and its secondary unit."},
-{"alarmHeatpumpPrimaryUnitSecondariesNotDetected", REG_INPUT_STATUS, 85, 10086, 1, MODEL_MEGA, "Heatpump", "Unit", "Primary unit alarm - the primary has not detected all secondary units. Make sure that the primary/secondary settings are correct and the network mask and port and number of Genesis secondaries settings are correct."},
-{"statusHeatpumpOilBoostInProgress", REG_INPUT_STATUS, 86, 10087, 1, MODEL_INVERTER, "Heatpump", "Unit", "Oil boost in progress"},
-{"statusHeatpumpCompressorControl", REG_INPUT_STATUS, 199, 10200, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor control signal"},
-{"statusHeatpumpSmartGrid1Evu", REG_INPUT_STATUS, 201, 10202, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Smart Grid 1, EVU input"},
-{"statusHeatpumpExternalAlarmInput", REG_INPUT_STATUS, 202, 10203, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "External alarm input"},
-{"statusHeatpumpSmartGrid2", REG_INPUT_STATUS, 204, 10205, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Smart Grid 2"},
-{"statusHeatpumpExternalAdditionalHeaterControl", REG_INPUT_STATUS, 206, 10207, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "External additional heater control signal"},
-{"statusHeatingMixValve1CirculationPumpControl", REG_INPUT_STATUS, 209, 10210, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Mix valve 1 circulation pump control signal"},
-{"statusHeatpumpCondenserPumpOnOff", REG_INPUT_STATUS, 210, 10211, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Condenser pump On/off control"},
-{"statusHeatingSystemCirculationPumpControl", REG_INPUT_STATUS, 211, 10212, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "System circulation pump control signal"},
-{"statusTapwaterHotGasCirculationPumpControl", REG_INPUT_STATUS, 213, 10214, 1, MODEL_MEGA, "Tapwater", "Unit", "Hot gas circulation pump control signal"},
-{"statusHeatpumpBrinePumpOnOff", REG_INPUT_STATUS, 218, 10219, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine pump On/off control"},
-{"statusHeatpumpExternalHeaterCirculationPumpControl", REG_INPUT_STATUS, 219, 10220, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "External heater circulation pump control signal"},
-{"statusHeatingSeasonWinterActive", REG_INPUT_STATUS, 220, 10221, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Heating season (winter) active"},
-{"statusHeatpumpExternalAdditionalHeaterActive", REG_INPUT_STATUS, 221, 10222, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "External additional heater active"},
-{"statusHeatpumpInternalAdditionalHeaterActive", REG_INPUT_STATUS, 222, 10223, 1, MODEL_INVERTER, "Heatpump", "Unit", "Internal additional heater active"},
-{"statusTapwaterHgwRegulationControl", REG_INPUT_STATUS, 223, 10224, 1, MODEL_INVERTER, "Tapwater", "HGW", "HGW regulation control signal"},
-{"statusHeatpumpStopping", REG_INPUT_STATUS, 224, 10225, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Heat pump stopping"},
-{"statusHeatpumpOkToStart", REG_INPUT_STATUS, 225, 10226, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Heat pump OK to start"},
-{"statusTapwaterTwcSupplyLineCirculationPumpControl", REG_INPUT_STATUS, 230, 10231, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC supply line circulation pump control signal (EM)"},
-{"statusTapwaterWcsRegulationControl", REG_INPUT_STATUS, 232, 10233, 1, MODEL_MEGA, "Tapwater", "WCS", "WCS regulation control signal (EM)"},
-{"statusTapwaterWcsCirculationPumpControl", REG_INPUT_STATUS, 233, 10234, 1, MODEL_MEGA, "Tapwater", "WCS", "WCS circulation pump control signal (EM)"},
-{"statusTapwaterTwcEndTankHeaterControl", REG_INPUT_STATUS, 234, 10235, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC end tank heater control signal (EM)"},
-{"statusPoolDirectionalValvePosition", REG_INPUT_STATUS, 235, 10236, 1, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Pool directional valve position (EM)"},
-{"statusCoolingCircuitCirculationPumpControl", REG_INPUT_STATUS, 236, 10237, 1, MODEL_MEGA, "Cooling", "CoolingCircuit", "Cooling circuit circulation pump control signal (EM)"},
-{"statusPoolCirculationPumpControl", REG_INPUT_STATUS, 237, 10238, 1, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Pool circulation pump control signal (EM)"},
-{"statusCoolingSurplusHeatDirectionalValvePosition", REG_INPUT_STATUS, 238, 10239, 1, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat directional valve position (EM)"},
-{"statusCoolingSurplusHeatCirculationPumpControl", REG_INPUT_STATUS, 239, 10240, 1, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat circulation pump control signal (EM)"},
-{"statusCoolingCircuitRegulationControl", REG_INPUT_STATUS, 240, 10241, 1, MODEL_MEGA, "Cooling", "CoolingCircuit", "Cooling circuit regulation control signal (EM)"},
-{"statusCoolingSurplusHeatRegulationControl", REG_INPUT_STATUS, 241, 10242, 1, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat regulation control signal (EM)"},
-{"statusCoolingActiveCoolingDirectionalValvePosition", REG_INPUT_STATUS, 242, 10243, 1, MODEL_MEGA, "Cooling", "CoolingTank", "Active cooling directional valve position (Borehole disconnected) (EM)"},
-{"statusCoolingPassiveActiveCoolingDirectionalValvePosition", REG_INPUT_STATUS, 243, 10244, 1, MODEL_MEGA, "Cooling", "CoolingTank", "Passive/Active cooling directional valve position (Cooling tank connected) (EM)"},
-{"statusPoolRegulationControl", REG_INPUT_STATUS, 244, 10245, 1, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Pool regulation control signal (EM)"},
-{"statusHeatingMixValve1ProducingPassiveCooling", REG_INPUT_STATUS, 245, 10246, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Indication when mixing valve 1 is producing passive cooling"},
-{"statusHeatpumpCompressorUnableToSpeedUp", REG_INPUT_STATUS, 246, 10247, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor is unable to speed up"},
-{"valueHeatpumpCurrentlyRunningFirstPrioritisedDemand", REG_INPUT, 1, 30002, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Currently running: First prioritised demand *1"},
-{"valueHeatpumpCompressorAvailableGears", REG_INPUT, 4, 30005, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor available gears *3"},
-{"valueHeatpumpCompressorSpeedRpm", REG_INPUT, 5, 30006, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor speed RPM"},
-{"valueHeatpumpExternalAdditionalHeaterCurrentDemand", REG_INPUT, 6, 30007, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "External additional heater: Current demand (%)"},
-{"valueHeatpumpDischargePipeTemperature", REG_INPUT, 7, 30008, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Discharge pipe temperature"},
-{"valueHeatpumpCondenserInTemperature", REG_INPUT, 8, 30009, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Condenser in temperature"},
-{"valueHeatpumpCondenserOutTemperature", REG_INPUT, 9, 30010, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Condenser out temperature"},
-{"valueHeatpumpBrineInTemperature", REG_INPUT, 10, 30011, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine in temperature"},
-{"valueHeatpumpBrineOutTemperature", REG_INPUT, 11, 30012, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine out temperature"},
-{"valueHeatingSystemSupplyLineTemperature", REG_INPUT, 12, 30013, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "System supply line temperature"},
-{"valueHeatpumpOutdoorTemperature", REG_INPUT, 13, 30014, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Outdoor temperature"},
-{"valueTapwaterTopTemperature", REG_INPUT, 15, 30016, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "Unit", "Tap water top temperature"},
-{"valueTapwaterLowerTemperature", REG_INPUT, 16, 30017, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "Unit", "Tap water lower temperature"},
-{"valueTapwaterWeightedTemperature", REG_INPUT, 17, 30018, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "Unit", "Tap water weighted temperature"},
-{"valueHeatingSystemSupplyLineCalculatedSetPoint", REG_INPUT, 18, 30019, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "System supply line calculated set point"},
-{"valueHeatingSelectedHeatCurveSystemSupplyLine", REG_INPUT, 19, 30020, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Selected heat curve, (system) supply line"},
-{"valueHeatingHeatCurveXCoordinate1", REG_INPUT, 20, 30021, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Heat curve, X-coordinate 1 (highest outdoor temperature)"},
-{"valueHeatingHeatCurveXCoordinate2", REG_INPUT, 21, 30022, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Heat curve, X-coordinate 2"},
-{"valueHeatingHeatCurveXCoordinate3", REG_INPUT, 22, 30023, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Heat curve, X-coordinate 3"},
-{"valueHeatingHeatCurveXCoordinate4", REG_INPUT, 23, 30024, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Heat curve, X-coordinate 4"},
-{"valueHeatingHeatCurveXCoordinate5", REG_INPUT, 24, 30025, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Heat curve, X-coordinate 5"},
-{"valueHeatingHeatCurveXCoordinate6", REG_INPUT, 25, 30026, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Heat curve, X-coordinate 6"},
-{"valueHeatingHeatCurveXCoordinate7", REG_INPUT, 26, 30027, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Heat curve, X-coordinate 7 (lowest outdoor temperature)"},
-{"valueCoolingSeasonIntegralValue", REG_INPUT, 36, 30037, 1, MODEL_MEGA | MODEL_INVERTER, "Cooling", "Unit", "Cooling season integral value"},
-{"valueHeatpumpCondenserCirculationPumpSpeed", REG_INPUT, 39, 30040, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Condenser circulation pump speed (%)"},
-{"valueHeatingMixValve1SupplyLineTemperature", REG_INPUT, 40, 30041, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Mix valve 1 supply line temperature"},
-{"valueHeatingBufferTankTemperature", REG_INPUT, 41, 30042, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Buffer tank temperature"},
-{"valueHeatingMixValve1Position", REG_INPUT, 43, 30044, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Mix valve 1 position"},
-{"valueHeatpumpBrineCirculationPumpSpeed", REG_INPUT, 44, 30045, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine circulation pump speed (%)"},
-{"valueTapwaterHgwSupplyLineTemperature", REG_INPUT, 45, 30046, 100, MODEL_INVERTER, "Tapwater", "HGW", "HGW supply line temperature"},
-{"valueTapwaterHgwDirectionalValvePosition", REG_INPUT, 47, 30048, 1, MODEL_MEGA, "Tapwater", "HGW", "Hot water directional valve position (%)"},
-{"valueHeatpumpCompressorOperatingHoursMsb", REG_INPUT, 48, 30049, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor operating hours (MSB)"},
-{"valueHeatpumpCompressorOperatingHoursLsb", REG_INPUT, 49, 30050, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor operating hours (LSB)"},
-{"valueTapwaterOperatingHoursMsb", REG_INPUT, 50, 30051, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "Unit", "Tap water operating hours (MSB)"},
-{"valueTapwaterOperatingHoursLsb", REG_INPUT, 51, 30052, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "Unit", "Tap water operating hours (LSB)"},
-{"valueHeatpumpExternalAdditionalHeaterOperatingHoursMsb", REG_INPUT, 52, 30053, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "External additional heater operating hours (MSB)"},
-{"valueHeatpumpExternalAdditionalHeaterOperatingHoursLsb", REG_INPUT, 53, 30054, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "External additional heater operating hours (LSB)"},
-{"valueHeatpumpCompressorSpeedPercent", REG_INPUT, 54, 30055, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor speed percent"},
-{"valueHeatpumpCurrentlyRunningSecondPrioritisedDemand", REG_INPUT, 55, 30056, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Currently running: Second prioritised demand *1"},
-{"valueHeatpumpCurrentlyRunningThirdPrioritisedDemand", REG_INPUT, 56, 30057, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Currently running: Third prioritised demand *1"},
-{"valueHeatpumpSoftwareVersionMajor", REG_INPUT, 57, 30058, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Software version: Major"},
-{"valueHeatpumpSoftwareVersionMinor", REG_INPUT, 58, 30059, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Software version: Minor"},
-{"valueHeatpumpSoftwareVersionMicro", REG_INPUT, 59, 30060, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Software version: Micro"},
-{"valueHeatpumpCompressorTemporarilyBlocked", REG_INPUT, 60, 30061, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor temporarily blocked, (start restriction timer)"},
-{"valueHeatpumpCompressorCurrentGear", REG_INPUT, 61, 30062, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Compressor current gear"},
-{"valueHeatpumpQueuedDemandFirstPriority", REG_INPUT, 62, 30063, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Queued demand, first priority *1"},
-{"valueHeatpumpQueuedDemandSecondPriority", REG_INPUT, 63, 30064, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Queued demand, second priority *1"},
-{"valueHeatpumpQueuedDemandThirdPriority", REG_INPUT, 64, 30065, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Queued demand, third priority *1"},
-{"valueHeatpumpQueuedDemandFourthPriority", REG_INPUT, 65, 30066, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Queued demand, fourth priority *1"},
-{"valueHeatpumpQueuedDemandFifthPriority", REG_INPUT, 66, 30067, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Queued demand, fifth priority *1"},
-{"valueHeatpumpInternalAdditionalHeaterCurrentStep", REG_INPUT, 67, 30068, 1, MODEL_INVERTER, "Heatpump", "Unit", "Internal additional heater current step"},
-{"valueHeatingBufferTankChargeSetPoint", REG_INPUT, 68, 30069, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Buffer tank charge set point"},
-{"valueElectricMeterL1Current", REG_INPUT, 69, 30070, 100, MODEL_INVERTER, "Electric", "Unit", "Electric meter L1 current (A)"},
-{"valueElectricMeterL2Current", REG_INPUT, 70, 30071, 100, MODEL_INVERTER, "Electric", "Unit", "Electric meter L2 current (A)"},
-{"valueElectricMeterL3Current", REG_INPUT, 71, 30072, 100, MODEL_INVERTER, "Electric", "Unit", "Electric meter L3 current (A)"},
-{"valueElectricMeterL1ToNeutralVoltage", REG_INPUT, 72, 30073, 100, MODEL_INVERTER, "Electric", "Unit", "Electric meter L1-0 voltage (V)"},
-{"valueElectricMeterL2ToNeutralVoltage", REG_INPUT, 73, 30074, 100, MODEL_INVERTER, "Electric", "Unit", "Electric meter L2-0 voltage (V)"},
-{"valueElectricMeterL3ToNeutralVoltage", REG_INPUT, 74, 30075, 100, MODEL_INVERTER, "Electric", "Unit", "Electric meter L3-0 voltage (V)"},
-{"valueElectricMeterL1ToL2Voltage", REG_INPUT, 75, 30076, 10, MODEL_INVERTER, "Electric", "Unit", "Electric meter L1-L2 voltage (V)"},
-{"valueElectricMeterL2ToL3Voltage", REG_INPUT, 76, 30077, 10, MODEL_INVERTER, "Electric", "Unit", "Electric meter L2-L3 voltage (V)"},
-{"valueElectricMeterL3ToL1Voltage", REG_INPUT, 77, 30078, 10, MODEL_INVERTER, "Electric", "Unit", "Electric meter L3-L1 voltage (V)"},
-{"valueElectricMeterL1Power", REG_INPUT, 78, 30079, 1, MODEL_INVERTER, "Electric", "Unit", "Electric meter L1 power (W)"},
-{"valueElectricMeterL2Power", REG_INPUT, 79, 30080, 1, MODEL_INVERTER, "Electric", "Unit", "Electric meter L2 power (W)"},
-{"valueElectricMeterL3Power", REG_INPUT, 80, 30081, 1, MODEL_INVERTER, "Electric", "Unit", "Electric meter L3 power (W)"},
-{"valueElectricMeterValue", REG_INPUT, 81, 30082, 1, MODEL_INVERTER, "Electric", "Unit", "Electric meter - meter value (kWh)"},
-{"valueHeatpumpComfortMode", REG_INPUT, 82, 30083, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Comfort mode *4"},
-{"valueElectricMeterKwhTotalLsb", REG_INPUT, 83, 30084, 10, MODEL_INVERTER, "Electric", "Unit", "Electric meter kWh total (LSB)"},
-{"valueElectricMeterKwhTotalMsb", REG_INPUT, 84, 30085, 10, MODEL_INVERTER, "Electric", "Unit", "Electric meter kWh total (MSB)"},
-{"valueTapwaterWcsValvePosition", REG_INPUT, 85, 30086, 100, MODEL_MEGA, "Tapwater", "WCS", "WCS valve position (EM)"},
-{"valueTapwaterTwcValvePosition", REG_INPUT, 86, 30087, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC valve position (EM)"},
-{"valueHeatingMixValve2Position", REG_INPUT, 87, 30088, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Mix valve 2 position (EM)"},
-{"valueHeatingMixValve3Position", REG_INPUT, 88, 30089, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Mix valve 3 position (EM)"},
-{"valueHeatingMixValve4Position", REG_INPUT, 89, 30090, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Mix valve 4 position (EM)"},
-{"valueHeatingMixValve5Position", REG_INPUT, 90, 30091, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Mix valve 5 position (EM)"},
-{"valueCoolingDewPointRoom", REG_INPUT, 91, 30092, 100, MODEL_MEGA, "Cooling", "CoolingCircuit", "Dew point room (EM)"},
-{"valueCoolingSupplyLineMixValvePosition", REG_INPUT, 92, 30093, 100, MODEL_MEGA, "Cooling", "CoolingCircuit", "Cooling supply line mix valve position (EM)"},
-{"valueCoolingSurplusHeatFanSpeed", REG_INPUT, 93, 30094, 100, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat fan speed (EM)"},
-{"valuePoolSupplyLineMixValvePosition", REG_INPUT, 94, 30095, 100, MODEL_MEGA, "Pool", "Unit", "Pool supply line mix valve position (EM)"},
-{"valueTapwaterTwcSupplyLineTemperature", REG_INPUT, 95, 30096, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC supply line temperature (EM)"},
-{"valueTapwaterTwcReturnTemperature", REG_INPUT, 96, 30097, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC return temperature (EM)"},
-{"valueTapwaterWcsReturnLineTemperature", REG_INPUT, 97, 30098, 100, MODEL_MEGA, "Tapwater", "WCS", "WCS return line temperature (EM)"},
-{"valueTapwaterTwcEndTankTemperature", REG_INPUT, 98, 30099, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC end tank temperature (EM)"},
-{"valueHeatingMixValve2SupplyLineTemperature", REG_INPUT, 99, 30100, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Mix valve 2 supply line temperature (EM)"},
-{"valueHeatingMixValve3SupplyLineTemperature", REG_INPUT, 100, 30101, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Mix valve 3 supply line temperature (EM)"},
-{"valueHeatingMixValve4SupplyLineTemperature", REG_INPUT, 101, 30102, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Mix valve 4 supply line temperature (EM)"},
-{"valueCoolingCircuitReturnLineTemperature", REG_INPUT, 103, 30104, 100, MODEL_MEGA, "Cooling", "CoolingCircuit", "Cooling circuit return line temperature (EM)"},
-{"valueCoolingTankTemperature", REG_INPUT, 104, 30105, 100, MODEL_MEGA, "Cooling", "CoolingTank", "Cooling tank temperature (EM)"},
-{"valueCoolingTankReturnLineTemperature", REG_INPUT, 105, 30106, 100, MODEL_MEGA, "Cooling", "CoolingTank", "Cooling tank return line temperature (EM)"},
-{"valueCoolingCircuitSupplyLineTemperature", REG_INPUT, 106, 30107, 100, MODEL_MEGA, "Cooling", "CoolingCircuit", "Cooling circuit supply line temperature (EM)"},
-{"valueHeatingMixValve5SupplyLineTemperature", REG_INPUT, 107, 30108, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Mix valve 5 supply line temperature (EM)"},
-{"valueHeatingMixValve2ReturnLineTemperature", REG_INPUT, 109, 30110, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Mix valve 2 return line temperature (EM)"},
-{"valueHeatingMixValve3ReturnLineTemperature", REG_INPUT, 111, 30112, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Mix valve 3 return line temperature (EM)"},
-{"valueHeatingMixValve4ReturnLineTemperature", REG_INPUT, 113, 30114, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Mix valve 4 return line temperature (EM)"},
-{"valueHeatingMixValve5ReturnLineTemperature", REG_INPUT, 115, 30116, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Mix valve 5 return line temperature (EM)"},
-{"valueCoolingSurplusHeatReturnLineTemperature", REG_INPUT, 117, 30118, 100, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat return line temperature (EM)"},
-{"valueCoolingSurplusHeatSupplyLineTemperature", REG_INPUT, 118, 30119, 100, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat supply line temperature (EM)"},
-{"valuePoolSupplyLineTemperature", REG_INPUT, 119, 30120, 100, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Pool supply line temperature (EM)"},
-{"valuePoolReturnLineTemperature", REG_INPUT, 120, 30121, 100, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Pool return line temperature (EM)"},
-{"valueHeatingRoomTemperatureSensor", REG_INPUT, 121, 30122, 10, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Room temperature sensor"},
-{"valueHeatpumpBubblePointHighPressureTemperature", REG_INPUT, 122, 30123, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Bubble point, high pressure temperature"},
-{"valueHeatpumpDewPointHighPressureTemperature", REG_INPUT, 123, 30124, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Dew point, high pressure temperature"},
-{"valueHeatpumpDewPointLowPressureTemperature", REG_INPUT, 124, 30125, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Dew point, low pressure temperature"},
-{"valueHeatpumpSuperheatTemperature", REG_INPUT, 125, 30126, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Superheat temperature"},
-{"valueHeatpumpSubCoolingTemperature", REG_INPUT, 126, 30127, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Sub cooling temperature"},
-{"valueHeatpumpLowPressureSidePressure", REG_INPUT, 127, 30128, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Low pressure side, pressure (bar(g))"},
-{"valueHeatpumpHighPressureSidePressure", REG_INPUT, 128, 30129, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "High pressure side, pressure (bar(g))"},
-{"valueHeatpumpLiquidLineTemperature", REG_INPUT, 129, 30130, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Liquid line temperature"},
-{"valueHeatpumpSuctionGasTemperature", REG_INPUT, 130, 30131, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Suction gas temperature"},
-{"valueHeatingSeasonIntegralValue", REG_INPUT, 131, 30132, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Heating season integral value"},
-{"valueHeatpumpPidPValue", REG_INPUT, 132, 30133, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "P - value for gear shifting and demand calculation"},
-{"valueHeatpumpPidIValue", REG_INPUT, 133, 30134, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "I - value for gear shifting and demand calculation"},
-{"valueHeatpumpPidDValue", REG_INPUT, 134, 30135, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "D - value for gear shifting and demand calculation"},
-{"valueHeatpumpBufferTankIValue", REG_INPUT, 135, 30136, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "I - value for compressor ON/OFF (Buffer tank)"},
-{"valueHeatpumpBufferTankPValue", REG_INPUT, 136, 30137, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "P - value for compressor ON/OFF (Buffer tank)"},
-{"valueHeatingMixValveCoolingOpeningDegree", REG_INPUT, 137, 30138, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Mix valve cooling opening degree (EM2/3)"},
-{"valueTapwaterDesiredGear", REG_INPUT, 139, 30140, 1, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "Unit", "Desired gear for tap water"},
-{"valueHeatingDesiredGear", REG_INPUT, 140, 30141, 1, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Desired gear for heating"},
-{"valueCoolingDesiredGear", REG_INPUT, 141, 30142, 1, MODEL_MEGA | MODEL_INVERTER, "Cooling", "Unit", "Desired gear for cooling"},
-{"valuePoolDesiredGear", REG_INPUT, 142, 30143, 1, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Desired gear for pool"},
-{"valueHeatpumpNumberOfAvailableSecondariesGenesis", REG_INPUT, 143, 30144, 1, MODEL_MEGA, "Heatpump", "Unit", "Number of available secondaries Genesis"},
-{"valueHeatpumpNumberOfAvailableSecondariesLegacy", REG_INPUT, 144, 30145, 1, MODEL_MEGA, "Heatpump", "Unit", "Number of available secondaries Legacy"},
-{"valueHeatpumpTotalDistributedGearsAllUnits", REG_INPUT, 145, 30146, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Total distributed gears to all units"},
-{"valueHeatpumpMaximumGearCurrentlyRequested", REG_INPUT, 146, 30147, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Maximum gear out of all the currently requested gears"},
-{"valueHeatingMixValve1DesiredTemperature", REG_INPUT, 147, 30148, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Desired temperature distribution circuit Mix valve 1"},
-{"valueHeatingMixValve2DesiredTemperature", REG_INPUT, 148, 30149, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Desired temperature distribution circuit Mix valve 2"},
-{"valueHeatingMixValve3DesiredTemperature", REG_INPUT, 149, 30150, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Desired temperature distribution circuit Mix valve 3"},
-{"valueHeatingMixValve4DesiredTemperature", REG_INPUT, 150, 30151, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Desired temperature distribution circuit Mix valve 4"},
-{"valueHeatingMixValve5DesiredTemperature", REG_INPUT, 151, 30152, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Desired temperature distribution circuit Mix valve 5"},
-{"valueTapwaterHgwDisconnectEndTank", REG_INPUT, 152, 30153, 1, MODEL_MEGA, "Tapwater", "HGW", "Disconnect hot gas end tank, 0 = connected, 1 = disconnected"},
-{"valueHeatpumpLegacyCompressorRunning", REG_INPUT, 153, 30154, 1, MODEL_MEGA, "Heatpump", "Unit", "Legacy heat pump compressor running (bit field)"},
-{"valueHeatpumpLegacyReportingAlarm", REG_INPUT, 154, 30155, 1, MODEL_MEGA, "Heatpump", "Unit", "Legacy heat pump reporting alarm (bit field)"},
-{"valueHeatpumpLegacyStartSignal", REG_INPUT, 155, 30156, 1, MODEL_MEGA, "Heatpump", "Unit", "Legacy heat pump start signal (bit field)"},
-{"valueHeatpumpLegacyTapWaterSignal", REG_INPUT, 156, 30157, 1, MODEL_MEGA, "Heatpump", "Unit", "Legacy heat pump tap water signal (bit field)"},
-{"valueHeatpumpPrimaryUnitAlarmClassDCombined", REG_INPUT, 160, 30161, 1, MODEL_MEGA, "Heatpump", "Unit", "Primary unit alarm - the combined output of all Class D alarms. This signal is a bit field, one bit for each secondary heat pump unit."},
-{"valueHeatpumpPrimaryUnitAlarmLostCommunicationGenesis", REG_INPUT, 161, 30162, 1, MODEL_MEGA, "Heatpump", "Unit", "Primary unit alarm - the primary unit has lost communication with one or more Genesis secondaries. This signal is a bit field, one bit for each heat pump."},
-{"valueHeatpumpPrimaryUnitAlarmClassASecondary", REG_INPUT, 162, 30163, 1, MODEL_MEGA, "Heatpump", "Unit", "Primary unit alarm - Class A alarm detected on the Genesis secondary heat pump unit. This signal is a bit field, one bit for each secondary heat pump unit."},
-{"valueHeatpumpPrimaryUnitAlarmClassBSecondary", REG_INPUT, 163, 30164, 1, MODEL_MEGA, "Heatpump", "Unit", "Primary unit alarm - Class B alarm detected on the Genesis secondary heat pump unit. This signal is a bit field, one bit for each secondary heat pump unit."},
-{"valueHeatpumpPrimaryUnitAlarmClassECombined", REG_INPUT, 170, 30171, 1, MODEL_MEGA, "Heatpump", "Unit", "Primary unit alarm - the combined output of all Class E alarms. This signal is a bit field, one bit for each legacy secondary heat pump unit."},
-{"valueHeatpumpPrimaryUnitAlarmLegacyGeneral", REG_INPUT, 171, 30172, 1, MODEL_MEGA, "Heatpump", "Unit", "Primary unit alarm - general legacy heat pump alarm. This signal is a bit field, one bit for each legacy secondary heat pump unit. Detects if the sum alarm of the secondary unit is active."},
-{"valueHeatpumpPrimaryUnitAlarmLegacyExpansionCardCommunication", REG_INPUT, 173, 30174, 1, MODEL_MEGA, "Heatpump", "Unit", "Primary unit alarm - the primary unit can not communicate with the corresponding expansion card for the legacy heat pump. This signal is a bit field, one bit for each legacy secondary heat pump unit."},
-{"setHeatpumpOperationalMode", REG_HOLDING, 0, 40001, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Operational mode *2"},
-{"setHeatingMaxLimitationSetPointCurveRadiator", REG_HOLDING, 3, 40004, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Max limitation, set point curve radiator"},
-{"setHeatingMinLimitationSetPointCurveRadiator", REG_HOLDING, 4, 40005, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Min limitation, set point curve radiator"},
-{"setHeatingComfortWheelSetting", REG_HOLDING, 5, 40006, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Comfort wheel setting"},
-{"setHeatingHeatCurveYCoordinate1", REG_HOLDING, 6, 40007, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Set point heat curve, Y-coordinate 1 (highest outdoor temperature)"},
-{"setHeatingHeatCurveYCoordinate2", REG_HOLDING, 7, 40008, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Set point heat curve, Y-coordinate 2"},
-{"setHeatingHeatCurveYCoordinate3", REG_HOLDING, 8, 40009, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Set point heat curve, Y-coordinate 3"},
-{"setHeatingHeatCurveYCoordinate4", REG_HOLDING, 9, 40010, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Set point heat curve, Y-coordinate 4"},
-{"setHeatingHeatCurveYCoordinate5", REG_HOLDING, 10, 40011, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Set point heat curve, Y-coordinate 5"},
-{"setHeatingHeatCurveYCoordinate6", REG_HOLDING, 11, 40012, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Set point heat curve, Y-coordinate 6"},
-{"setHeatingHeatCurveYCoordinate7", REG_HOLDING, 12, 40013, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Set point heat curve, Y-coordinate 7 (lowest outdoor temperature)"},
-{"setHeatingSeasonStopTemperature", REG_HOLDING, 16, 40017, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Heating season stop temperature"},
-{"setTapwaterStartTemperature", REG_HOLDING, 22, 40023, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "Unit", "Start temperature tap water"},
-{"setTapwaterStopTemperature", REG_HOLDING, 23, 40024, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "Unit", "Stop temperature tap water"},
-{"setHeatpumpMinAllowedGearHeating", REG_HOLDING, 26, 40027, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Minimum allowed gear in heating *3"},
-{"setHeatpumpMaxAllowedGearHeating", REG_HOLDING, 27, 40028, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Maximum allowed gear in heating *3"},
-{"setHeatpumpMaxAllowedGearTapWater", REG_HOLDING, 28, 40029, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Maximum allowed gear in tap water *3"},
-{"setHeatpumpMinAllowedGearTapWater", REG_HOLDING, 29, 40030, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Minimum allowed gear in tap water *3"},
-{"setCoolingMixValveSetPoint", REG_HOLDING, 30, 40031, 100, MODEL_MEGA, "Cooling", "CoolingCircuit", "Cooling mix valve set point (EM)"},
-{"setTapwaterTwcMixValveSetPoint", REG_HOLDING, 31, 40032, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC mix valve set point (EM)"},
-{"setTapwaterWcsReturnLineSetPoint", REG_HOLDING, 32, 40033, 100, MODEL_MEGA, "Tapwater", "WCS", "WCS return line set point (EM)"},
-{"setTapwaterTwcMixValveLowestAllowedOpeningDegree", REG_HOLDING, 33, 40034, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC mix valve lowest allowed opening degree (EM)"},
-{"setTapwaterTwcMixValveHighestAllowedOpeningDegree", REG_HOLDING, 34, 40035, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC mix valve highest allowed opening degree (EM)"},
-{"setTapwaterTwcStartTemperatureImmersionHeater", REG_HOLDING, 35, 40036, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC start temperature immersion heater (EM)"},
-{"setTapwaterTwcStartDelayImmersionHeater", REG_HOLDING, 36, 40037, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC start delay immersion heater, seconds (EM)"},
-{"setTapwaterTwcStopTemperatureImmersionHeater", REG_HOLDING, 37, 40038, 100, MODEL_MEGA | MODEL_INVERTER, "Tapwater", "TWC", "TWC stop temperature immersion heater (EM)"},
-{"setTapwaterWcsMixValveLowestAllowedOpeningDegree", REG_HOLDING, 38, 40039, 100, MODEL_MEGA, "Tapwater", "WCS", "WCS mix valve lowest allowed opening degree (EM)"},
-{"setTapwaterWcsMixValveHighestAllowedOpeningDegree", REG_HOLDING, 39, 40040, 100, MODEL_MEGA, "Tapwater", "WCS", "WCS mix valve highest allowed opening degree (EM)"},
-{"setHeatingMixValve2LowestAllowedOpeningDegree", REG_HOLDING, 40, 40041, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Mix valve 2 lowest allowed opening degree (EM)"},
-{"setHeatingMixValve2HighestAllowedOpeningDegree", REG_HOLDING, 41, 40042, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Mix valve 2 highest allowed opening degree (EM)"},
-{"setHeatingMixValve3LowestAllowedOpeningDegree", REG_HOLDING, 42, 40043, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Mix valve 3 lowest allowed opening degree (EM)"},
-{"setHeatingMixValve3HighestAllowedOpeningDegree", REG_HOLDING, 43, 40044, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Mix valve 3 highest allowed opening degree (EM)"},
-{"setHeatingMixValve4LowestAllowedOpeningDegree", REG_HOLDING, 44, 40045, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Mix valve 4 lowest allowed opening degree (EM)"},
-{"setHeatingMixValve4HighestAllowedOpeningDegree", REG_HOLDING, 45, 40046, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Mix valve 4 highest allowed opening degree (EM)"},
-{"setHeatingMixValve5LowestAllowedOpeningDegree", REG_HOLDING, 46, 40047, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Mix valve 5 lowest allowed opening degree (EM)"},
-{"setHeatingMixValve5HighestAllowedOpeningDegree", REG_HOLDING, 47, 40048, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Mix valve 5 highest allowed opening degree (EM)"},
-{"setCoolingSurplusHeatChillerSetPoint", REG_HOLDING, 48, 40049, 100, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat chiller set point (EM)"},
-{"setCoolingSupplyLineMixValveLowestAllowedOpeningDegree", REG_HOLDING, 49, 40050, 100, MODEL_MEGA, "Cooling", "CoolingCircuit", "Cooling supply line mix valve: Lowest allowed opening degree (EM)"},
-{"setCoolingSupplyLineMixValveHighestAllowedOpeningDegree", REG_HOLDING, 50, 40051, 100, MODEL_MEGA, "Cooling", "CoolingCircuit", "Cooling supply line mix valve: Highest allowed opening degree (EM)"},
-{"setCoolingSurplusHeatOpeningDegreeStartFan1", REG_HOLDING, 51, 40052, 100, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat opening degree for starting fan 1 (EM)"},
-{"setCoolingSurplusHeatOpeningDegreeStartFan2", REG_HOLDING, 52, 40053, 100, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat opening degree for starting fan 2 (EM)"},
-{"setCoolingSurplusHeatOpeningDegreeStopFan1", REG_HOLDING, 53, 40054, 100, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat opening degree for stopping fan 1 (EM)"},
-{"setCoolingSurplusHeatOpeningDegreeStopFan2", REG_HOLDING, 54, 40055, 100, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat opening degree for stopping fan 2 (EM)"},
-{"setCoolingSurplusHeatLowestAllowedOpeningDegree", REG_HOLDING, 55, 40056, 100, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat lowest allowed opening degree (EM)"},
-{"setCoolingSurplusHeatHighestAllowedOpeningDegree", REG_HOLDING, 56, 40057, 100, MODEL_MEGA, "Cooling", "SurplusHeat", "Surplus heat highest allowed opening degree (EM)"},
-{"setPoolChargeSetPoint", REG_HOLDING, 58, 40059, 100, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Pool charge set point (EM)"},
-{"setPoolMixValveLowestAllowedOpeningDegree", REG_HOLDING, 59, 40060, 100, MODEL_MEGA, "Pool", "Unit", "Pool mix valve lowest allowed opening degree (EM)"},
-{"setPoolMixValveHighestAllowedOpeningDegree", REG_HOLDING, 60, 40061, 100, MODEL_MEGA, "Pool", "Unit", "Pool mix valve highest allowed opening degree (EM)"},
-{"setHeatpumpGearShiftDelayHeating", REG_HOLDING, 61, 40062, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Gear shift delay heating"},
-{"setHeatpumpGearShiftDelayPool", REG_HOLDING, 62, 40063, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Gear shift delay pool"},
-{"setHeatpumpGearShiftDelayCooling", REG_HOLDING, 63, 40064, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Gear shift delay cooling"},
-{"setHeatpumpBrineInHighAlarmLimit", REG_HOLDING, 67, 40068, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine in high alarm limit"},
-{"setHeatpumpBrineInLowAlarmLimit", REG_HOLDING, 68, 40069, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine in low alarm limit"},
-{"setHeatpumpBrineOutLowAlarmLimit", REG_HOLDING, 69, 40070, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine out low alarm limit"},
-{"setHeatpumpBrineMaxDeltaLimit", REG_HOLDING, 70, 40071, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine max delta limit"},
-{"setTapwaterHgwPumpStartTemperatureDischargePipe", REG_HOLDING, 71, 40072, 100, MODEL_MEGA, "Tapwater", "HGW", "Hot gas pump start temperature discharge pipe"},
-{"setTapwaterHgwPumpLowerStopLimitTemperatureDischargePipe", REG_HOLDING, 72, 40073, 100, MODEL_MEGA, "Tapwater", "HGW", "Hot gas pump lower stop limit temperature discharge pipe"},
-{"setTapwaterHgwPumpUpperStopLimitTemperatureDischargePipe", REG_HOLDING, 73, 40074, 100, MODEL_MEGA, "Tapwater", "HGW", "Hot gas pump upper stop limit temperature discharge pipe"},
-{"setHeatpumpExternalAdditionalHeaterStartPidSum", REG_HOLDING, 75, 40076, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "External additional heater start (PID sum)"},
-{"setHeatpumpCondenserPumpLowestAllowedSpeed", REG_HOLDING, 76, 40077, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Condenser pump lowest allowed speed (%)"},
-{"setHeatpumpBrinePumpLowestAllowedSpeed", REG_HOLDING, 77, 40078, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine pump lowest allowed speed (%)"},
-{"setHeatpumpExternalAdditionalHeaterStopPidSum", REG_HOLDING, 78, 40079, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "External additional heater stop (PID sum)"},
-{"setHeatpumpCondenserPumpHighestAllowedSpeed", REG_HOLDING, 79, 40080, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Condenser pump highest allowed speed (%)"},
-{"setHeatpumpBrinePumpHighestAllowedSpeed", REG_HOLDING, 80, 40081, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine pump highest allowed speed (%)"},
-{"setHeatpumpCondenserPumpStandbySpeed", REG_HOLDING, 81, 40082, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Condenser pump standby speed (%)"},
-{"setHeatpumpBrinePumpStandbySpeed", REG_HOLDING, 82, 40083, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Brine pump standby speed (%)"},
-{"setHeatpumpMinAllowedGearPool", REG_HOLDING, 85, 40086, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Minimum allowed gear in pool *3"},
-{"setHeatpumpMaxAllowedGearPool", REG_HOLDING, 86, 40087, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Maximum allowed gear in pool *3"},
-{"setHeatpumpMinAllowedGearCooling", REG_HOLDING, 87, 40088, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Minimum allowed gear in cooling *3"},
-{"setHeatpumpMaxAllowedGearCooling", REG_HOLDING, 88, 40089, 1, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "Maximum allowed gear in cooling *3"},
-{"setCoolingStartTemp", REG_HOLDING, 105, 40106, 100, MODEL_MEGA | MODEL_INVERTER, "Cooling", "CoolingTank", "Start temp for cooling (EM)"},
-{"setCoolingStopTemp", REG_HOLDING, 106, 40107, 100, MODEL_MEGA | MODEL_INVERTER, "Cooling", "CoolingTank", "Stop temp for cooling (EM)"},
-{"setHeatingMixValve1MinLimitationSetPointCurve", REG_HOLDING, 107, 40108, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Min limitation Set point curve radiator Mix valve 1"},
-{"setHeatingMixValve1MaxLimitationSetPointCurve", REG_HOLDING, 108, 40109, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Max limitation Set point curve radiator Mix valve 1"},
-{"setHeatingMixValve1HeatCurveYCoordinate1", REG_HOLDING, 109, 40110, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Set point curve, Y-coordinate 1 Mix valve 1 (highest outdoor temperature)"},
-{"setHeatingMixValve1HeatCurveYCoordinate2", REG_HOLDING, 110, 40111, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Set point curve, Y-coordinate 2 Mix valve 1"},
-{"setHeatingMixValve1HeatCurveYCoordinate3", REG_HOLDING, 111, 40112, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Set point curve, Y-coordinate 3 Mix valve 1"},
-{"setHeatingMixValve1HeatCurveYCoordinate4", REG_HOLDING, 112, 40113, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Set point curve, Y-coordinate 4 Mix valve 1"},
-{"setHeatingMixValve1HeatCurveYCoordinate5", REG_HOLDING, 113, 40114, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Set point curve, Y-coordinate 5 Mix valve 1"},
-{"setHeatingMixValve1HeatCurveYCoordinate6", REG_HOLDING, 114, 40115, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Set point curve, Y-coordinate 6 Mix valve 1"},
-{"setHeatingMixValve1HeatCurveYCoordinate7", REG_HOLDING, 115, 40116, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Set point curve, Y-coordinate 7 Mix valve 1 (lowest outdoor temperature)"},
-{"setHeatingFixedSystemSupplySetPoint", REG_HOLDING, 116, 40117, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "Unit", "Fixed system supply set point, requires defacto address 42 to be enabled"},
-{"setHeatingMixValve2MinLimitationSetPointCurve", REG_HOLDING, 199, 40200, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Min limitation Set point curve radiator Mix valve 2"},
-{"setHeatingMixValve2MaxLimitationSetPointCurve", REG_HOLDING, 200, 40201, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Max limitation Set point curve radiator Mix valve 2"},
-{"setHeatingMixValve2HeatCurveYCoordinate1", REG_HOLDING, 201, 40202, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Set point curve, Y-coordinate 1 Mix valve 2 (highest outdoor temperature)"},
-{"setHeatingMixValve2HeatCurveYCoordinate2", REG_HOLDING, 202, 40203, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Set point curve, Y-coordinate 2 Mix valve 2"},
-{"setHeatingMixValve2HeatCurveYCoordinate3", REG_HOLDING, 203, 40204, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Set point curve, Y-coordinate 3 Mix valve 2"},
-{"setHeatingMixValve2HeatCurveYCoordinate4", REG_HOLDING, 204, 40205, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Set point curve, Y-coordinate 4 Mix valve 2"},
-{"setHeatingMixValve2HeatCurveYCoordinate5", REG_HOLDING, 205, 40206, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Set point curve, Y-coordinate 5 Mix valve 2"},
-{"setHeatingMixValve2HeatCurveYCoordinate6", REG_HOLDING, 206, 40207, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Set point curve, Y-coordinate 6 Mix valve 2"},
-{"setHeatingMixValve2HeatCurveYCoordinate7", REG_HOLDING, 207, 40208, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve2", "Set point curve, Y-coordinate 7 Mix valve 2 (lowest outdoor temperature)"},
-{"setHeatingMixValve3MinLimitationSetPointCurve", REG_HOLDING, 208, 40209, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Min limitation Set point curve radiator Mix valve 3"},
-{"setHeatingMixValve3MaxLimitationSetPointCurve", REG_HOLDING, 209, 40210, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Max limitation Set point curve radiator Mix valve 3"},
-{"setHeatingMixValve3HeatCurveYCoordinate1", REG_HOLDING, 210, 40211, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Set point curve, Y-coordinate 1 Mix valve 3 (highest outdoor temperature)"},
-{"setHeatingMixValve3HeatCurveYCoordinate2", REG_HOLDING, 211, 40212, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Set point curve, Y-coordinate 2 Mix valve 3"},
-{"setHeatingMixValve3HeatCurveYCoordinate3", REG_HOLDING, 212, 40213, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Set point curve, Y-coordinate 3 Mix valve 3"},
-{"setHeatingMixValve3HeatCurveYCoordinate4", REG_HOLDING, 213, 40214, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Set point curve, Y-coordinate 4 Mix valve 3"},
-{"setHeatingMixValve3HeatCurveYCoordinate5", REG_HOLDING, 214, 40215, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Set point curve, Y-coordinate 5 Mix valve 3"},
-{"setHeatingMixValve3HeatCurveYCoordinate6", REG_HOLDING, 215, 40216, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Set point curve, Y-coordinate 6 Mix valve 3"},
-{"setHeatingMixValve3HeatCurveYCoordinate7", REG_HOLDING, 216, 40217, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve3", "Set point curve, Y-coordinate 7 Mix valve 3 (lowest outdoor temperature)"},
-{"setHeatingMixValve4MinLimitationSetPointCurve", REG_HOLDING, 239, 40240, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Min limitation Set point curve radiator Mix valve 4"},
-{"setHeatingMixValve4MaxLimitationSetPointCurve", REG_HOLDING, 240, 40241, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Max limitation Set point curve radiator Mix valve 4"},
-{"setHeatingMixValve4HeatCurveYCoordinate1", REG_HOLDING, 241, 40242, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Set point curve, Y-coordinate 1 Mix valve 4 (highest outdoor temperature)"},
-{"setHeatingMixValve4HeatCurveYCoordinate2", REG_HOLDING, 242, 40243, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Set point curve, Y-coordinate 2 Mix valve 4"},
-{"setHeatingMixValve4HeatCurveYCoordinate3", REG_HOLDING, 243, 40244, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Set point curve, Y-coordinate 3 Mix valve 4"},
-{"setHeatingMixValve4HeatCurveYCoordinate4", REG_HOLDING, 244, 40245, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Set point curve, Y-coordinate 4 Mix valve 4"},
-{"setHeatingMixValve4HeatCurveYCoordinate5", REG_HOLDING, 245, 40246, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Set point curve, Y-coordinate 5 Mix valve 4"},
-{"setHeatingMixValve4HeatCurveYCoordinate6", REG_HOLDING, 246, 40247, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Set point curve, Y-coordinate 6 Mix valve 4"},
-{"setHeatingMixValve4HeatCurveYCoordinate7", REG_HOLDING, 247, 40248, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve4", "Set point curve, Y-coordinate 7 Mix valve 4 (lowest outdoor temperature)"},
-{"setHeatingMixValve5MinLimitationSetPointCurve", REG_HOLDING, 248, 40249, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Min limitation Set point curve radiator Mix valve 5"},
-{"setHeatingMixValve5MaxLimitationSetPointCurve", REG_HOLDING, 249, 40250, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Max limitation Set point curve radiator Mix valve 5"},
-{"setHeatingMixValve5HeatCurveYCoordinate1", REG_HOLDING, 250, 40251, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Set point curve, Y-coordinate 1 Mix valve 5 (highest outdoor temperature)"},
-{"setHeatingMixValve5HeatCurveYCoordinate2", REG_HOLDING, 251, 40252, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Set point curve, Y-coordinate 2 Mix valve 5"},
-{"setHeatingMixValve5HeatCurveYCoordinate3", REG_HOLDING, 252, 40253, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Set point curve, Y-coordinate 3 Mix valve 5"},
-{"setHeatingMixValve5HeatCurveYCoordinate4", REG_HOLDING, 253, 40254, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Set point curve, Y-coordinate 4 Mix valve 5"},
-{"setHeatingMixValve5HeatCurveYCoordinate5", REG_HOLDING, 254, 40255, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Set point curve, Y-coordinate 5 Mix valve 5"},
-{"setHeatingMixValve5HeatCurveYCoordinate6", REG_HOLDING, 255, 40256, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Set point curve, Y-coordinate 6 Mix valve 5"},
-{"setHeatingMixValve5HeatCurveYCoordinate7", REG_HOLDING, 256, 40257, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve5", "Set point curve, Y-coordinate 7 Mix valve 5 (lowest outdoor temperature)"},
-{"setPoolReturnTempFromPoolToHeatExchanger", REG_HOLDING, 299, 40300, 10, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Set point return temp from pool to heat exchanger (EM)"},
-{"setPoolHysteresis", REG_HOLDING, 300, 40301, 10, MODEL_MEGA | MODEL_INVERTER, "Pool", "Unit", "Set point pool hysteresis (EM)"},
-{"setHeatingMixValve1SupplyLineTempPassiveCooling", REG_HOLDING, 302, 40303, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Set point for supply line temp passive cooling with mixing valve 1"},
-{"setHeatingMinOutdoorTempCoolingPermitted", REG_HOLDING, 303, 40304, 100, MODEL_MEGA | MODEL_INVERTER, "Heating", "MixValve1", "Set point minimum outdoor temp when cooling is permitted"},
-{"setHeatpumpExternalHeaterOutdoorTempLimit", REG_HOLDING, 304, 40305, 100, MODEL_MEGA | MODEL_INVERTER, "Heatpump", "Unit", "External heater outdoor temp limit"},
-{"setHeatingMixValve2SelectedMode", REG_HOLDING, 305, 40306, 1, MODEL_MEGA, "Heating", "MixValve2", "Selected mode for mixing valve 2, 0:Heat, 1:Cool, 2:Auto (EM3 only)"},
-{"setHeatingMixValve2DesiredCoolingTempSetPoint", REG_HOLDING, 306, 40307, 100, MODEL_MEGA, "Heating", "MixValve2", "Desired cooling temperature setpoint mixing valve 2 (EM3 only)"},
-{"setHeatingMixValve2SeasonalCoolingTemp", REG_HOLDING, 307, 40308, 100, MODEL_MEGA, "Heating", "MixValve2", "Seasonal cooling temperature (outdoor temp.), mixing valve 2 (EM3 only)"},
-{"setHeatingMixValve2SeasonalHeatingTemp", REG_HOLDING, 308, 40309, 100, MODEL_MEGA, "Heating", "MixValve2", "Seasonal heating temperature (outdoor temp.), mixing valve 2 (EM3 only)"},
-{"setHeatingMixValve3SelectedMode", REG_HOLDING, 309, 40310, 1, MODEL_MEGA, "Heating", "MixValve3", "Selected mode for mixing valve 3, 0:Heat, 1:Cool, 2:Auto (EM3 only)"},
-{"setHeatingMixValve3DesiredCoolingTempSetPoint", REG_HOLDING, 310, 40311, 100, MODEL_MEGA, "Heating", "MixValve3", "Desired cooling temperature setpoint mixing valve 3 (EM3 only)"},
-{"setHeatingMixValve3SeasonalCoolingTemp", REG_HOLDING, 311, 40312, 100, MODEL_MEGA, "Heating", "MixValve3", "Seasonal cooling temperature (outdoor temp.), mixing valve 3 (EM3 only)"},
-{"setHeatingMixValve3SeasonalHeatingTemp", REG_HOLDING, 312, 40313, 100, MODEL_MEGA, "Heating", "MixValve3", "Seasonal heating temperature (outdoor temp.), mixing valve 3 (EM3 only)"},
-{"setHeatingMixValve4SelectedMode", REG_HOLDING, 313, 40314, 1, MODEL_MEGA, "Heating", "MixValve4", "Selected mode for mixing valve 4, 0:Heat, 1:Cool, 2:Auto (EM3 only)"},
-{"setHeatingMixValve4DesiredCoolingTempSetPoint", REG_HOLDING, 314, 40315, 100, MODEL_MEGA, "Heating", "MixValve4", "Desired cooling temperature setpoint mixing valve 4 (EM3 only)"},
-{"setHeatingMixValve4SeasonalCoolingTemp", REG_HOLDING, 315, 40316, 100, MODEL_MEGA, "Heating", "MixValve4", "Seasonal cooling temperature (outdoor temp.), mixing valve 4 (EM3 only)"},
-{"setHeatingMixValve4SeasonalHeatingTemp", REG_HOLDING, 316, 40317, 100, MODEL_MEGA, "Heating", "MixValve4", "Seasonal heating temperature (outdoor temp.), mixing valve 4 (EM3 only)"},
-{"setHeatingMixValve5SelectedMode", REG_HOLDING, 317, 40318, 1, MODEL_MEGA, "Heating", "MixValve5", "Selected mode for mixing valve 5, 0:Heat, 1:Cool, 2:Auto (EM3 only)"},
-{"setHeatingMixValve5DesiredCoolingTempSetPoint", REG_HOLDING, 318, 40319, 100, MODEL_MEGA, "Heating", "MixValve5", "Desired cooling temperature setpoint mixing valve 5 (EM3 only)"},
-{"setHeatingMixValve5SeasonalCoolingTemp", REG_HOLDING, 319, 40320, 100, MODEL_MEGA, "Heating", "MixValve5", "Seasonal cooling temperature (outdoor temp.), mixing valve 5 (EM3 only)"},
-{"setHeatingMixValve5SeasonalHeatingTemp", REG_HOLDING, 320, 40321, 100, MODEL_MEGA, "Heating", "MixValve5", "Seasonal heating temperature (outdoor temp.), mixing valve 5 (EM3 only)"},
+#define REGISTERS_GROUPS 17
 
+static const register_group_t g_registers_groups[REGISTERS_GROUPS] = {
+    {"Heatpump", "Unit"}, {"Tapwater", "HGW"}, {"Cooling", "Unit"}, {"Heating", "MixValve1"},
+    {"Tapwater", "TWC"}, {"Tapwater", "WCS"}, {"Tapwater", "Unit"}, {"Heating", "MixValve2"},
+    {"Heating", "MixValve3"}, {"Heating", "MixValve4"}, {"Heating", "MixValve5"}, {"Cooling", "CoolingCircuit"},
+    {"Electric", "Unit"}, {"Pool", "Unit"}, {"Cooling", "SurplusHeat"}, {"Heating", "Unit"},
+    {"Cooling", "CoolingTank"},
+};
+
+static const register_def_t g_registers[] = {
+{"enableHeatpumpResetAllAlarms", REG_COIL_STATUS, 3, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableHeatpumpInternalAdditionalHeater", REG_COIL_STATUS, 4, 1, MODEL_INVERTER, 0},
+{"enableHeatpumpExternalAdditionalHeater", REG_COIL_STATUS, 5, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableTapwaterHgw", REG_COIL_STATUS, 6, 1, MODEL_INVERTER, 1},
+{"enableHeatpumpFlowPressureSwitch", REG_COIL_STATUS, 7, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableHeatpumpTapWater", REG_COIL_STATUS, 8, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableHeatpumpHeat", REG_COIL_STATUS, 9, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableCoolingActiveCooling", REG_COIL_STATUS, 10, 1, MODEL_MEGA | MODEL_INVERTER, 2},
+{"enableHeatingMixValve1", REG_COIL_STATUS, 11, 1, MODEL_MEGA | MODEL_INVERTER, 3},
+{"enableTapwaterTwc", REG_COIL_STATUS, 12, 1, MODEL_MEGA | MODEL_INVERTER, 4},
+{"enableTapwaterWcs", REG_COIL_STATUS, 13, 1, MODEL_MEGA, 5},
+{"enableTapwaterHotGasPump", REG_COIL_STATUS, 14, 1, MODEL_MEGA, 6},
+{"enableHeatingMixValve2", REG_COIL_STATUS, 16, 1, MODEL_MEGA | MODEL_INVERTER, 7},
+{"enableHeatingMixValve3", REG_COIL_STATUS, 17, 1, MODEL_MEGA | MODEL_INVERTER, 8},
+{"enableHeatingMixValve4", REG_COIL_STATUS, 18, 1, MODEL_MEGA | MODEL_INVERTER, 9},
+{"enableHeatingMixValve5", REG_COIL_STATUS, 19, 1, MODEL_MEGA | MODEL_INVERTER, 10},
+{"enableHeatpumpBrineOutMonitoring", REG_COIL_STATUS, 20, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableHeatpumpBrinePumpContinuousOperation", REG_COIL_STATUS, 21, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableHeatpumpSystemCirculationPump", REG_COIL_STATUS, 22, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableCoolingDewPointCalculation", REG_COIL_STATUS, 23, 1, MODEL_MEGA, 11},
+{"enableTapwaterAntiLegionella", REG_COIL_STATUS, 24, 1, MODEL_INVERTER, 6},
+{"enableHeatpumpAdditionalHeaterOnly", REG_COIL_STATUS, 25, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableElectricCurrentLimitation", REG_COIL_STATUS, 26, 1, MODEL_INVERTER, 12},
+{"enablePoolPool", REG_COIL_STATUS, 28, 1, MODEL_MEGA | MODEL_INVERTER, 13},
+{"enableCoolingSurplusHeatChiller", REG_COIL_STATUS, 29, 1, MODEL_MEGA, 14},
+{"enableCoolingSurplusHeatBorehole", REG_COIL_STATUS, 30, 1, MODEL_MEGA, 2},
+{"enablePoolExternalAdditionalHeater", REG_COIL_STATUS, 31, 1, MODEL_MEGA | MODEL_INVERTER, 13},
+{"enablePoolInternalAdditionalHeater", REG_COIL_STATUS, 32, 1, MODEL_INVERTER, 13},
+{"enableCoolingPassiveCooling", REG_COIL_STATUS, 33, 1, MODEL_MEGA | MODEL_INVERTER, 2},
+{"enableHeatpumpVariableSpeedCondenserPump", REG_COIL_STATUS, 34, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableHeatpumpVariableSpeedBrinePump", REG_COIL_STATUS, 35, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableHeatingMixValve1CoolingMode", REG_COIL_STATUS, 36, 1, MODEL_MEGA | MODEL_INVERTER, 3},
+{"enableHeatingMixValve1OutdoorTempCooling", REG_COIL_STATUS, 37, 1, MODEL_MEGA | MODEL_INVERTER, 3},
+{"enableHeatingMixValve1BrinePumpOnCooling", REG_COIL_STATUS, 38, 1, MODEL_MEGA | MODEL_INVERTER, 3},
+{"enableHeatpumpOutdoorTempExternalHeater", REG_COIL_STATUS, 39, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableHeatpumpBrineInMonitoring", REG_COIL_STATUS, 40, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableHeatingFixedSystemSupplySetPoint", REG_COIL_STATUS, 41, 1, MODEL_MEGA | MODEL_INVERTER, 15},
+{"enableHeatpumpEvaporatorFreezeProtection", REG_COIL_STATUS, 42, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"enableHeatingMixValve2OutdoorTempCooling", REG_COIL_STATUS, 43, 1, MODEL_MEGA, 7},
+{"enableHeatingMixValve2DewPointCalculation", REG_COIL_STATUS, 44, 1, MODEL_MEGA, 7},
+{"enableHeatingMixValve2OutdoorTempHeating", REG_COIL_STATUS, 45, 1, MODEL_MEGA, 7},
+{"enableHeatingMixValve3OutdoorTempCooling", REG_COIL_STATUS, 46, 1, MODEL_MEGA, 8},
+{"enableHeatingMixValve3DewPointCalculation", REG_COIL_STATUS, 47, 1, MODEL_MEGA, 8},
+{"enableHeatingMixValve3OutdoorTempHeating", REG_COIL_STATUS, 48, 1, MODEL_MEGA, 8},
+{"enableHeatingMixValve4OutdoorTempCooling", REG_COIL_STATUS, 49, 1, MODEL_MEGA, 9},
+{"enableHeatingMixValve4DewPointCalculation", REG_COIL_STATUS, 50, 1, MODEL_MEGA, 9},
+{"enableHeatingMixValve4OutdoorTempHeating", REG_COIL_STATUS, 51, 1, MODEL_MEGA, 9},
+{"enableHeatingMixValve5OutdoorTempCooling", REG_COIL_STATUS, 52, 1, MODEL_MEGA, 10},
+{"enableHeatingMixValve5DewPointCalculation", REG_COIL_STATUS, 53, 1, MODEL_MEGA, 10},
+{"enableHeatingMixValve5OutdoorTempHeating", REG_COIL_STATUS, 54, 1, MODEL_MEGA, 10},
+{"enableHeatingMixValve2BrinePumpOnCooling", REG_COIL_STATUS, 55, 1, MODEL_MEGA, 7},
+{"enableHeatingMixValve3BrinePumpOnCooling", REG_COIL_STATUS, 56, 1, MODEL_MEGA, 8},
+{"enableHeatingMixValve4BrinePumpOnCooling", REG_COIL_STATUS, 57, 1, MODEL_MEGA, 9},
+{"enableHeatingMixValve5BrinePumpOnCooling", REG_COIL_STATUS, 58, 1, MODEL_MEGA, 10},
+{"alarmHeatpumpClassA", REG_INPUT_STATUS, 0, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpClassB", REG_INPUT_STATUS, 1, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpClassC", REG_INPUT_STATUS, 2, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpClassDGenesisSecondary", REG_INPUT_STATUS, 3, 1, MODEL_MEGA, 0},
+{"alarmHeatpumpClassELegacySecondary", REG_INPUT_STATUS, 4, 1, MODEL_MEGA, 0},
+{"alarmHeatpumpHighPressureSwitch", REG_INPUT_STATUS, 9, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpLowPressureLevel", REG_INPUT_STATUS, 10, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpHighDischargePipeTemperature", REG_INPUT_STATUS, 11, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpOperatingPressureLimit", REG_INPUT_STATUS, 12, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpDischargePipeSensor", REG_INPUT_STATUS, 13, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpLiquidLineSensor", REG_INPUT_STATUS, 14, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpSuctionGasSensor", REG_INPUT_STATUS, 15, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpFlowPressureSwitch", REG_INPUT_STATUS, 16, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpPowerInputPhaseDetection", REG_INPUT_STATUS, 22, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpInverterUnit", REG_INPUT_STATUS, 23, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatingSystemSupplyLowTemperature", REG_INPUT_STATUS, 24, 1, MODEL_MEGA | MODEL_INVERTER, 15},
+{"alarmHeatpumpCompressorLowSpeed", REG_INPUT_STATUS, 25, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpLowSuperHeat", REG_INPUT_STATUS, 26, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpPressureRatioOutOfRange", REG_INPUT_STATUS, 27, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpCompressorPressureOutsideEnvelope", REG_INPUT_STATUS, 28, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpBrineTemperatureOutOfRange", REG_INPUT_STATUS, 29, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpBrineInSensor", REG_INPUT_STATUS, 30, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpBrineOutSensor", REG_INPUT_STATUS, 31, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpCondenserInSensor", REG_INPUT_STATUS, 32, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpCondenserOutSensor", REG_INPUT_STATUS, 33, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpOutdoorSensor", REG_INPUT_STATUS, 34, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatingSystemSupplyLineSensor", REG_INPUT_STATUS, 35, 1, MODEL_MEGA | MODEL_INVERTER, 15},
+{"alarmHeatingMixValve1SupplyLineSensor", REG_INPUT_STATUS, 36, 1, MODEL_MEGA | MODEL_INVERTER, 3},
+{"alarmHeatingMixValve2SupplyLineSensor", REG_INPUT_STATUS, 37, 1, MODEL_MEGA | MODEL_INVERTER, 7},
+{"alarmHeatingMixValve3SupplyLineSensor", REG_INPUT_STATUS, 38, 1, MODEL_MEGA | MODEL_INVERTER, 8},
+{"alarmHeatingMixValve4SupplyLineSensor", REG_INPUT_STATUS, 39, 1, MODEL_MEGA | MODEL_INVERTER, 9},
+{"alarmHeatingMixValve5SupplyLineSensor", REG_INPUT_STATUS, 40, 1, MODEL_MEGA | MODEL_INVERTER, 10},
+{"alarmTapwaterWcsReturnLineSensor", REG_INPUT_STATUS, 44, 1, MODEL_MEGA, 5},
+{"alarmTapwaterTwcSupplyLineSensor", REG_INPUT_STATUS, 45, 1, MODEL_MEGA | MODEL_INVERTER, 4},
+{"alarmCoolingTankSensor", REG_INPUT_STATUS, 46, 1, MODEL_MEGA, 16},
+{"alarmCoolingSupplyLineSensor", REG_INPUT_STATUS, 47, 1, MODEL_MEGA | MODEL_INVERTER, 16},
+{"alarmCoolingCircuitReturnLineSensor", REG_INPUT_STATUS, 48, 1, MODEL_MEGA, 11},
+{"alarmHeatpumpBrineDeltaOutOfRange", REG_INPUT_STATUS, 49, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmTapwaterMidSensor", REG_INPUT_STATUS, 50, 1, MODEL_MEGA | MODEL_INVERTER, 6},
+{"alarmTapwaterTwcCirculationReturnSensor", REG_INPUT_STATUS, 51, 1, MODEL_MEGA | MODEL_INVERTER, 4},
+{"alarmTapwaterHgwSensor", REG_INPUT_STATUS, 52, 1, MODEL_INVERTER, 1},
+{"alarmHeatpumpInternalAdditionalHeater", REG_INPUT_STATUS, 53, 1, MODEL_INVERTER, 0},
+{"alarmHeatpumpBrineInHighTemperature", REG_INPUT_STATUS, 55, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpBrineInLowTemperature", REG_INPUT_STATUS, 56, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmHeatpumpBrineOutLowTemperature", REG_INPUT_STATUS, 57, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmTapwaterTwcCirculationReturnLowTemperature", REG_INPUT_STATUS, 58, 1, MODEL_MEGA | MODEL_INVERTER, 4},
+{"alarmTapwaterTwcSupplyLowTemperature", REG_INPUT_STATUS, 59, 1, MODEL_MEGA | MODEL_INVERTER, 4},
+{"alarmHeatingMixValve1SupplyTemperatureDeviation", REG_INPUT_STATUS, 60, 1, MODEL_MEGA | MODEL_INVERTER, 3},
+{"alarmHeatingMixValve2SupplyTemperatureDeviation", REG_INPUT_STATUS, 61, 1, MODEL_MEGA | MODEL_INVERTER, 7},
+{"alarmHeatingMixValve3SupplyTemperatureDeviation", REG_INPUT_STATUS, 62, 1, MODEL_MEGA | MODEL_INVERTER, 8},
+{"alarmHeatingMixValve4SupplyTemperatureDeviation", REG_INPUT_STATUS, 63, 1, MODEL_MEGA | MODEL_INVERTER, 9},
+{"alarmHeatingMixValve5SupplyTemperatureDeviation", REG_INPUT_STATUS, 64, 1, MODEL_MEGA | MODEL_INVERTER, 10},
+{"alarmTapwaterWcsReturnLineTemperatureDeviation", REG_INPUT_STATUS, 65, 1, MODEL_MEGA, 5},
+{"alarmHeatpumpSum", REG_INPUT_STATUS, 66, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmCoolingCircuitSupplyLineTemperatureDeviation", REG_INPUT_STATUS, 67, 1, MODEL_MEGA, 11},
+{"alarmCoolingTankTemperatureDeviation", REG_INPUT_STATUS, 68, 1, MODEL_MEGA, 16},
+{"alarmCoolingSurplusHeatTemperatureDeviation", REG_INPUT_STATUS, 69, 1, MODEL_MEGA, 14},
+{"alarmCoolingHumidityRoomSensor", REG_INPUT_STATUS, 70, 1, MODEL_MEGA, 11},
+{"alarmCoolingSurplusHeatSupplyLineSensor", REG_INPUT_STATUS, 71, 1, MODEL_MEGA, 14},
+{"alarmCoolingSurplusHeatReturnLineSensor", REG_INPUT_STATUS, 72, 1, MODEL_MEGA, 14},
+{"alarmCoolingTankReturnLineSensor", REG_INPUT_STATUS, 73, 1, MODEL_MEGA, 16},
+{"alarmHeatingTemperatureRoomSensor", REG_INPUT_STATUS, 74, 1, MODEL_MEGA | MODEL_INVERTER, 15},
+{"alarmHeatpumpInverterUnitCommunication", REG_INPUT_STATUS, 75, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"alarmPoolReturnLineSensor", REG_INPUT_STATUS, 76, 1, MODEL_MEGA | MODEL_INVERTER, 13},
+{"statusPoolExternalStop", REG_INPUT_STATUS, 77, 1, MODEL_MEGA | MODEL_INVERTER, 13},
+{"statusCoolingExternalStartBrinePump", REG_INPUT_STATUS, 78, 1, MODEL_MEGA | MODEL_INVERTER, 2},
+{"statusHeatpumpExternalRelayBrineGroundWaterPump", REG_INPUT_STATUS, 79, 1, MODEL_MEGA, 0},
+{"alarmTapwaterEndTankSensor", REG_INPUT_STATUS, 81, 1, MODEL_MEGA | MODEL_INVERTER, 4},
+{"alarmTapwaterMaxTimeAntiLegionellaExceeded", REG_INPUT_STATUS, 82, 1, MODEL_INVERTER, 6},
+{"alarmHeatpumpGenesisSecondaryUnitCommunication", REG_INPUT_STATUS, 83, 1, MODEL_MEGA, 0},
+{"alarmHeatpumpPrimaryUnitNetworkConflict", REG_INPUT_STATUS, 84, 1, MODEL_MEGA, 0},
+{"alarmHeatpumpPrimaryUnitSecondariesNotDetected", REG_INPUT_STATUS, 85, 1, MODEL_MEGA, 0},
+{"statusHeatpumpOilBoostInProgress", REG_INPUT_STATUS, 86, 1, MODEL_INVERTER, 0},
+{"statusHeatpumpCompressorControl", REG_INPUT_STATUS, 199, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusHeatpumpSmartGrid1Evu", REG_INPUT_STATUS, 201, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusHeatpumpExternalAlarmInput", REG_INPUT_STATUS, 202, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusHeatpumpSmartGrid2", REG_INPUT_STATUS, 204, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusHeatpumpExternalAdditionalHeaterControl", REG_INPUT_STATUS, 206, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusHeatingMixValve1CirculationPumpControl", REG_INPUT_STATUS, 209, 1, MODEL_MEGA | MODEL_INVERTER, 3},
+{"statusHeatpumpCondenserPumpOnOff", REG_INPUT_STATUS, 210, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusHeatingSystemCirculationPumpControl", REG_INPUT_STATUS, 211, 1, MODEL_MEGA | MODEL_INVERTER, 15},
+{"statusTapwaterHotGasCirculationPumpControl", REG_INPUT_STATUS, 213, 1, MODEL_MEGA, 6},
+{"statusHeatpumpBrinePumpOnOff", REG_INPUT_STATUS, 218, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusHeatpumpExternalHeaterCirculationPumpControl", REG_INPUT_STATUS, 219, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusHeatingSeasonWinterActive", REG_INPUT_STATUS, 220, 1, MODEL_MEGA | MODEL_INVERTER, 15},
+{"statusHeatpumpExternalAdditionalHeaterActive", REG_INPUT_STATUS, 221, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusHeatpumpInternalAdditionalHeaterActive", REG_INPUT_STATUS, 222, 1, MODEL_INVERTER, 0},
+{"statusTapwaterHgwRegulationControl", REG_INPUT_STATUS, 223, 1, MODEL_INVERTER, 1},
+{"statusHeatpumpStopping", REG_INPUT_STATUS, 224, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusHeatpumpOkToStart", REG_INPUT_STATUS, 225, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"statusTapwaterTwcSupplyLineCirculationPumpControl", REG_INPUT_STATUS, 230, 1, MODEL_MEGA | MODEL_INVERTER, 4},
+{"statusTapwaterWcsRegulationControl", REG_INPUT_STATUS, 232, 1, MODEL_MEGA, 5},
+{"statusTapwaterWcsCirculationPumpControl", REG_INPUT_STATUS, 233, 1, MODEL_MEGA, 5},
+{"statusTapwaterTwcEndTankHeaterControl", REG_INPUT_STATUS, 234, 1, MODEL_MEGA | MODEL_INVERTER, 4},
+{"statusPoolDirectionalValvePosition", REG_INPUT_STATUS, 235, 1, MODEL_MEGA | MODEL_INVERTER, 13},
+{"statusCoolingCircuitCirculationPumpControl", REG_INPUT_STATUS, 236, 1, MODEL_MEGA, 11},
+{"statusPoolCirculationPumpControl", REG_INPUT_STATUS, 237, 1, MODEL_MEGA | MODEL_INVERTER, 13},
+{"statusCoolingSurplusHeatDirectionalValvePosition", REG_INPUT_STATUS, 238, 1, MODEL_MEGA, 14},
+{"statusCoolingSurplusHeatCirculationPumpControl", REG_INPUT_STATUS, 239, 1, MODEL_MEGA, 14},
+{"statusCoolingCircuitRegulationControl", REG_INPUT_STATUS, 240, 1, MODEL_MEGA, 11},
+{"statusCoolingSurplusHeatRegulationControl", REG_INPUT_STATUS, 241, 1, MODEL_MEGA, 14},
+{"statusCoolingActiveCoolingDirectionalValvePosition", REG_INPUT_STATUS, 242, 1, MODEL_MEGA, 16},
+{"statusCoolingPassiveActiveCoolingDirectionalValvePosition", REG_INPUT_STATUS, 243, 1, MODEL_MEGA, 16},
+{"statusPoolRegulationControl", REG_INPUT_STATUS, 244, 1, MODEL_MEGA | MODEL_INVERTER, 13},
+{"statusHeatingMixValve1ProducingPassiveCooling", REG_INPUT_STATUS, 245, 1, MODEL_MEGA | MODEL_INVERTER, 3},
+{"statusHeatpumpCompressorUnableToSpeedUp", REG_INPUT_STATUS, 246, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCurrentlyRunningFirstPrioritisedDemand", REG_INPUT, 1, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCompressorAvailableGears", REG_INPUT, 4, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCompressorSpeedRpm", REG_INPUT, 5, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpExternalAdditionalHeaterCurrentDemand", REG_INPUT, 6, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpDischargePipeTemperature", REG_INPUT, 7, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCondenserInTemperature", REG_INPUT, 8, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCondenserOutTemperature", REG_INPUT, 9, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpBrineInTemperature", REG_INPUT, 10, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpBrineOutTemperature", REG_INPUT, 11, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatingSystemSupplyLineTemperature", REG_INPUT, 12, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatpumpOutdoorTemperature", REG_INPUT, 13, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueTapwaterTopTemperature", REG_INPUT, 15, 100, MODEL_MEGA | MODEL_INVERTER, 6},
+{"valueTapwaterLowerTemperature", REG_INPUT, 16, 100, MODEL_MEGA | MODEL_INVERTER, 6},
+{"valueTapwaterWeightedTemperature", REG_INPUT, 17, 100, MODEL_MEGA | MODEL_INVERTER, 6},
+{"valueHeatingSystemSupplyLineCalculatedSetPoint", REG_INPUT, 18, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatingSelectedHeatCurveSystemSupplyLine", REG_INPUT, 19, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatingHeatCurveXCoordinate1", REG_INPUT, 20, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatingHeatCurveXCoordinate2", REG_INPUT, 21, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatingHeatCurveXCoordinate3", REG_INPUT, 22, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatingHeatCurveXCoordinate4", REG_INPUT, 23, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatingHeatCurveXCoordinate5", REG_INPUT, 24, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatingHeatCurveXCoordinate6", REG_INPUT, 25, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatingHeatCurveXCoordinate7", REG_INPUT, 26, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueCoolingSeasonIntegralValue", REG_INPUT, 36, 1, MODEL_MEGA | MODEL_INVERTER, 2},
+{"valueHeatpumpCondenserCirculationPumpSpeed", REG_INPUT, 39, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatingMixValve1SupplyLineTemperature", REG_INPUT, 40, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"valueHeatingBufferTankTemperature", REG_INPUT, 41, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatingMixValve1Position", REG_INPUT, 43, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"valueHeatpumpBrineCirculationPumpSpeed", REG_INPUT, 44, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueTapwaterHgwSupplyLineTemperature", REG_INPUT, 45, 100, MODEL_INVERTER, 1},
+{"valueTapwaterHgwDirectionalValvePosition", REG_INPUT, 47, 1, MODEL_MEGA, 1},
+{"valueHeatpumpCompressorOperatingHoursMsb", REG_INPUT, 48, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCompressorOperatingHoursLsb", REG_INPUT, 49, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueTapwaterOperatingHoursMsb", REG_INPUT, 50, 1, MODEL_MEGA | MODEL_INVERTER, 6},
+{"valueTapwaterOperatingHoursLsb", REG_INPUT, 51, 1, MODEL_MEGA | MODEL_INVERTER, 6},
+{"valueHeatpumpExternalAdditionalHeaterOperatingHoursMsb", REG_INPUT, 52, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpExternalAdditionalHeaterOperatingHoursLsb", REG_INPUT, 53, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCompressorSpeedPercent", REG_INPUT, 54, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCurrentlyRunningSecondPrioritisedDemand", REG_INPUT, 55, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCurrentlyRunningThirdPrioritisedDemand", REG_INPUT, 56, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpSoftwareVersionMajor", REG_INPUT, 57, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpSoftwareVersionMinor", REG_INPUT, 58, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpSoftwareVersionMicro", REG_INPUT, 59, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCompressorTemporarilyBlocked", REG_INPUT, 60, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpCompressorCurrentGear", REG_INPUT, 61, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpQueuedDemandFirstPriority", REG_INPUT, 62, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpQueuedDemandSecondPriority", REG_INPUT, 63, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpQueuedDemandThirdPriority", REG_INPUT, 64, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpQueuedDemandFourthPriority", REG_INPUT, 65, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpQueuedDemandFifthPriority", REG_INPUT, 66, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpInternalAdditionalHeaterCurrentStep", REG_INPUT, 67, 1, MODEL_INVERTER, 0},
+{"valueHeatingBufferTankChargeSetPoint", REG_INPUT, 68, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueElectricMeterL1Current", REG_INPUT, 69, 100, MODEL_INVERTER, 12},
+{"valueElectricMeterL2Current", REG_INPUT, 70, 100, MODEL_INVERTER, 12},
+{"valueElectricMeterL3Current", REG_INPUT, 71, 100, MODEL_INVERTER, 12},
+{"valueElectricMeterL1ToNeutralVoltage", REG_INPUT, 72, 100, MODEL_INVERTER, 12},
+{"valueElectricMeterL2ToNeutralVoltage", REG_INPUT, 73, 100, MODEL_INVERTER, 12},
+{"valueElectricMeterL3ToNeutralVoltage", REG_INPUT, 74, 100, MODEL_INVERTER, 12},
+{"valueElectricMeterL1ToL2Voltage", REG_INPUT, 75, 10, MODEL_INVERTER, 12},
+{"valueElectricMeterL2ToL3Voltage", REG_INPUT, 76, 10, MODEL_INVERTER, 12},
+{"valueElectricMeterL3ToL1Voltage", REG_INPUT, 77, 10, MODEL_INVERTER, 12},
+{"valueElectricMeterL1Power", REG_INPUT, 78, 1, MODEL_INVERTER, 12},
+{"valueElectricMeterL2Power", REG_INPUT, 79, 1, MODEL_INVERTER, 12},
+{"valueElectricMeterL3Power", REG_INPUT, 80, 1, MODEL_INVERTER, 12},
+{"valueElectricMeterValue", REG_INPUT, 81, 1, MODEL_INVERTER, 12},
+{"valueHeatpumpComfortMode", REG_INPUT, 82, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueElectricMeterKwhTotalLsb", REG_INPUT, 83, 10, MODEL_INVERTER, 12},
+{"valueElectricMeterKwhTotalMsb", REG_INPUT, 84, 10, MODEL_INVERTER, 12},
+{"valueTapwaterWcsValvePosition", REG_INPUT, 85, 100, MODEL_MEGA, 5},
+{"valueTapwaterTwcValvePosition", REG_INPUT, 86, 100, MODEL_MEGA | MODEL_INVERTER, 4},
+{"valueHeatingMixValve2Position", REG_INPUT, 87, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"valueHeatingMixValve3Position", REG_INPUT, 88, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"valueHeatingMixValve4Position", REG_INPUT, 89, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"valueHeatingMixValve5Position", REG_INPUT, 90, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"valueCoolingDewPointRoom", REG_INPUT, 91, 100, MODEL_MEGA, 11},
+{"valueCoolingSupplyLineMixValvePosition", REG_INPUT, 92, 100, MODEL_MEGA, 11},
+{"valueCoolingSurplusHeatFanSpeed", REG_INPUT, 93, 100, MODEL_MEGA, 14},
+{"valuePoolSupplyLineMixValvePosition", REG_INPUT, 94, 100, MODEL_MEGA, 13},
+{"valueTapwaterTwcSupplyLineTemperature", REG_INPUT, 95, 100, MODEL_MEGA | MODEL_INVERTER, 4},
+{"valueTapwaterTwcReturnTemperature", REG_INPUT, 96, 100, MODEL_MEGA | MODEL_INVERTER, 4},
+{"valueTapwaterWcsReturnLineTemperature", REG_INPUT, 97, 100, MODEL_MEGA, 5},
+{"valueTapwaterTwcEndTankTemperature", REG_INPUT, 98, 100, MODEL_MEGA | MODEL_INVERTER, 4},
+{"valueHeatingMixValve2SupplyLineTemperature", REG_INPUT, 99, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"valueHeatingMixValve3SupplyLineTemperature", REG_INPUT, 100, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"valueHeatingMixValve4SupplyLineTemperature", REG_INPUT, 101, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"valueCoolingCircuitReturnLineTemperature", REG_INPUT, 103, 100, MODEL_MEGA, 11},
+{"valueCoolingTankTemperature", REG_INPUT, 104, 100, MODEL_MEGA, 16},
+{"valueCoolingTankReturnLineTemperature", REG_INPUT, 105, 100, MODEL_MEGA, 16},
+{"valueCoolingCircuitSupplyLineTemperature", REG_INPUT, 106, 100, MODEL_MEGA, 11},
+{"valueHeatingMixValve5SupplyLineTemperature", REG_INPUT, 107, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"valueHeatingMixValve2ReturnLineTemperature", REG_INPUT, 109, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"valueHeatingMixValve3ReturnLineTemperature", REG_INPUT, 111, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"valueHeatingMixValve4ReturnLineTemperature", REG_INPUT, 113, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"valueHeatingMixValve5ReturnLineTemperature", REG_INPUT, 115, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"valueCoolingSurplusHeatReturnLineTemperature", REG_INPUT, 117, 100, MODEL_MEGA, 14},
+{"valueCoolingSurplusHeatSupplyLineTemperature", REG_INPUT, 118, 100, MODEL_MEGA, 14},
+{"valuePoolSupplyLineTemperature", REG_INPUT, 119, 100, MODEL_MEGA | MODEL_INVERTER, 13},
+{"valuePoolReturnLineTemperature", REG_INPUT, 120, 100, MODEL_MEGA | MODEL_INVERTER, 13},
+{"valueHeatingRoomTemperatureSensor", REG_INPUT, 121, 10, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatpumpBubblePointHighPressureTemperature", REG_INPUT, 122, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpDewPointHighPressureTemperature", REG_INPUT, 123, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpDewPointLowPressureTemperature", REG_INPUT, 124, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpSuperheatTemperature", REG_INPUT, 125, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpSubCoolingTemperature", REG_INPUT, 126, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpLowPressureSidePressure", REG_INPUT, 127, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpHighPressureSidePressure", REG_INPUT, 128, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpLiquidLineTemperature", REG_INPUT, 129, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpSuctionGasTemperature", REG_INPUT, 130, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatingSeasonIntegralValue", REG_INPUT, 131, 1, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueHeatpumpPidPValue", REG_INPUT, 132, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpPidIValue", REG_INPUT, 133, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpPidDValue", REG_INPUT, 134, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpBufferTankIValue", REG_INPUT, 135, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpBufferTankPValue", REG_INPUT, 136, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatingMixValveCoolingOpeningDegree", REG_INPUT, 137, 1, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueTapwaterDesiredGear", REG_INPUT, 139, 1, MODEL_MEGA | MODEL_INVERTER, 6},
+{"valueHeatingDesiredGear", REG_INPUT, 140, 1, MODEL_MEGA | MODEL_INVERTER, 15},
+{"valueCoolingDesiredGear", REG_INPUT, 141, 1, MODEL_MEGA | MODEL_INVERTER, 2},
+{"valuePoolDesiredGear", REG_INPUT, 142, 1, MODEL_MEGA | MODEL_INVERTER, 13},
+{"valueHeatpumpNumberOfAvailableSecondariesGenesis", REG_INPUT, 143, 1, MODEL_MEGA, 0},
+{"valueHeatpumpNumberOfAvailableSecondariesLegacy", REG_INPUT, 144, 1, MODEL_MEGA, 0},
+{"valueHeatpumpTotalDistributedGearsAllUnits", REG_INPUT, 145, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatpumpMaximumGearCurrentlyRequested", REG_INPUT, 146, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"valueHeatingMixValve1DesiredTemperature", REG_INPUT, 147, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"valueHeatingMixValve2DesiredTemperature", REG_INPUT, 148, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"valueHeatingMixValve3DesiredTemperature", REG_INPUT, 149, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"valueHeatingMixValve4DesiredTemperature", REG_INPUT, 150, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"valueHeatingMixValve5DesiredTemperature", REG_INPUT, 151, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"valueTapwaterHgwDisconnectEndTank", REG_INPUT, 152, 1, MODEL_MEGA, 1},
+{"valueHeatpumpLegacyCompressorRunning", REG_INPUT, 153, 1, MODEL_MEGA, 0},
+{"valueHeatpumpLegacyReportingAlarm", REG_INPUT, 154, 1, MODEL_MEGA, 0},
+{"valueHeatpumpLegacyStartSignal", REG_INPUT, 155, 1, MODEL_MEGA, 0},
+{"valueHeatpumpLegacyTapWaterSignal", REG_INPUT, 156, 1, MODEL_MEGA, 0},
+{"valueHeatpumpPrimaryUnitAlarmClassDCombined", REG_INPUT, 160, 1, MODEL_MEGA, 0},
+{"valueHeatpumpPrimaryUnitAlarmLostCommunicationGenesis", REG_INPUT, 161, 1, MODEL_MEGA, 0},
+{"valueHeatpumpPrimaryUnitAlarmClassASecondary", REG_INPUT, 162, 1, MODEL_MEGA, 0},
+{"valueHeatpumpPrimaryUnitAlarmClassBSecondary", REG_INPUT, 163, 1, MODEL_MEGA, 0},
+{"valueHeatpumpPrimaryUnitAlarmClassECombined", REG_INPUT, 170, 1, MODEL_MEGA, 0},
+{"valueHeatpumpPrimaryUnitAlarmLegacyGeneral", REG_INPUT, 171, 1, MODEL_MEGA, 0},
+{"valueHeatpumpPrimaryUnitAlarmLegacyExpansionCardCommunication", REG_INPUT, 173, 1, MODEL_MEGA, 0},
+{"setHeatpumpOperationalMode", REG_HOLDING, 0, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatingMaxLimitationSetPointCurveRadiator", REG_HOLDING, 3, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingMinLimitationSetPointCurveRadiator", REG_HOLDING, 4, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingComfortWheelSetting", REG_HOLDING, 5, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingHeatCurveYCoordinate1", REG_HOLDING, 6, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingHeatCurveYCoordinate2", REG_HOLDING, 7, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingHeatCurveYCoordinate3", REG_HOLDING, 8, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingHeatCurveYCoordinate4", REG_HOLDING, 9, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingHeatCurveYCoordinate5", REG_HOLDING, 10, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingHeatCurveYCoordinate6", REG_HOLDING, 11, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingHeatCurveYCoordinate7", REG_HOLDING, 12, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingSeasonStopTemperature", REG_HOLDING, 16, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setTapwaterStartTemperature", REG_HOLDING, 22, 100, MODEL_MEGA | MODEL_INVERTER, 6},
+{"setTapwaterStopTemperature", REG_HOLDING, 23, 100, MODEL_MEGA | MODEL_INVERTER, 6},
+{"setHeatpumpMinAllowedGearHeating", REG_HOLDING, 26, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpMaxAllowedGearHeating", REG_HOLDING, 27, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpMaxAllowedGearTapWater", REG_HOLDING, 28, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpMinAllowedGearTapWater", REG_HOLDING, 29, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setCoolingMixValveSetPoint", REG_HOLDING, 30, 100, MODEL_MEGA, 11},
+{"setTapwaterTwcMixValveSetPoint", REG_HOLDING, 31, 100, MODEL_MEGA | MODEL_INVERTER, 4},
+{"setTapwaterWcsReturnLineSetPoint", REG_HOLDING, 32, 100, MODEL_MEGA, 5},
+{"setTapwaterTwcMixValveLowestAllowedOpeningDegree", REG_HOLDING, 33, 100, MODEL_MEGA | MODEL_INVERTER, 4},
+{"setTapwaterTwcMixValveHighestAllowedOpeningDegree", REG_HOLDING, 34, 100, MODEL_MEGA | MODEL_INVERTER, 4},
+{"setTapwaterTwcStartTemperatureImmersionHeater", REG_HOLDING, 35, 100, MODEL_MEGA | MODEL_INVERTER, 4},
+{"setTapwaterTwcStartDelayImmersionHeater", REG_HOLDING, 36, 100, MODEL_MEGA | MODEL_INVERTER, 4},
+{"setTapwaterTwcStopTemperatureImmersionHeater", REG_HOLDING, 37, 100, MODEL_MEGA | MODEL_INVERTER, 4},
+{"setTapwaterWcsMixValveLowestAllowedOpeningDegree", REG_HOLDING, 38, 100, MODEL_MEGA, 5},
+{"setTapwaterWcsMixValveHighestAllowedOpeningDegree", REG_HOLDING, 39, 100, MODEL_MEGA, 5},
+{"setHeatingMixValve2LowestAllowedOpeningDegree", REG_HOLDING, 40, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve2HighestAllowedOpeningDegree", REG_HOLDING, 41, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve3LowestAllowedOpeningDegree", REG_HOLDING, 42, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve3HighestAllowedOpeningDegree", REG_HOLDING, 43, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve4LowestAllowedOpeningDegree", REG_HOLDING, 44, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve4HighestAllowedOpeningDegree", REG_HOLDING, 45, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve5LowestAllowedOpeningDegree", REG_HOLDING, 46, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setHeatingMixValve5HighestAllowedOpeningDegree", REG_HOLDING, 47, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setCoolingSurplusHeatChillerSetPoint", REG_HOLDING, 48, 100, MODEL_MEGA, 14},
+{"setCoolingSupplyLineMixValveLowestAllowedOpeningDegree", REG_HOLDING, 49, 100, MODEL_MEGA, 11},
+{"setCoolingSupplyLineMixValveHighestAllowedOpeningDegree", REG_HOLDING, 50, 100, MODEL_MEGA, 11},
+{"setCoolingSurplusHeatOpeningDegreeStartFan1", REG_HOLDING, 51, 100, MODEL_MEGA, 14},
+{"setCoolingSurplusHeatOpeningDegreeStartFan2", REG_HOLDING, 52, 100, MODEL_MEGA, 14},
+{"setCoolingSurplusHeatOpeningDegreeStopFan1", REG_HOLDING, 53, 100, MODEL_MEGA, 14},
+{"setCoolingSurplusHeatOpeningDegreeStopFan2", REG_HOLDING, 54, 100, MODEL_MEGA, 14},
+{"setCoolingSurplusHeatLowestAllowedOpeningDegree", REG_HOLDING, 55, 100, MODEL_MEGA, 14},
+{"setCoolingSurplusHeatHighestAllowedOpeningDegree", REG_HOLDING, 56, 100, MODEL_MEGA, 14},
+{"setPoolChargeSetPoint", REG_HOLDING, 58, 100, MODEL_MEGA | MODEL_INVERTER, 13},
+{"setPoolMixValveLowestAllowedOpeningDegree", REG_HOLDING, 59, 100, MODEL_MEGA, 13},
+{"setPoolMixValveHighestAllowedOpeningDegree", REG_HOLDING, 60, 100, MODEL_MEGA, 13},
+{"setHeatpumpGearShiftDelayHeating", REG_HOLDING, 61, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpGearShiftDelayPool", REG_HOLDING, 62, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpGearShiftDelayCooling", REG_HOLDING, 63, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpBrineInHighAlarmLimit", REG_HOLDING, 67, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpBrineInLowAlarmLimit", REG_HOLDING, 68, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpBrineOutLowAlarmLimit", REG_HOLDING, 69, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpBrineMaxDeltaLimit", REG_HOLDING, 70, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setTapwaterHgwPumpStartTemperatureDischargePipe", REG_HOLDING, 71, 100, MODEL_MEGA, 1},
+{"setTapwaterHgwPumpLowerStopLimitTemperatureDischargePipe", REG_HOLDING, 72, 100, MODEL_MEGA, 1},
+{"setTapwaterHgwPumpUpperStopLimitTemperatureDischargePipe", REG_HOLDING, 73, 100, MODEL_MEGA, 1},
+{"setHeatpumpExternalAdditionalHeaterStartPidSum", REG_HOLDING, 75, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpCondenserPumpLowestAllowedSpeed", REG_HOLDING, 76, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpBrinePumpLowestAllowedSpeed", REG_HOLDING, 77, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpExternalAdditionalHeaterStopPidSum", REG_HOLDING, 78, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpCondenserPumpHighestAllowedSpeed", REG_HOLDING, 79, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpBrinePumpHighestAllowedSpeed", REG_HOLDING, 80, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpCondenserPumpStandbySpeed", REG_HOLDING, 81, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpBrinePumpStandbySpeed", REG_HOLDING, 82, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpMinAllowedGearPool", REG_HOLDING, 85, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpMaxAllowedGearPool", REG_HOLDING, 86, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpMinAllowedGearCooling", REG_HOLDING, 87, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatpumpMaxAllowedGearCooling", REG_HOLDING, 88, 1, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setCoolingStartTemp", REG_HOLDING, 105, 100, MODEL_MEGA | MODEL_INVERTER, 16},
+{"setCoolingStopTemp", REG_HOLDING, 106, 100, MODEL_MEGA | MODEL_INVERTER, 16},
+{"setHeatingMixValve1MinLimitationSetPointCurve", REG_HOLDING, 107, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatingMixValve1MaxLimitationSetPointCurve", REG_HOLDING, 108, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatingMixValve1HeatCurveYCoordinate1", REG_HOLDING, 109, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatingMixValve1HeatCurveYCoordinate2", REG_HOLDING, 110, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatingMixValve1HeatCurveYCoordinate3", REG_HOLDING, 111, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatingMixValve1HeatCurveYCoordinate4", REG_HOLDING, 112, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatingMixValve1HeatCurveYCoordinate5", REG_HOLDING, 113, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatingMixValve1HeatCurveYCoordinate6", REG_HOLDING, 114, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatingMixValve1HeatCurveYCoordinate7", REG_HOLDING, 115, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatingFixedSystemSupplySetPoint", REG_HOLDING, 116, 100, MODEL_MEGA | MODEL_INVERTER, 15},
+{"setHeatingMixValve2MinLimitationSetPointCurve", REG_HOLDING, 199, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve2MaxLimitationSetPointCurve", REG_HOLDING, 200, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve2HeatCurveYCoordinate1", REG_HOLDING, 201, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve2HeatCurveYCoordinate2", REG_HOLDING, 202, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve2HeatCurveYCoordinate3", REG_HOLDING, 203, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve2HeatCurveYCoordinate4", REG_HOLDING, 204, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve2HeatCurveYCoordinate5", REG_HOLDING, 205, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve2HeatCurveYCoordinate6", REG_HOLDING, 206, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve2HeatCurveYCoordinate7", REG_HOLDING, 207, 100, MODEL_MEGA | MODEL_INVERTER, 7},
+{"setHeatingMixValve3MinLimitationSetPointCurve", REG_HOLDING, 208, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve3MaxLimitationSetPointCurve", REG_HOLDING, 209, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve3HeatCurveYCoordinate1", REG_HOLDING, 210, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve3HeatCurveYCoordinate2", REG_HOLDING, 211, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve3HeatCurveYCoordinate3", REG_HOLDING, 212, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve3HeatCurveYCoordinate4", REG_HOLDING, 213, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve3HeatCurveYCoordinate5", REG_HOLDING, 214, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve3HeatCurveYCoordinate6", REG_HOLDING, 215, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve3HeatCurveYCoordinate7", REG_HOLDING, 216, 100, MODEL_MEGA | MODEL_INVERTER, 8},
+{"setHeatingMixValve4MinLimitationSetPointCurve", REG_HOLDING, 239, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve4MaxLimitationSetPointCurve", REG_HOLDING, 240, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve4HeatCurveYCoordinate1", REG_HOLDING, 241, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve4HeatCurveYCoordinate2", REG_HOLDING, 242, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve4HeatCurveYCoordinate3", REG_HOLDING, 243, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve4HeatCurveYCoordinate4", REG_HOLDING, 244, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve4HeatCurveYCoordinate5", REG_HOLDING, 245, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve4HeatCurveYCoordinate6", REG_HOLDING, 246, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve4HeatCurveYCoordinate7", REG_HOLDING, 247, 100, MODEL_MEGA | MODEL_INVERTER, 9},
+{"setHeatingMixValve5MinLimitationSetPointCurve", REG_HOLDING, 248, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setHeatingMixValve5MaxLimitationSetPointCurve", REG_HOLDING, 249, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setHeatingMixValve5HeatCurveYCoordinate1", REG_HOLDING, 250, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setHeatingMixValve5HeatCurveYCoordinate2", REG_HOLDING, 251, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setHeatingMixValve5HeatCurveYCoordinate3", REG_HOLDING, 252, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setHeatingMixValve5HeatCurveYCoordinate4", REG_HOLDING, 253, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setHeatingMixValve5HeatCurveYCoordinate5", REG_HOLDING, 254, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setHeatingMixValve5HeatCurveYCoordinate6", REG_HOLDING, 255, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setHeatingMixValve5HeatCurveYCoordinate7", REG_HOLDING, 256, 100, MODEL_MEGA | MODEL_INVERTER, 10},
+{"setPoolReturnTempFromPoolToHeatExchanger", REG_HOLDING, 299, 10, MODEL_MEGA | MODEL_INVERTER, 13},
+{"setPoolHysteresis", REG_HOLDING, 300, 10, MODEL_MEGA | MODEL_INVERTER, 13},
+{"setHeatingMixValve1SupplyLineTempPassiveCooling", REG_HOLDING, 302, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatingMinOutdoorTempCoolingPermitted", REG_HOLDING, 303, 100, MODEL_MEGA | MODEL_INVERTER, 3},
+{"setHeatpumpExternalHeaterOutdoorTempLimit", REG_HOLDING, 304, 100, MODEL_MEGA | MODEL_INVERTER, 0},
+{"setHeatingMixValve2SelectedMode", REG_HOLDING, 305, 1, MODEL_MEGA, 7},
+{"setHeatingMixValve2DesiredCoolingTempSetPoint", REG_HOLDING, 306, 100, MODEL_MEGA, 7},
+{"setHeatingMixValve2SeasonalCoolingTemp", REG_HOLDING, 307, 100, MODEL_MEGA, 7},
+{"setHeatingMixValve2SeasonalHeatingTemp", REG_HOLDING, 308, 100, MODEL_MEGA, 7},
+{"setHeatingMixValve3SelectedMode", REG_HOLDING, 309, 1, MODEL_MEGA, 8},
+{"setHeatingMixValve3DesiredCoolingTempSetPoint", REG_HOLDING, 310, 100, MODEL_MEGA, 8},
+{"setHeatingMixValve3SeasonalCoolingTemp", REG_HOLDING, 311, 100, MODEL_MEGA, 8},
+{"setHeatingMixValve3SeasonalHeatingTemp", REG_HOLDING, 312, 100, MODEL_MEGA, 8},
+{"setHeatingMixValve4SelectedMode", REG_HOLDING, 313, 1, MODEL_MEGA, 9},
+{"setHeatingMixValve4DesiredCoolingTempSetPoint", REG_HOLDING, 314, 100, MODEL_MEGA, 9},
+{"setHeatingMixValve4SeasonalCoolingTemp", REG_HOLDING, 315, 100, MODEL_MEGA, 9},
+{"setHeatingMixValve4SeasonalHeatingTemp", REG_HOLDING, 316, 100, MODEL_MEGA, 9},
+{"setHeatingMixValve5SelectedMode", REG_HOLDING, 317, 1, MODEL_MEGA, 10},
+{"setHeatingMixValve5DesiredCoolingTempSetPoint", REG_HOLDING, 318, 100, MODEL_MEGA, 10},
+{"setHeatingMixValve5SeasonalCoolingTemp", REG_HOLDING, 319, 100, MODEL_MEGA, 10},
+{"setHeatingMixValve5SeasonalHeatingTemp", REG_HOLDING, 320, 100, MODEL_MEGA, 10},
+};
+
+static const register_info_t g_registers_info[] = {
+{4, "Reset all alarms"},
+{5, "Enable internal additional heater"},
+{6, "Enable external additional heater"},
+{7, "Enable HGW"},
+{8, "Enable flow switch/pressure switch"},
+{9, "Enable tap water"},
+{10, "Enable heat"},
+{11, "Enable active cooling"},
+{12, "Enable mix valve 1"},
+{13, "Enable TWC"},
+{14, "Enable WCS"},
+{15, "Enable hot gas pump"},
+{17, "Enable mix valve 2 (EM)"},
+{18, "Enable mix valve 3 (EM)"},
+{19, "Enable mix valve 4 (EM)"},
+{20, "Enable mix valve 5 (EM)"},
+{21, "Enable brine out monitoring"},
+{22, "Enable brine pump continuous operation"},
+{23, "Enable system circulation pump"},
+{24, "Enable dew point calculation"},
+{25, "Enable anti legionella"},
+{26, "Enable additional heater only (No compressor). Requires Operation mode: Standby"},
+{27, "Enable current limitation"},
+{29, "Enable pool (EM)"},
+{30, "Enable surplus heat, chiller (no borehole)"},
+{31, "Enable surplus heat, borehole (no chiller)"},
+{32, "Enable external additional heater for pool (EM)"},
+{33, "Enable internal additional heater for pool (EM)"},
+{34, "Enable passive cooling (EM)"},
+{35, "Enable variable speed mode for condenser pump"},
+{36, "Enable variable speed mode for brine pump"},
+{37, "Enable cooling mode for mixing valve 1"},
+{38, "Enable outdoor temp dependent for cooling with mixing valve 1"},
+{39, "Enable internal brine pump to start when cooling is active for mixing valve 1"},
+{40, "Enable outdoor temp dependent for external heater"},
+{41, "Enable brine in monitoring"},
+{42, "Enable fixed system supply set point, allows defacto address 40117"},
+{43, "Enable evaporator freeze protection"},
+{44, "Enable outdoor temp dependent for cooling with mixing valve 2 (EM3 only)"},
+{45, "Enable dew point calculation on mixing valve 2, requires room sensor for mixing valve 2 (EM3 only)"},
+{46, "Enable outdoor temp dependent for heating with mixing valve 2 (EM3 only)"},
+{47, "Enable outdoor temp dependent for cooling with mixing valve 3 (EM3 only)"},
+{48, "Enable dew point calculation on mixing valve 3, requires room sensor for mixing valve 3 (EM3 only)"},
+{49, "Enable outdoor temp dependent for heating with mixing valve 3 (EM3 only)"},
+{50, "Enable outdoor temp dependent for cooling with mixing valve 4 (EM3 only)"},
+{51, "Enable dew point calculation on mixing valve 4, requires room sensor for mixing valve 4 (EM3 only)"},
+{52, "Enable outdoor temp dependent for heating with mixing valve 4 (EM3 only)"},
+{53, "Enable outdoor temp dependent for cooling with mixing valve 5 (EM3 only)"},
+{54, "Enable dew point calculation on mixing valve 5, requires room sensor for mixing valve 5 (EM3 only)"},
+{55, "Enable outdoor temp dependent for heating with mixing valve 5 (EM3 only)"},
+{56, "Enable internal brine pump to start when cooling is active for mixing valve 2 (EM3 only)"},
+{57, "Enable internal brine pump to start when cooling is active for mixing valve 3 (EM3 only)"},
+{58, "Enable internal brine pump to start when cooling is active for mixing valve 4 (EM3 only)"},
+{59, "Enable internal brine pump to start when cooling is active for mixing valve 5 (EM3 only)"},
+{10001, "Alarm active, Class: A"},
+{10002, "Alarm active, Class: B"},
+{10003, "Alarm active, Class: C"},
+{10004, "Alarm active, Class: D - Genesis secondary"},
+{10005, "Alarm active, Class: E - Legacy secondary"},
+{10010, "High pressure switch alarm"},
+{10011, "Low pressure level alarm"},
+{10012, "High discharge pipe temperature alarm"},
+{10013, "Operating pressure limit indication"},
+{10014, "Discharge pipe sensor alarm"},
+{10015, "Liquid line sensor alarm"},
+{10016, "Suction gas sensor alarm"},
+{10017, "Flow/pressure switch alarm"},
+{10023, "Power input phase detection alarm"},
+{10024, "Inverter unit alarm"},
+{10025, "System supply low temperature alarm"},
+{10026, "Compressor low speed alarm"},
+{10027, "Low super heat alarm"},
+{10028, "Pressure ratio out of range alarm"},
+{10029, "Compressor pressure outside envelope alarm"},
+{10030, "Brine temperature out of range alarm"},
+{10031, "Brine in sensor alarm"},
+{10032, "Brine out sensor alarm"},
+{10033, "Condenser in sensor alarm"},
+{10034, "Condenser out sensor alarm"},
+{10035, "Outdoor sensor alarm"},
+{10036, "System supply line sensor alarm"},
+{10037, "Mix valve 1 supply line sensor alarm"},
+{10038, "Mix valve 2 supply line sensor alarm (EM)"},
+{10039, "Mix valve 3 supply line sensor alarm (EM)"},
+{10040, "Mix valve 4 supply line sensor alarm (EM)"},
+{10041, "Mix valve 5 supply line sensor alarm (EM)"},
+{10045, "WCS return line sensor alarm (EM)"},
+{10046, "TWC supply line sensor alarm (EM)"},
+{10047, "Cooling tank sensor alarm (EM)"},
+{10048, "Cooling supply line sensor alarm (EM)"},
+{10049, "Cooling circuit return line sensor alarm (EM)"},
+{10050, "Brine delta out of range alarm"},
+{10051, "Tap water mid sensor alarm"},
+{10052, "TWC circulation return sensor alarm (EM)"},
+{10053, "HGW sensor alarm"},
+{10054, "Internal additional heater alarm"},
+{10056, "Brine in high temperature alarm"},
+{10057, "Brine in low temperature alarm"},
+{10058, "Brine out low temperature alarm"},
+{10059, "TWC circulation return low temperature alarm (EM)"},
+{10060, "TWC supply low temperature alarm (EM)"},
+{10061, "Mix valve 1 supply temperature deviation alarm"},
+{10062, "Mix valve 2 supply temperature deviation alarm (EM)"},
+{10063, "Mix valve 3 supply temperature deviation alarm (EM)"},
+{10064, "Mix valve 4 supply temperature deviation alarm (EM)"},
+{10065, "Mix valve 5 supply temperature deviation alarm (EM)"},
+{10066, "WCS return line temperature deviation alarm (EM)"},
+{10067, "Sum alarm"},
+{10068, "Cooling circuit supply line temperature deviation alarm (EM)"},
+{10069, "Cooling tank temperature deviation alarm (EM)"},
+{10070, "Surplus heat temperature deviation alarm (EM)"},
+{10071, "Humidity room sensor alarm"},
+{10072, "Surplus heat supply line sensor alarm (EM)"},
+{10073, "Surplus heat return line sensor alarm (EM)"},
+{10074, "Cooling tank return line sensor alarm (EM)"},
+{10075, "Temperature room sensor alarm"},
+{10076, "Inverter unit communication alarm"},
+{10077, "Pool return line sensor alarm"},
+{10078, "External stop for pool, read only"},
+{10079, "External start brine pump, read only"},
+{10080, "External relay for brine/ground water pump."},
+{10082, "Tap water end tank sensor alarm"},
+{10083, "Maximum time for anti-legionella exceeded alarm"},
+{10084, "Genesis secondary unit alarm - this specific secondary unit can't communicate with its primary unit"},
+{10085, "Primary unit alarm - the primary has detected other primary units on the same network with a network mask that is allowing conflict. Change network settings in order to avoid problem. For instance change port number on the primary and its secondary unit."},
+{10086, "Primary unit alarm - the primary has not detected all secondary units. Make sure that the primary/secondary settings are correct and the network mask and port and number of Genesis secondaries settings are correct."},
+{10087, "Oil boost in progress"},
+{10200, "Compressor control signal"},
+{10202, "Smart Grid 1, EVU input"},
+{10203, "External alarm input"},
+{10205, "Smart Grid 2"},
+{10207, "External additional heater control signal"},
+{10210, "Mix valve 1 circulation pump control signal"},
+{10211, "Condenser pump On/off control"},
+{10212, "System circulation pump control signal"},
+{10214, "Hot gas circulation pump control signal"},
+{10219, "Brine pump On/off control"},
+{10220, "External heater circulation pump control signal"},
+{10221, "Heating season (winter) active"},
+{10222, "External additional heater active"},
+{10223, "Internal additional heater active"},
+{10224, "HGW regulation control signal"},
+{10225, "Heat pump stopping"},
+{10226, "Heat pump OK to start"},
+{10231, "TWC supply line circulation pump control signal (EM)"},
+{10233, "WCS regulation control signal (EM)"},
+{10234, "WCS circulation pump control signal (EM)"},
+{10235, "TWC end tank heater control signal (EM)"},
+{10236, "Pool directional valve position (EM)"},
+{10237, "Cooling circuit circulation pump control signal (EM)"},
+{10238, "Pool circulation pump control signal (EM)"},
+{10239, "Surplus heat directional valve position (EM)"},
+{10240, "Surplus heat circulation pump control signal (EM)"},
+{10241, "Cooling circuit regulation control signal (EM)"},
+{10242, "Surplus heat regulation control signal (EM)"},
+{10243, "Active cooling directional valve position (Borehole disconnected) (EM)"},
+{10244, "Passive/Active cooling directional valve position (Cooling tank connected) (EM)"},
+{10245, "Pool regulation control signal (EM)"},
+{10246, "Indication when mixing valve 1 is producing passive cooling"},
+{10247, "Compressor is unable to speed up"},
+{30002, "Currently running: First prioritised demand *1"},
+{30005, "Compressor available gears *3"},
+{30006, "Compressor speed RPM"},
+{30007, "External additional heater: Current demand (%)"},
+{30008, "Discharge pipe temperature"},
+{30009, "Condenser in temperature"},
+{30010, "Condenser out temperature"},
+{30011, "Brine in temperature"},
+{30012, "Brine out temperature"},
+{30013, "System supply line temperature"},
+{30014, "Outdoor temperature"},
+{30016, "Tap water top temperature"},
+{30017, "Tap water lower temperature"},
+{30018, "Tap water weighted temperature"},
+{30019, "System supply line calculated set point"},
+{30020, "Selected heat curve, (system) supply line"},
+{30021, "Heat curve, X-coordinate 1 (highest outdoor temperature)"},
+{30022, "Heat curve, X-coordinate 2"},
+{30023, "Heat curve, X-coordinate 3"},
+{30024, "Heat curve, X-coordinate 4"},
+{30025, "Heat curve, X-coordinate 5"},
+{30026, "Heat curve, X-coordinate 6"},
+{30027, "Heat curve, X-coordinate 7 (lowest outdoor temperature)"},
+{30037, "Cooling season integral value"},
+{30040, "Condenser circulation pump speed (%)"},
+{30041, "Mix valve 1 supply line temperature"},
+{30042, "Buffer tank temperature"},
+{30044, "Mix valve 1 position"},
+{30045, "Brine circulation pump speed (%)"},
+{30046, "HGW supply line temperature"},
+{30048, "Hot water directional valve position (%)"},
+{30049, "Compressor operating hours (MSB)"},
+{30050, "Compressor operating hours (LSB)"},
+{30051, "Tap water operating hours (MSB)"},
+{30052, "Tap water operating hours (LSB)"},
+{30053, "External additional heater operating hours (MSB)"},
+{30054, "External additional heater operating hours (LSB)"},
+{30055, "Compressor speed percent"},
+{30056, "Currently running: Second prioritised demand *1"},
+{30057, "Currently running: Third prioritised demand *1"},
+{30058, "Software version: Major"},
+{30059, "Software version: Minor"},
+{30060, "Software version: Micro"},
+{30061, "Compressor temporarily blocked, (start restriction timer)"},
+{30062, "Compressor current gear"},
+{30063, "Queued demand, first priority *1"},
+{30064, "Queued demand, second priority *1"},
+{30065, "Queued demand, third priority *1"},
+{30066, "Queued demand, fourth priority *1"},
+{30067, "Queued demand, fifth priority *1"},
+{30068, "Internal additional heater current step"},
+{30069, "Buffer tank charge set point"},
+{30070, "Electric meter L1 current (A)"},
+{30071, "Electric meter L2 current (A)"},
+{30072, "Electric meter L3 current (A)"},
+{30073, "Electric meter L1-0 voltage (V)"},
+{30074, "Electric meter L2-0 voltage (V)"},
+{30075, "Electric meter L3-0 voltage (V)"},
+{30076, "Electric meter L1-L2 voltage (V)"},
+{30077, "Electric meter L2-L3 voltage (V)"},
+{30078, "Electric meter L3-L1 voltage (V)"},
+{30079, "Electric meter L1 power (W)"},
+{30080, "Electric meter L2 power (W)"},
+{30081, "Electric meter L3 power (W)"},
+{30082, "Electric meter - meter value (kWh)"},
+{30083, "Comfort mode *4"},
+{30084, "Electric meter kWh total (LSB)"},
+{30085, "Electric meter kWh total (MSB)"},
+{30086, "WCS valve position (EM)"},
+{30087, "TWC valve position (EM)"},
+{30088, "Mix valve 2 position (EM)"},
+{30089, "Mix valve 3 position (EM)"},
+{30090, "Mix valve 4 position (EM)"},
+{30091, "Mix valve 5 position (EM)"},
+{30092, "Dew point room (EM)"},
+{30093, "Cooling supply line mix valve position (EM)"},
+{30094, "Surplus heat fan speed (EM)"},
+{30095, "Pool supply line mix valve position (EM)"},
+{30096, "TWC supply line temperature (EM)"},
+{30097, "TWC return temperature (EM)"},
+{30098, "WCS return line temperature (EM)"},
+{30099, "TWC end tank temperature (EM)"},
+{30100, "Mix valve 2 supply line temperature (EM)"},
+{30101, "Mix valve 3 supply line temperature (EM)"},
+{30102, "Mix valve 4 supply line temperature (EM)"},
+{30104, "Cooling circuit return line temperature (EM)"},
+{30105, "Cooling tank temperature (EM)"},
+{30106, "Cooling tank return line temperature (EM)"},
+{30107, "Cooling circuit supply line temperature (EM)"},
+{30108, "Mix valve 5 supply line temperature (EM)"},
+{30110, "Mix valve 2 return line temperature (EM)"},
+{30112, "Mix valve 3 return line temperature (EM)"},
+{30114, "Mix valve 4 return line temperature (EM)"},
+{30116, "Mix valve 5 return line temperature (EM)"},
+{30118, "Surplus heat return line temperature (EM)"},
+{30119, "Surplus heat supply line temperature (EM)"},
+{30120, "Pool supply line temperature (EM)"},
+{30121, "Pool return line temperature (EM)"},
+{30122, "Room temperature sensor"},
+{30123, "Bubble point, high pressure temperature"},
+{30124, "Dew point, high pressure temperature"},
+{30125, "Dew point, low pressure temperature"},
+{30126, "Superheat temperature"},
+{30127, "Sub cooling temperature"},
+{30128, "Low pressure side, pressure (bar(g))"},
+{30129, "High pressure side, pressure (bar(g))"},
+{30130, "Liquid line temperature"},
+{30131, "Suction gas temperature"},
+{30132, "Heating season integral value"},
+{30133, "P - value for gear shifting and demand calculation"},
+{30134, "I - value for gear shifting and demand calculation"},
+{30135, "D - value for gear shifting and demand calculation"},
+{30136, "I - value for compressor ON/OFF (Buffer tank)"},
+{30137, "P - value for compressor ON/OFF (Buffer tank)"},
+{30138, "Mix valve cooling opening degree (EM2/3)"},
+{30140, "Desired gear for tap water"},
+{30141, "Desired gear for heating"},
+{30142, "Desired gear for cooling"},
+{30143, "Desired gear for pool"},
+{30144, "Number of available secondaries Genesis"},
+{30145, "Number of available secondaries Legacy"},
+{30146, "Total distributed gears to all units"},
+{30147, "Maximum gear out of all the currently requested gears"},
+{30148, "Desired temperature distribution circuit Mix valve 1"},
+{30149, "Desired temperature distribution circuit Mix valve 2"},
+{30150, "Desired temperature distribution circuit Mix valve 3"},
+{30151, "Desired temperature distribution circuit Mix valve 4"},
+{30152, "Desired temperature distribution circuit Mix valve 5"},
+{30153, "Disconnect hot gas end tank, 0 = connected, 1 = disconnected"},
+{30154, "Legacy heat pump compressor running (bit field)"},
+{30155, "Legacy heat pump reporting alarm (bit field)"},
+{30156, "Legacy heat pump start signal (bit field)"},
+{30157, "Legacy heat pump tap water signal (bit field)"},
+{30161, "Primary unit alarm - the combined output of all Class D alarms. This signal is a bit field, one bit for each secondary heat pump unit."},
+{30162, "Primary unit alarm - the primary unit has lost communication with one or more Genesis secondaries. This signal is a bit field, one bit for each heat pump."},
+{30163, "Primary unit alarm - Class A alarm detected on the Genesis secondary heat pump unit. This signal is a bit field, one bit for each secondary heat pump unit."},
+{30164, "Primary unit alarm - Class B alarm detected on the Genesis secondary heat pump unit. This signal is a bit field, one bit for each secondary heat pump unit."},
+{30171, "Primary unit alarm - the combined output of all Class E alarms. This signal is a bit field, one bit for each legacy secondary heat pump unit."},
+{30172, "Primary unit alarm - general legacy heat pump alarm. This signal is a bit field, one bit for each legacy secondary heat pump unit. Detects if the sum alarm of the secondary unit is active."},
+{30174, "Primary unit alarm - the primary unit can not communicate with the corresponding expansion card for the legacy heat pump. This signal is a bit field, one bit for each legacy secondary heat pump unit."},
+{40001, "Operational mode *2"},
+{40004, "Max limitation, set point curve radiator"},
+{40005, "Min limitation, set point curve radiator"},
+{40006, "Comfort wheel setting"},
+{40007, "Set point heat curve, Y-coordinate 1 (highest outdoor temperature)"},
+{40008, "Set point heat curve, Y-coordinate 2"},
+{40009, "Set point heat curve, Y-coordinate 3"},
+{40010, "Set point heat curve, Y-coordinate 4"},
+{40011, "Set point heat curve, Y-coordinate 5"},
+{40012, "Set point heat curve, Y-coordinate 6"},
+{40013, "Set point heat curve, Y-coordinate 7 (lowest outdoor temperature)"},
+{40017, "Heating season stop temperature"},
+{40023, "Start temperature tap water"},
+{40024, "Stop temperature tap water"},
+{40027, "Minimum allowed gear in heating *3"},
+{40028, "Maximum allowed gear in heating *3"},
+{40029, "Maximum allowed gear in tap water *3"},
+{40030, "Minimum allowed gear in tap water *3"},
+{40031, "Cooling mix valve set point (EM)"},
+{40032, "TWC mix valve set point (EM)"},
+{40033, "WCS return line set point (EM)"},
+{40034, "TWC mix valve lowest allowed opening degree (EM)"},
+{40035, "TWC mix valve highest allowed opening degree (EM)"},
+{40036, "TWC start temperature immersion heater (EM)"},
+{40037, "TWC start delay immersion heater, seconds (EM)"},
+{40038, "TWC stop temperature immersion heater (EM)"},
+{40039, "WCS mix valve lowest allowed opening degree (EM)"},
+{40040, "WCS mix valve highest allowed opening degree (EM)"},
+{40041, "Mix valve 2 lowest allowed opening degree (EM)"},
+{40042, "Mix valve 2 highest allowed opening degree (EM)"},
+{40043, "Mix valve 3 lowest allowed opening degree (EM)"},
+{40044, "Mix valve 3 highest allowed opening degree (EM)"},
+{40045, "Mix valve 4 lowest allowed opening degree (EM)"},
+{40046, "Mix valve 4 highest allowed opening degree (EM)"},
+{40047, "Mix valve 5 lowest allowed opening degree (EM)"},
+{40048, "Mix valve 5 highest allowed opening degree (EM)"},
+{40049, "Surplus heat chiller set point (EM)"},
+{40050, "Cooling supply line mix valve: Lowest allowed opening degree (EM)"},
+{40051, "Cooling supply line mix valve: Highest allowed opening degree (EM)"},
+{40052, "Surplus heat opening degree for starting fan 1 (EM)"},
+{40053, "Surplus heat opening degree for starting fan 2 (EM)"},
+{40054, "Surplus heat opening degree for stopping fan 1 (EM)"},
+{40055, "Surplus heat opening degree for stopping fan 2 (EM)"},
+{40056, "Surplus heat lowest allowed opening degree (EM)"},
+{40057, "Surplus heat highest allowed opening degree (EM)"},
+{40059, "Pool charge set point (EM)"},
+{40060, "Pool mix valve lowest allowed opening degree (EM)"},
+{40061, "Pool mix valve highest allowed opening degree (EM)"},
+{40062, "Gear shift delay heating"},
+{40063, "Gear shift delay pool"},
+{40064, "Gear shift delay cooling"},
+{40068, "Brine in high alarm limit"},
+{40069, "Brine in low alarm limit"},
+{40070, "Brine out low alarm limit"},
+{40071, "Brine max delta limit"},
+{40072, "Hot gas pump start temperature discharge pipe"},
+{40073, "Hot gas pump lower stop limit temperature discharge pipe"},
+{40074, "Hot gas pump upper stop limit temperature discharge pipe"},
+{40076, "External additional heater start (PID sum)"},
+{40077, "Condenser pump lowest allowed speed (%)"},
+{40078, "Brine pump lowest allowed speed (%)"},
+{40079, "External additional heater stop (PID sum)"},
+{40080, "Condenser pump highest allowed speed (%)"},
+{40081, "Brine pump highest allowed speed (%)"},
+{40082, "Condenser pump standby speed (%)"},
+{40083, "Brine pump standby speed (%)"},
+{40086, "Minimum allowed gear in pool *3"},
+{40087, "Maximum allowed gear in pool *3"},
+{40088, "Minimum allowed gear in cooling *3"},
+{40089, "Maximum allowed gear in cooling *3"},
+{40106, "Start temp for cooling (EM)"},
+{40107, "Stop temp for cooling (EM)"},
+{40108, "Min limitation Set point curve radiator Mix valve 1"},
+{40109, "Max limitation Set point curve radiator Mix valve 1"},
+{40110, "Set point curve, Y-coordinate 1 Mix valve 1 (highest outdoor temperature)"},
+{40111, "Set point curve, Y-coordinate 2 Mix valve 1"},
+{40112, "Set point curve, Y-coordinate 3 Mix valve 1"},
+{40113, "Set point curve, Y-coordinate 4 Mix valve 1"},
+{40114, "Set point curve, Y-coordinate 5 Mix valve 1"},
+{40115, "Set point curve, Y-coordinate 6 Mix valve 1"},
+{40116, "Set point curve, Y-coordinate 7 Mix valve 1 (lowest outdoor temperature)"},
+{40117, "Fixed system supply set point, requires defacto address 42 to be enabled"},
+{40200, "Min limitation Set point curve radiator Mix valve 2"},
+{40201, "Max limitation Set point curve radiator Mix valve 2"},
+{40202, "Set point curve, Y-coordinate 1 Mix valve 2 (highest outdoor temperature)"},
+{40203, "Set point curve, Y-coordinate 2 Mix valve 2"},
+{40204, "Set point curve, Y-coordinate 3 Mix valve 2"},
+{40205, "Set point curve, Y-coordinate 4 Mix valve 2"},
+{40206, "Set point curve, Y-coordinate 5 Mix valve 2"},
+{40207, "Set point curve, Y-coordinate 6 Mix valve 2"},
+{40208, "Set point curve, Y-coordinate 7 Mix valve 2 (lowest outdoor temperature)"},
+{40209, "Min limitation Set point curve radiator Mix valve 3"},
+{40210, "Max limitation Set point curve radiator Mix valve 3"},
+{40211, "Set point curve, Y-coordinate 1 Mix valve 3 (highest outdoor temperature)"},
+{40212, "Set point curve, Y-coordinate 2 Mix valve 3"},
+{40213, "Set point curve, Y-coordinate 3 Mix valve 3"},
+{40214, "Set point curve, Y-coordinate 4 Mix valve 3"},
+{40215, "Set point curve, Y-coordinate 5 Mix valve 3"},
+{40216, "Set point curve, Y-coordinate 6 Mix valve 3"},
+{40217, "Set point curve, Y-coordinate 7 Mix valve 3 (lowest outdoor temperature)"},
+{40240, "Min limitation Set point curve radiator Mix valve 4"},
+{40241, "Max limitation Set point curve radiator Mix valve 4"},
+{40242, "Set point curve, Y-coordinate 1 Mix valve 4 (highest outdoor temperature)"},
+{40243, "Set point curve, Y-coordinate 2 Mix valve 4"},
+{40244, "Set point curve, Y-coordinate 3 Mix valve 4"},
+{40245, "Set point curve, Y-coordinate 4 Mix valve 4"},
+{40246, "Set point curve, Y-coordinate 5 Mix valve 4"},
+{40247, "Set point curve, Y-coordinate 6 Mix valve 4"},
+{40248, "Set point curve, Y-coordinate 7 Mix valve 4 (lowest outdoor temperature)"},
+{40249, "Min limitation Set point curve radiator Mix valve 5"},
+{40250, "Max limitation Set point curve radiator Mix valve 5"},
+{40251, "Set point curve, Y-coordinate 1 Mix valve 5 (highest outdoor temperature)"},
+{40252, "Set point curve, Y-coordinate 2 Mix valve 5"},
+{40253, "Set point curve, Y-coordinate 3 Mix valve 5"},
+{40254, "Set point curve, Y-coordinate 4 Mix valve 5"},
+{40255, "Set point curve, Y-coordinate 5 Mix valve 5"},
+{40256, "Set point curve, Y-coordinate 6 Mix valve 5"},
+{40257, "Set point curve, Y-coordinate 7 Mix valve 5 (lowest outdoor temperature)"},
+{40300, "Set point return temp from pool to heat exchanger (EM)"},
+{40301, "Set point pool hysteresis (EM)"},
+{40303, "Set point for supply line temp passive cooling with mixing valve 1"},
+{40304, "Set point minimum outdoor temp when cooling is permitted"},
+{40305, "External heater outdoor temp limit"},
+{40306, "Selected mode for mixing valve 2, 0:Heat, 1:Cool, 2:Auto (EM3 only)"},
+{40307, "Desired cooling temperature setpoint mixing valve 2 (EM3 only)"},
+{40308, "Seasonal cooling temperature (outdoor temp.), mixing valve 2 (EM3 only)"},
+{40309, "Seasonal heating temperature (outdoor temp.), mixing valve 2 (EM3 only)"},
+{40310, "Selected mode for mixing valve 3, 0:Heat, 1:Cool, 2:Auto (EM3 only)"},
+{40311, "Desired cooling temperature setpoint mixing valve 3 (EM3 only)"},
+{40312, "Seasonal cooling temperature (outdoor temp.), mixing valve 3 (EM3 only)"},
+{40313, "Seasonal heating temperature (outdoor temp.), mixing valve 3 (EM3 only)"},
+{40314, "Selected mode for mixing valve 4, 0:Heat, 1:Cool, 2:Auto (EM3 only)"},
+{40315, "Desired cooling temperature setpoint mixing valve 4 (EM3 only)"},
+{40316, "Seasonal cooling temperature (outdoor temp.), mixing valve 4 (EM3 only)"},
+{40317, "Seasonal heating temperature (outdoor temp.), mixing valve 4 (EM3 only)"},
+{40318, "Selected mode for mixing valve 5, 0:Heat, 1:Cool, 2:Auto (EM3 only)"},
+{40319, "Desired cooling temperature setpoint mixing valve 5 (EM3 only)"},
+{40320, "Seasonal cooling temperature (outdoor temp.), mixing valve 5 (EM3 only)"},
+{40321, "Seasonal heating temperature (outdoor temp.), mixing valve 5 (EM3 only)"},
+};
+
+#define REGISTERS_SOURCE_HASH 0xfcedc918
@@ -13,6 +13,23 @@ const typeMap = {
 const MODEL_MEGA = 0x01;
 const MODEL_INVERTER = 0x02;
 
+// register type ordering (reg_type_t values) and block read limits: must match common_thermia.c
+const typeOrder = { REG_COIL_STATUS: 0x01, REG_INPUT_STATUS: 0x02, REG_INPUT: 0x04, REG_HOLDING: 0x08 };
+const typeBits = { REG_COIL_STATUS: true, REG_INPUT_STATUS: true, REG_INPUT: false, REG_HOLDING: false };
+const BLOCK_MAX_BITS = 2000; // MODBUS_MAX_READ_BITS
+const BLOCK_MAX_REGISTERS = 125; // MODBUS_MAX_READ_REGISTERS
+const BLOCK_GAP_BITS = 16;
+const BLOCK_GAP_REGISTERS = 4;
+
+// value kinds (value_kind_t in common_thermia.c): registers are signed unless their name says they count up from zero,
+// and a name ending in Msb/Lsb with a partner of the same name is one half of an unsigned 32 bit value
+const unsignedNames = /(Rpm|SoftwareVersion|Voltage|OperatingHours|Kwh)/;
+
+const models = [
+    { name: 'mega', flag: 'MODEL_MEGA', supported: (register) => register.mega },
+    { name: 'inverter', flag: 'MODEL_INVERTER', supported: (register) => register.inverter },
+];
+
 function modelToString(mega, inverter) {
     const flags = [];
     if (mega === '1') flags.push('MODEL_MEGA');
@@ -25,7 +42,241 @@ function escapeString(str) {
     return str.replace(/\\/g, '\\\\').replace(/"/g, '\\"');
 }
 
-function convertCsvToHeader(inputFile, outputFile) {
+// FNV-1a, seeded: must match register_hash() in common_thermia.c
+function hashName(name, seed) {
+    let hash = (0x811c9dc5 ^ seed) >>> 0;
+    for (let i = 0; i < name.length; i++) {
+        hash ^= name.charCodeAt(i);
+        hash = Math.imul(hash, 0x01000193) >>> 0;
+    }
+    return hash;
+}
+
+// minimal perfect hash (hash and displace): names go to buckets by hashName(name, 0), then each bucket, largest first, is
+// given a seed that places all of its names in free slots, with single name buckets taking a free slot directly (-slot - 1)
+function buildPerfectHash(names) {
+    const numSlots = names.length;
+    const numBuckets = Math.max(1, Math.ceil(names.length / 4));
+    const buckets = Array.from({ length: numBuckets }, () => []);
+    names.forEach((name, index) => buckets[hashName(name, 0) % numBuckets].push(index));
+    const seeds = new Array(numBuckets).fill(0);
+    const slots = new Array(numSlots).fill(-1);
+    const order = buckets.map((_, bucket) => bucket).sort((a, b) => buckets[b].length - buckets[a].length);
+    for (const bucket of order) {
+        const members = buckets[bucket];
+        if (members.length === 0) continue;
+        if (members.length === 1) {
+            const slot = slots.indexOf(-1);
+            slots[slot] = members[0];
+            seeds[bucket] = -slot - 1;
+            continue;
+        }
+        for (let seed = 1; ; seed++) {
+            if (seed > 0x7fff) throw new Error(`no perfect hash seed for bucket ${bucket}`);
+            const placed = members.map((index) => hashName(names[index], seed) % numSlots);
+            if (placed.every((slot, i) => slots[slot] === -1 && placed.indexOf(slot) === i)) {
+                placed.forEach((slot, i) => (slots[slot] = members[i]));
+                seeds[bucket] = seed;
+                break;
+            }
+        }
+    }
+    return { seeds, slots };
+}
+
+function buildValueKinds(registers) {
+    const byName = new Map(registers.map((register, index) => [register.name, index]));
+    const pairs = [];
+    const kinds = registers.map((register, index) => {
+        if (typeBits[register.type]) return 'VALUE_BIT';
+        const half = register.name.match(/^(.*)(Msb|Lsb)$/);
+        if (half) {
+            const partner = byName.get(half[1] + (half[2] === 'Msb' ? 'Lsb' : 'Msb'));
+            if (partner !== undefined) {
+                if (half[2] === 'Msb') pairs.push(`{${index}, ${partner}}`);
+                return half[2] === 'Msb' ? 'VALUE_U32_MSB' : 'VALUE_U32_LSB';
+            }
+        }
+        return unsignedNames.test(register.name) ? 'VALUE_U16' : 'VALUE_S16';
+    });
+    const multipliers = registers.map((register) => String(1 / register.scale));
+    return { kinds, multipliers, pairs };
+}
+
+// a table that breaks lookups or block planning fails generation, and the build: duplicate names or type and address,
+// scales that are not positive (scaling divides by them), and scales or addresses that do not fit the packed table
+function validateRegisters(registers) {
+    const errors = [];
+    const names = new Map();
+    const addresses = new Map();
+    for (const register of registers) {
+        const address = `${register.type} ${register.address}`;
+        if (names.has(register.name)) errors.push(`Duplicate name '${register.name}'`);
+        if (addresses.has(address)) errors.push(`Duplicate address ${register.address} (${register.type}) for '${register.name}' and '${addresses.get(address)}'`);
+        if (!(register.scale > 0)) errors.push(`Scale must be > 0 for '${register.name}'`);
+        if (register.scale > 0xffff) errors.push(`Scale must fit 16 bits for '${register.name}'`);
+        if (!(register.address >= 0 && register.address <= 0xffff)) errors.push(`Address must fit 16 bits for '${register.name}'`);
+        names.set(register.name, true);
+        addresses.set(address, register.name);
+    }
+    return errors;
+}
+
+function formatArray(values, perLine = 16) {
+    const lines = [];
+    for (let i = 0; i < values.length; i += perLine) lines.push('    ' + values.slice(i, i + perLine).join(', ') + ',');
+    return lines.join('\n');
+}
+
+// per model: supported registers ordered by type then address, merged into block read runs (nearby addresses of one
+// type, allowing small gaps, within the PDU limits), with each register's position in that order and each position's run
+function buildModelTable(registers, model) {
+    const order = registers
+        .map((_, index) => index)
+        .filter((index) => model.supported(registers[index]))
+        .sort((a, b) => typeOrder[registers[a].type] - typeOrder[registers[b].type] || registers[a].address - registers[b].address);
+    const positions = new Array(registers.length).fill(-1);
+    order.forEach((index, position) => (positions[index] = position));
+    const runs = [];
+    const runOf = [];
+    for (let start = 0, end; start < order.length; start = end) {
+        const first = registers[order[start]];
+        const limit = typeBits[first.type] ? BLOCK_MAX_BITS : BLOCK_MAX_REGISTERS;
+        const gap = typeBits[first.type] ? BLOCK_GAP_BITS : BLOCK_GAP_REGISTERS;
+        for (end = start + 1; end < order.length; end++) {
+            const register = registers[order[end]];
+            if (register.type !== first.type || register.address - registers[order[end - 1]].address > gap + 1 || register.address - first.address >= limit) break;
+        }
+        const length = registers[order[end - 1]].address - first.address + 1;
+        for (let position = start; position < end; position++) runOf.push(runs.length);
+        runs.push(`{${first.type}, ${first.address}, ${length}, ${start}, ${end - start}}`);
+    }
+    return { order, positions, runs, runOf };
+}
+
+// groups by system and subsystem, in order of first appearance
+function buildGroups(registers) {
+    const groups = [];
+    const keys = new Map();
+    registers.forEach((register, index) => {
+        const key = `${register.system}/${register.subsystem}`;
+        if (!keys.has(key)) {
+            keys.set(key, groups.length);
+            groups.push({ system: register.system, subsystem: register.subsystem, members: [] });
+        }
+        groups[keys.get(key)].members.push(index);
+    });
+    return groups;
+}
+
+// per model and group: the positions of its supported registers in the model order, and its block read plan, each model
+// run holding any of them trimmed to their span (first and count index the positions of all groups)
+function buildModelGroupTable(registers, groups, order, positions, runOf) {
+    const groupPositions = [];
+    const groupRuns = [];
+    const plans = [];
+    for (const group of groups) {
+        const members = group.members
+            .map((index) => positions[index])
+            .filter((position) => position >= 0)
+            .sort((a, b) => a - b);
+        const first = groupPositions.length, runsFirst = groupRuns.length;
+        groupPositions.push(...members);
+        for (let start = 0, end; start < members.length; start = end) {
+            for (end = start + 1; end < members.length && runOf[members[end]] === runOf[members[start]]; end++);
+            const head = registers[order[members[start]]], tail = registers[order[members[end - 1]]];
+            groupRuns.push(`{${head.type}, ${head.address}, ${tail.address - head.address + 1}, ${first + start}, ${end - start}}`);
+        }
+        plans.push(`{${first}, ${members.length}, ${runsFirst}, ${groupRuns.length - runsFirst}}`);
+    }
+    return { groupPositions, groupRuns, plans };
+}
+
+function convertIndexToHeader(registers, groups, sourceHash, outputFile) {
+    const names = registers.map((register) => register.name);
+    const { seeds, slots } = buildPerfectHash(names);
+    const output = [];
+    output.push('// Auto-generated from CSV - do not edit manually');
+    output.push(`// Generated: ${new Date().toISOString()}`);
+    output.push('');
+    output.push('/* clang-format off */');
+    output.push('');
+    output.push(`#define REGISTERS_INDEX_SOURCE_HASH 0x${sourceHash.toString(16).padStart(8, '0')}`);
+    output.push('');
+    // checked again by the compiler, should the table be edited by hand: a duplicate name or type and address is a
+    // redeclared enumerator, a scale that is not positive a failed assertion
+    output.push('enum {');
+    output.push(registers.map((register) => `    REGISTERS_NAME_${register.name},`).join('\n'));
+    output.push('};');
+    output.push('enum {');
+    output.push(registers.map((register) => `    REGISTERS_ADDRESS_${register.type}_${register.address},`).join('\n'));
+    output.push('};');
+    output.push(registers.map((register) => `_Static_assert(${register.scale} > 0, "scale of '${register.name}' must be > 0");`).join('\n'));
+    output.push('');
+    output.push(`#define REGISTERS_HASH_BUCKETS ${seeds.length}`);
+    output.push(`#define REGISTERS_HASH_SLOTS ${slots.length}`);
+    output.push('');
+    output.push('static const int16_t g_registers_hash_seeds[REGISTERS_HASH_BUCKETS] = {');
+    output.push(formatArray(seeds));
+    output.push('};');
+    output.push('static const uint16_t g_registers_hash_slots[REGISTERS_HASH_SLOTS] = {');
+    output.push(formatArray(slots));
+    output.push('};');
+    const { kinds, multipliers, pairs } = buildValueKinds(registers);
+    output.push('');
+    output.push(`#define REGISTERS_VALUE_PAIRS ${pairs.length}`);
+    output.push('');
+    output.push('static const uint8_t g_registers_kinds[REGISTERS_HASH_SLOTS] = {');
+    output.push(formatArray(kinds, 8));
+    output.push('};');
+    output.push('static const double g_registers_multipliers[REGISTERS_HASH_SLOTS] = {');
+    output.push(formatArray(multipliers));
+    output.push('};');
+    output.push('static const uint16_t g_registers_value_pairs[REGISTERS_VALUE_PAIRS][2] = {');
+    output.push(formatArray(pairs, 8));
+    output.push('};');
+    const summary = [];
+    for (const model of models) {
+        const { order, positions, runs, runOf } = buildModelTable(registers, model);
+        const { groupPositions, groupRuns, plans } = buildModelGroupTable(registers, groups, order, positions, runOf);
+        output.push('');
+        output.push(`static const uint16_t g_registers_${model.name}_order[${order.length}] = {`);
+        output.push(formatArray(order));
+        output.push('};');
+        output.push(`static const int16_t g_registers_${model.name}_positions[REGISTERS_HASH_SLOTS] = {`);
+        output.push(formatArray(positions));
+        output.push('};');
+        output.push(`static const uint16_t g_registers_${model.name}_runs_of[${runOf.length}] = {`);
+        output.push(formatArray(runOf));
+        output.push('};');
+        output.push(`static const register_run_t g_registers_${model.name}_runs[${runs.length}] = {`);
+        output.push(formatArray(runs, 4));
+        output.push('};');
+        output.push(`static const uint16_t g_registers_${model.name}_group_positions[${groupPositions.length}] = {`);
+        output.push(formatArray(groupPositions));
+        output.push('};');
+        output.push(`static const register_run_t g_registers_${model.name}_group_runs[${groupRuns.length}] = {`);
+        output.push(formatArray(groupRuns, 4));
+        output.push('};');
+        output.push(`static const register_group_plan_t g_registers_${model.name}_groups[REGISTERS_GROUPS] = {`);
+        output.push(formatArray(plans, 8));
+        output.push('};');
+        summary.push(`${model.name}: ${order.length} registers in ${runs.length} runs, ${groups.length} groups in ${groupRuns.length} runs`);
+    }
+    output.push('');
+    output.push('static const register_model_table_t g_registers_models[] = {');
+    for (const model of models)
+        output.push(
+            `    {${model.flag}, g_registers_${model.name}_order, g_registers_${model.name}_positions, g_registers_${model.name}_runs_of, ` +
+                `sizeof(g_registers_${model.name}_order) / sizeof(uint16_t), g_registers_${model.name}_runs, sizeof(g_registers_${model.name}_runs) / sizeof(register_run_t), ` +
+                `g_registers_${model.name}_groups, g_registers_${model.name}_group_positions, g_registers_${model.name}_group_runs},`
+        );
+    output.push('};');
+    fs.writeFileSync(outputFile, output.join('\n') + '\n');
+    console.log(`Generated ${outputFile} with perfect hash for ${names.length} register names, ${pairs.length} u32 pairs, ${summary.join(', ')}`);
+}
+
+function convertCsvToHeader(inputFile, outputFile, indexFile) {
     const content = fs.readFileSync(inputFile, 'utf8');
     const lines = content.split('\n');
 
@@ -33,7 +284,11 @@ function convertCsvToHeader(inputFile, outputFile) {
     output.push('// Auto-generated from CSV - do not edit manually');
     output.push(`// Generated: ${new Date().toISOString()}`);
     output.push('');
+    output.push('/* clang-format off */');
+    output.push('');
 
+    const registers = [];
+    const errors = [];
     let headerSkipped = false;
     let count = 0;
 
@@ -47,23 +302,64 @@ function convertCsvToHeader(inputFile, outputFile) {
             }
         const fields = parseCSVLine(trimmed);
         if (fields.length < 10) {
-            console.error(`Skipping malformed line: ${trimmed}`);
+            errors.push(`Malformed line: ${trimmed}`);
             continue;
         }
         const [name, type, address, defacto, scale, mega, inverter, system, subsystem, ...descParts] = fields;
         const description = descParts.join(',');
         const regType = typeMap[type];
         if (!regType) {
-            console.error(`Unknown type '${type}' for register '${name}'`);
+            errors.push(`Unknown type '${type}' for register '${name}'`);
             continue;
         }
-        const modelStr = modelToString(mega, inverter);
         const cleanDesc = escapeString(description.replace(/^"|"$/g, '')); // Remove surrounding quotes
-        output.push(`    {"${name}", ${regType}, ${address}, ${defacto}, ${scale}, ${modelStr}, "${system}", "${subsystem}", "${cleanDesc}"},`);
+        registers.push({
+            name,
+            type: regType,
+            address: parseInt(address, 10),
+            defacto,
+            scale: parseInt(scale, 10),
+            model: modelToString(mega, inverter),
+            system,
+            subsystem,
+            description: cleanDesc,
+            mega: mega === '1',
+            inverter: inverter === '1',
+        });
         count++;
     }
+    errors.push(...validateRegisters(registers));
+    if (errors.length > 0) {
+        for (const error of errors) console.error(`${inputFile}: ${error}`);
+        process.exit(1); // nothing written, so make fails and the previous headers stay
+    }
+    // hot fields in one compact row per register, system and subsystem interned as the register's group, and the
+    // rest, only read to describe a register, in a separate table
+    const groups = buildGroups(registers);
+    const groupOf = new Array(registers.length);
+    groups.forEach((group, index) => group.members.forEach((member) => (groupOf[member] = index)));
+    output.push(`#define REGISTERS_GROUPS ${groups.length}`);
+    output.push('');
+    output.push('static const register_group_t g_registers_groups[REGISTERS_GROUPS] = {');
+    output.push(formatArray(groups.map((group) => `{"${group.system}", "${group.subsystem}"}`), 4));
+    output.push('};');
+    output.push('');
+    output.push('static const register_def_t g_registers[] = {');
+    registers.forEach((register, index) =>
+        output.push(`{"${register.name}", ${register.type}, ${register.address}, ${register.scale}, ${register.model}, ${groupOf[index]}},`)
+    );
+    output.push('};');
+    output.push('');
+    output.push('static const register_info_t g_registers_info[] = {');
+    registers.forEach((register) => output.push(`{${register.defacto}, "${register.description}"},`));
+    output.push('};');
+    output.push('');
+    // both headers carry a hash of the source, checked to match at compile time
+    const sourceHash = hashName(content, 0);
+    output.push(`#define REGISTERS_SOURCE_HASH 0x${sourceHash.toString(16).padStart(8, '0')}`);
     fs.writeFileSync(outputFile, output.join('\n') + '\n');
-    console.log(`Generated ${outputFile} with ${count} register definitions`);
+    console.log(`Generated ${outputFile} with ${count} register definitions in ${groups.length} groups`);
+    convertIndexToHeader(registers, groups, sourceHash, indexFile);
 }
 
 function parseCSVLine(line) {
@@ -84,14 +380,15 @@ function parseCSVLine(line) {
 
 const args = process.argv.slice(2);
 if (args.length < 1) {
-    console.log('Usage: node csv2header.js <input.csv> [output.h]');
-    console.log('       Default output: common_thermia_registers.h');
+    console.log('Usage: node csv2header.js <input.csv> [output.h] [index.h]');
+    console.log('       Default output: common_thermia_registers.h, common_thermia_registers_index.h');
     process.exit(1);
 }
 const inputFile = args[0];
 const outputFile = args[1] || 'common_thermia_registers.h';
+const indexFile = args[2] || outputFile.replace(/\.h$/, '') + '_index.h';
 if (!fs.existsSync(inputFile)) {
     console.error(`Input file not found: ${inputFile}`);
     process.exit(1);
 }
-convertCsvToHeader(inputFile, outputFile);
+convertCsvToHeader(inputFile, outputFile, indexFile);
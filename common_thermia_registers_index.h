@@ -0,0 +1,1754 @@
+// Auto-generated from CSV - do not edit manually
+// Generated: 2026-10-14T11:33:47.554Z
+
+/* clang-format off */
+
+#define REGISTERS_INDEX_SOURCE_HASH 0xfcedc918
+
+enum {
+    REGISTERS_NAME_enableHeatpumpResetAllAlarms,
+    REGISTERS_NAME_enableHeatpumpInternalAdditionalHeater,
+    REGISTERS_NAME_enableHeatpumpExternalAdditionalHeater,
+    REGISTERS_NAME_enableTapwaterHgw,
+    REGISTERS_NAME_enableHeatpumpFlowPressureSwitch,
+    REGISTERS_NAME_enableHeatpumpTapWater,
+    REGISTERS_NAME_enableHeatpumpHeat,
+    REGISTERS_NAME_enableCoolingActiveCooling,
+    REGISTERS_NAME_enableHeatingMixValve1,
+    REGISTERS_NAME_enableTapwaterTwc,
+    REGISTERS_NAME_enableTapwaterWcs,
+    REGISTERS_NAME_enableTapwaterHotGasPump,
+    REGISTERS_NAME_enableHeatingMixValve2,
+    REGISTERS_NAME_enableHeatingMixValve3,
+    REGISTERS_NAME_enableHeatingMixValve4,
+    REGISTERS_NAME_enableHeatingMixValve5,
+    REGISTERS_NAME_enableHeatpumpBrineOutMonitoring,
+    REGISTERS_NAME_enableHeatpumpBrinePumpContinuousOperation,
+    REGISTERS_NAME_enableHeatpumpSystemCirculationPump,
+    REGISTERS_NAME_enableCoolingDewPointCalculation,
+    REGISTERS_NAME_enableTapwaterAntiLegionella,
+    REGISTERS_NAME_enableHeatpumpAdditionalHeaterOnly,
+    REGISTERS_NAME_enableElectricCurrentLimitation,
+    REGISTERS_NAME_enablePoolPool,
+    REGISTERS_NAME_enableCoolingSurplusHeatChiller,
+    REGISTERS_NAME_enableCoolingSurplusHeatBorehole,
+    REGISTERS_NAME_enablePoolExternalAdditionalHeater,
+    REGISTERS_NAME_enablePoolInternalAdditionalHeater,
+    REGISTERS_NAME_enableCoolingPassiveCooling,
+    REGISTERS_NAME_enableHeatpumpVariableSpeedCondenserPump,
+    REGISTERS_NAME_enableHeatpumpVariableSpeedBrinePump,
+    REGISTERS_NAME_enableHeatingMixValve1CoolingMode,
+    REGISTERS_NAME_enableHeatingMixValve1OutdoorTempCooling,
+    REGISTERS_NAME_enableHeatingMixValve1BrinePumpOnCooling,
+    REGISTERS_NAME_enableHeatpumpOutdoorTempExternalHeater,
+    REGISTERS_NAME_enableHeatpumpBrineInMonitoring,
+    REGISTERS_NAME_enableHeatingFixedSystemSupplySetPoint,
+    REGISTERS_NAME_enableHeatpumpEvaporatorFreezeProtection,
+    REGISTERS_NAME_enableHeatingMixValve2OutdoorTempCooling,
+    REGISTERS_NAME_enableHeatingMixValve2DewPointCalculation,
+    REGISTERS_NAME_enableHeatingMixValve2OutdoorTempHeating,
+    REGISTERS_NAME_enableHeatingMixValve3OutdoorTempCooling,
+    REGISTERS_NAME_enableHeatingMixValve3DewPointCalculation,
+    REGISTERS_NAME_enableHeatingMixValve3OutdoorTempHeating,
+    REGISTERS_NAME_enableHeatingMixValve4OutdoorTempCooling,
+    REGISTERS_NAME_enableHeatingMixValve4DewPointCalculation,
+    REGISTERS_NAME_enableHeatingMixValve4OutdoorTempHeating,
+    REGISTERS_NAME_enableHeatingMixValve5OutdoorTempCooling,
+    REGISTERS_NAME_enableHeatingMixValve5DewPointCalculation,
+    REGISTERS_NAME_enableHeatingMixValve5OutdoorTempHeating,
+    REGISTERS_NAME_enableHeatingMixValve2BrinePumpOnCooling,
+    REGISTERS_NAME_enableHeatingMixValve3BrinePumpOnCooling,
+    REGISTERS_NAME_enableHeatingMixValve4BrinePumpOnCooling,
+    REGISTERS_NAME_enableHeatingMixValve5BrinePumpOnCooling,
+    REGISTERS_NAME_alarmHeatpumpClassA,
+    REGISTERS_NAME_alarmHeatpumpClassB,
+    REGISTERS_NAME_alarmHeatpumpClassC,
+    REGISTERS_NAME_alarmHeatpumpClassDGenesisSecondary,
+    REGISTERS_NAME_alarmHeatpumpClassELegacySecondary,
+    REGISTERS_NAME_alarmHeatpumpHighPressureSwitch,
+    REGISTERS_NAME_alarmHeatpumpLowPressureLevel,
+    REGISTERS_NAME_alarmHeatpumpHighDischargePipeTemperature,
+    REGISTERS_NAME_alarmHeatpumpOperatingPressureLimit,
+    REGISTERS_NAME_alarmHeatpumpDischargePipeSensor,
+    REGISTERS_NAME_alarmHeatpumpLiquidLineSensor,
+    REGISTERS_NAME_alarmHeatpumpSuctionGasSensor,
+    REGISTERS_NAME_alarmHeatpumpFlowPressureSwitch,
+    REGISTERS_NAME_alarmHeatpumpPowerInputPhaseDetection,
+    REGISTERS_NAME_alarmHeatpumpInverterUnit,
+    REGISTERS_NAME_alarmHeatingSystemSupplyLowTemperature,
+    REGISTERS_NAME_alarmHeatpumpCompressorLowSpeed,
+    REGISTERS_NAME_alarmHeatpumpLowSuperHeat,
+    REGISTERS_NAME_alarmHeatpumpPressureRatioOutOfRange,
+    REGISTERS_NAME_alarmHeatpumpCompressorPressureOutsideEnvelope,
+    REGISTERS_NAME_alarmHeatpumpBrineTemperatureOutOfRange,
+    REGISTERS_NAME_alarmHeatpumpBrineInSensor,
+    REGISTERS_NAME_alarmHeatpumpBrineOutSensor,
+    REGISTERS_NAME_alarmHeatpumpCondenserInSensor,
+    REGISTERS_NAME_alarmHeatpumpCondenserOutSensor,
+    REGISTERS_NAME_alarmHeatpumpOutdoorSensor,
+    REGISTERS_NAME_alarmHeatingSystemSupplyLineSensor,
+    REGISTERS_NAME_alarmHeatingMixValve1SupplyLineSensor,
+    REGISTERS_NAME_alarmHeatingMixValve2SupplyLineSensor,
+    REGISTERS_NAME_alarmHeatingMixValve3SupplyLineSensor,
+    REGISTERS_NAME_alarmHeatingMixValve4SupplyLineSensor,
+    REGISTERS_NAME_alarmHeatingMixValve5SupplyLineSensor,
+    REGISTERS_NAME_alarmTapwaterWcsReturnLineSensor,
+    REGISTERS_NAME_alarmTapwaterTwcSupplyLineSensor,
+    REGISTERS_NAME_alarmCoolingTankSensor,
+    REGISTERS_NAME_alarmCoolingSupplyLineSensor,
+    REGISTERS_NAME_alarmCoolingCircuitReturnLineSensor,
+    REGISTERS_NAME_alarmHeatpumpBrineDeltaOutOfRange,
+    REGISTERS_NAME_alarmTapwaterMidSensor,
+    REGISTERS_NAME_alarmTapwaterTwcCirculationReturnSensor,
+    REGISTERS_NAME_alarmTapwaterHgwSensor,
+    REGISTERS_NAME_alarmHeatpumpInternalAdditionalHeater,
+    REGISTERS_NAME_alarmHeatpumpBrineInHighTemperature,
+    REGISTERS_NAME_alarmHeatpumpBrineInLowTemperature,
+    REGISTERS_NAME_alarmHeatpumpBrineOutLowTemperature,
+    REGISTERS_NAME_alarmTapwaterTwcCirculationReturnLowTemperature,
+    REGISTERS_NAME_alarmTapwaterTwcSupplyLowTemperature,
+    REGISTERS_NAME_alarmHeatingMixValve1SupplyTemperatureDeviation,
+    REGISTERS_NAME_alarmHeatingMixValve2SupplyTemperatureDeviation,
+    REGISTERS_NAME_alarmHeatingMixValve3SupplyTemperatureDeviation,
+    REGISTERS_NAME_alarmHeatingMixValve4SupplyTemperatureDeviation,
+    REGISTERS_NAME_alarmHeatingMixValve5SupplyTemperatureDeviation,
+    REGISTERS_NAME_alarmTapwaterWcsReturnLineTemperatureDeviation,
+    REGISTERS_NAME_alarmHeatpumpSum,
+    REGISTERS_NAME_alarmCoolingCircuitSupplyLineTemperatureDeviation,
+    REGISTERS_NAME_alarmCoolingTankTemperatureDeviation,
+    REGISTERS_NAME_alarmCoolingSurplusHeatTemperatureDeviation,
+    REGISTERS_NAME_alarmCoolingHumidityRoomSensor,
+    REGISTERS_NAME_alarmCoolingSurplusHeatSupplyLineSensor,
+    REGISTERS_NAME_alarmCoolingSurplusHeatReturnLineSensor,
+    REGISTERS_NAME_alarmCoolingTankReturnLineSensor,
+    REGISTERS_NAME_alarmHeatingTemperatureRoomSensor,
+    REGISTERS_NAME_alarmHeatpumpInverterUnitCommunication,
+    REGISTERS_NAME_alarmPoolReturnLineSensor,
+    REGISTERS_NAME_statusPoolExternalStop,
+    REGISTERS_NAME_statusCoolingExternalStartBrinePump,
+    REGISTERS_NAME_statusHeatpumpExternalRelayBrineGroundWaterPump,
+    REGISTERS_NAME_alarmTapwaterEndTankSensor,
+    REGISTERS_NAME_alarmTapwaterMaxTimeAntiLegionellaExceeded,
+    REGISTERS_NAME_alarmHeatpumpGenesisSecondaryUnitCommunication,
+    REGISTERS_NAME_alarmHeatpumpPrimaryUnitNetworkConflict,
+    REGISTERS_NAME_alarmHeatpumpPrimaryUnitSecondariesNotDetected,
+    REGISTERS_NAME_statusHeatpumpOilBoostInProgress,
+    REGISTERS_NAME_statusHeatpumpCompressorControl,
+    REGISTERS_NAME_statusHeatpumpSmartGrid1Evu,
+    REGISTERS_NAME_statusHeatpumpExternalAlarmInput,
+    REGISTERS_NAME_statusHeatpumpSmartGrid2,
+    REGISTERS_NAME_statusHeatpumpExternalAdditionalHeaterControl,
+    REGISTERS_NAME_statusHeatingMixValve1CirculationPumpControl,
+    REGISTERS_NAME_statusHeatpumpCondenserPumpOnOff,
+    REGISTERS_NAME_statusHeatingSystemCirculationPumpControl,
+    REGISTERS_NAME_statusTapwaterHotGasCirculationPumpControl,
+    REGISTERS_NAME_statusHeatpumpBrinePumpOnOff,
+    REGISTERS_NAME_statusHeatpumpExternalHeaterCirculationPumpControl,
+    REGISTERS_NAME_statusHeatingSeasonWinterActive,
+    REGISTERS_NAME_statusHeatpumpExternalAdditionalHeaterActive,
+    REGISTERS_NAME_statusHeatpumpInternalAdditionalHeaterActive,
+    REGISTERS_NAME_statusTapwaterHgwRegulationControl,
+    REGISTERS_NAME_statusHeatpumpStopping,
+    REGISTERS_NAME_statusHeatpumpOkToStart,
+    REGISTERS_NAME_statusTapwaterTwcSupplyLineCirculationPumpControl,
+    REGISTERS_NAME_statusTapwaterWcsRegulationControl,
+    REGISTERS_NAME_statusTapwaterWcsCirculationPumpControl,
+    REGISTERS_NAME_statusTapwaterTwcEndTankHeaterControl,
+    REGISTERS_NAME_statusPoolDirectionalValvePosition,
+    REGISTERS_NAME_statusCoolingCircuitCirculationPumpControl,
+    REGISTERS_NAME_statusPoolCirculationPumpControl,
+    REGISTERS_NAME_statusCoolingSurplusHeatDirectionalValvePosition,
+    REGISTERS_NAME_statusCoolingSurplusHeatCirculationPumpControl,
+    REGISTERS_NAME_statusCoolingCircuitRegulationControl,
+    REGISTERS_NAME_statusCoolingSurplusHeatRegulationControl,
+    REGISTERS_NAME_statusCoolingActiveCoolingDirectionalValvePosition,
+    REGISTERS_NAME_statusCoolingPassiveActiveCoolingDirectionalValvePosition,
+    REGISTERS_NAME_statusPoolRegulationControl,
+    REGISTERS_NAME_statusHeatingMixValve1ProducingPassiveCooling,
+    REGISTERS_NAME_statusHeatpumpCompressorUnableToSpeedUp,
+    REGISTERS_NAME_valueHeatpumpCurrentlyRunningFirstPrioritisedDemand,
+    REGISTERS_NAME_valueHeatpumpCompressorAvailableGears,
+    REGISTERS_NAME_valueHeatpumpCompressorSpeedRpm,
+    REGISTERS_NAME_valueHeatpumpExternalAdditionalHeaterCurrentDemand,
+    REGISTERS_NAME_valueHeatpumpDischargePipeTemperature,
+    REGISTERS_NAME_valueHeatpumpCondenserInTemperature,
+    REGISTERS_NAME_valueHeatpumpCondenserOutTemperature,
+    REGISTERS_NAME_valueHeatpumpBrineInTemperature,
+    REGISTERS_NAME_valueHeatpumpBrineOutTemperature,
+    REGISTERS_NAME_valueHeatingSystemSupplyLineTemperature,
+    REGISTERS_NAME_valueHeatpumpOutdoorTemperature,
+    REGISTERS_NAME_valueTapwaterTopTemperature,
+    REGISTERS_NAME_valueTapwaterLowerTemperature,
+    REGISTERS_NAME_valueTapwaterWeightedTemperature,
+    REGISTERS_NAME_valueHeatingSystemSupplyLineCalculatedSetPoint,
+    REGISTERS_NAME_valueHeatingSelectedHeatCurveSystemSupplyLine,
+    REGISTERS_NAME_valueHeatingHeatCurveXCoordinate1,
+    REGISTERS_NAME_valueHeatingHeatCurveXCoordinate2,
+    REGISTERS_NAME_valueHeatingHeatCurveXCoordinate3,
+    REGISTERS_NAME_valueHeatingHeatCurveXCoordinate4,
+    REGISTERS_NAME_valueHeatingHeatCurveXCoordinate5,
+    REGISTERS_NAME_valueHeatingHeatCurveXCoordinate6,
+    REGISTERS_NAME_valueHeatingHeatCurveXCoordinate7,
+    REGISTERS_NAME_valueCoolingSeasonIntegralValue,
+    REGISTERS_NAME_valueHeatpumpCondenserCirculationPumpSpeed,
+    REGISTERS_NAME_valueHeatingMixValve1SupplyLineTemperature,
+    REGISTERS_NAME_valueHeatingBufferTankTemperature,
+    REGISTERS_NAME_valueHeatingMixValve1Position,
+    REGISTERS_NAME_valueHeatpumpBrineCirculationPumpSpeed,
+    REGISTERS_NAME_valueTapwaterHgwSupplyLineTemperature,
+    REGISTERS_NAME_valueTapwaterHgwDirectionalValvePosition,
+    REGISTERS_NAME_valueHeatpumpCompressorOperatingHoursMsb,
+    REGISTERS_NAME_valueHeatpumpCompressorOperatingHoursLsb,
+    REGISTERS_NAME_valueTapwaterOperatingHoursMsb,
+    REGISTERS_NAME_valueTapwaterOperatingHoursLsb,
+    REGISTERS_NAME_valueHeatpumpExternalAdditionalHeaterOperatingHoursMsb,
+    REGISTERS_NAME_valueHeatpumpExternalAdditionalHeaterOperatingHoursLsb,
+    REGISTERS_NAME_valueHeatpumpCompressorSpeedPercent,
+    REGISTERS_NAME_valueHeatpumpCurrentlyRunningSecondPrioritisedDemand,
+    REGISTERS_NAME_valueHeatpumpCurrentlyRunningThirdPrioritisedDemand,
+    REGISTERS_NAME_valueHeatpumpSoftwareVersionMajor,
+    REGISTERS_NAME_valueHeatpumpSoftwareVersionMinor,
+    REGISTERS_NAME_valueHeatpumpSoftwareVersionMicro,
+    REGISTERS_NAME_valueHeatpumpCompressorTemporarilyBlocked,
+    REGISTERS_NAME_valueHeatpumpCompressorCurrentGear,
+    REGISTERS_NAME_valueHeatpumpQueuedDemandFirstPriority,
+    REGISTERS_NAME_valueHeatpumpQueuedDemandSecondPriority,
+    REGISTERS_NAME_valueHeatpumpQueuedDemandThirdPriority,
+    REGISTERS_NAME_valueHeatpumpQueuedDemandFourthPriority,
+    REGISTERS_NAME_valueHeatpumpQueuedDemandFifthPriority,
+    REGISTERS_NAME_valueHeatpumpInternalAdditionalHeaterCurrentStep,
+    REGISTERS_NAME_valueHeatingBufferTankChargeSetPoint,
+    REGISTERS_NAME_valueElectricMeterL1Current,
+    REGISTERS_NAME_valueElectricMeterL2Current,
+    REGISTERS_NAME_valueElectricMeterL3Current,
+    REGISTERS_NAME_valueElectricMeterL1ToNeutralVoltage,
+    REGISTERS_NAME_valueElectricMeterL2ToNeutralVoltage,
+    REGISTERS_NAME_valueElectricMeterL3ToNeutralVoltage,
+    REGISTERS_NAME_valueElectricMeterL1ToL2Voltage,
+    REGISTERS_NAME_valueElectricMeterL2ToL3Voltage,
+    REGISTERS_NAME_valueElectricMeterL3ToL1Voltage,
+    REGISTERS_NAME_valueElectricMeterL1Power,
+    REGISTERS_NAME_valueElectricMeterL2Power,
+    REGISTERS_NAME_valueElectricMeterL3Power,
+    REGISTERS_NAME_valueElectricMeterValue,
+    REGISTERS_NAME_valueHeatpumpComfortMode,
+    REGISTERS_NAME_valueElectricMeterKwhTotalLsb,
+    REGISTERS_NAME_valueElectricMeterKwhTotalMsb,
+    REGISTERS_NAME_valueTapwaterWcsValvePosition,
+    REGISTERS_NAME_valueTapwaterTwcValvePosition,
+    REGISTERS_NAME_valueHeatingMixValve2Position,
+    REGISTERS_NAME_valueHeatingMixValve3Position,
+    REGISTERS_NAME_valueHeatingMixValve4Position,
+    REGISTERS_NAME_valueHeatingMixValve5Position,
+    REGISTERS_NAME_valueCoolingDewPointRoom,
+    REGISTERS_NAME_valueCoolingSupplyLineMixValvePosition,
+    REGISTERS_NAME_valueCoolingSurplusHeatFanSpeed,
+    REGISTERS_NAME_valuePoolSupplyLineMixValvePosition,
+    REGISTERS_NAME_valueTapwaterTwcSupplyLineTemperature,
+    REGISTERS_NAME_valueTapwaterTwcReturnTemperature,
+    REGISTERS_NAME_valueTapwaterWcsReturnLineTemperature,
+    REGISTERS_NAME_valueTapwaterTwcEndTankTemperature,
+    REGISTERS_NAME_valueHeatingMixValve2SupplyLineTemperature,
+    REGISTERS_NAME_valueHeatingMixValve3SupplyLineTemperature,
+    REGISTERS_NAME_valueHeatingMixValve4SupplyLineTemperature,
+    REGISTERS_NAME_valueCoolingCircuitReturnLineTemperature,
+    REGISTERS_NAME_valueCoolingTankTemperature,
+    REGISTERS_NAME_valueCoolingTankReturnLineTemperature,
+    REGISTERS_NAME_valueCoolingCircuitSupplyLineTemperature,
+    REGISTERS_NAME_valueHeatingMixValve5SupplyLineTemperature,
+    REGISTERS_NAME_valueHeatingMixValve2ReturnLineTemperature,
+    REGISTERS_NAME_valueHeatingMixValve3ReturnLineTemperature,
+    REGISTERS_NAME_valueHeatingMixValve4ReturnLineTemperature,
+    REGISTERS_NAME_valueHeatingMixValve5ReturnLineTemperature,
+    REGISTERS_NAME_valueCoolingSurplusHeatReturnLineTemperature,
+    REGISTERS_NAME_valueCoolingSurplusHeatSupplyLineTemperature,
+    REGISTERS_NAME_valuePoolSupplyLineTemperature,
+    REGISTERS_NAME_valuePoolReturnLineTemperature,
+    REGISTERS_NAME_valueHeatingRoomTemperatureSensor,
+    REGISTERS_NAME_valueHeatpumpBubblePointHighPressureTemperature,
+    REGISTERS_NAME_valueHeatpumpDewPointHighPressureTemperature,
+    REGISTERS_NAME_valueHeatpumpDewPointLowPressureTemperature,
+    REGISTERS_NAME_valueHeatpumpSuperheatTemperature,
+    REGISTERS_NAME_valueHeatpumpSubCoolingTemperature,
+    REGISTERS_NAME_valueHeatpumpLowPressureSidePressure,
+    REGISTERS_NAME_valueHeatpumpHighPressureSidePressure,
+    REGISTERS_NAME_valueHeatpumpLiquidLineTemperature,
+    REGISTERS_NAME_valueHeatpumpSuctionGasTemperature,
+    REGISTERS_NAME_valueHeatingSeasonIntegralValue,
+    REGISTERS_NAME_valueHeatpumpPidPValue,
+    REGISTERS_NAME_valueHeatpumpPidIValue,
+    REGISTERS_NAME_valueHeatpumpPidDValue,
+    REGISTERS_NAME_valueHeatpumpBufferTankIValue,
+    REGISTERS_NAME_valueHeatpumpBufferTankPValue,
+    REGISTERS_NAME_valueHeatingMixValveCoolingOpeningDegree,
+    REGISTERS_NAME_valueTapwaterDesiredGear,
+    REGISTERS_NAME_valueHeatingDesiredGear,
+    REGISTERS_NAME_valueCoolingDesiredGear,
+    REGISTERS_NAME_valuePoolDesiredGear,
+    REGISTERS_NAME_valueHeatpumpNumberOfAvailableSecondariesGenesis,
+    REGISTERS_NAME_valueHeatpumpNumberOfAvailableSecondariesLegacy,
+    REGISTERS_NAME_valueHeatpumpTotalDistributedGearsAllUnits,
+    REGISTERS_NAME_valueHeatpumpMaximumGearCurrentlyRequested,
+    REGISTERS_NAME_valueHeatingMixValve1DesiredTemperature,
+    REGISTERS_NAME_valueHeatingMixValve2DesiredTemperature,
+    REGISTERS_NAME_valueHeatingMixValve3DesiredTemperature,
+    REGISTERS_NAME_valueHeatingMixValve4DesiredTemperature,
+    REGISTERS_NAME_valueHeatingMixValve5DesiredTemperature,
+    REGISTERS_NAME_valueTapwaterHgwDisconnectEndTank,
+    REGISTERS_NAME_valueHeatpumpLegacyCompressorRunning,
+    REGISTERS_NAME_valueHeatpumpLegacyReportingAlarm,
+    REGISTERS_NAME_valueHeatpumpLegacyStartSignal,
+    REGISTERS_NAME_valueHeatpumpLegacyTapWaterSignal,
+    REGISTERS_NAME_valueHeatpumpPrimaryUnitAlarmClassDCombined,
+    REGISTERS_NAME_valueHeatpumpPrimaryUnitAlarmLostCommunicationGenesis,
+    REGISTERS_NAME_valueHeatpumpPrimaryUnitAlarmClassASecondary,
+    REGISTERS_NAME_valueHeatpumpPrimaryUnitAlarmClassBSecondary,
+    REGISTERS_NAME_valueHeatpumpPrimaryUnitAlarmClassECombined,
+    REGISTERS_NAME_valueHeatpumpPrimaryUnitAlarmLegacyGeneral,
+    REGISTERS_NAME_valueHeatpumpPrimaryUnitAlarmLegacyExpansionCardCommunication,
+    REGISTERS_NAME_setHeatpumpOperationalMode,
+    REGISTERS_NAME_setHeatingMaxLimitationSetPointCurveRadiator,
+    REGISTERS_NAME_setHeatingMinLimitationSetPointCurveRadiator,
+    REGISTERS_NAME_setHeatingComfortWheelSetting,
+    REGISTERS_NAME_setHeatingHeatCurveYCoordinate1,
+    REGISTERS_NAME_setHeatingHeatCurveYCoordinate2,
+    REGISTERS_NAME_setHeatingHeatCurveYCoordinate3,
+    REGISTERS_NAME_setHeatingHeatCurveYCoordinate4,
+    REGISTERS_NAME_setHeatingHeatCurveYCoordinate5,
+    REGISTERS_NAME_setHeatingHeatCurveYCoordinate6,
+    REGISTERS_NAME_setHeatingHeatCurveYCoordinate7,
+    REGISTERS_NAME_setHeatingSeasonStopTemperature,
+    REGISTERS_NAME_setTapwaterStartTemperature,
+    REGISTERS_NAME_setTapwaterStopTemperature,
+    REGISTERS_NAME_setHeatpumpMinAllowedGearHeating,
+    REGISTERS_NAME_setHeatpumpMaxAllowedGearHeating,
+    REGISTERS_NAME_setHeatpumpMaxAllowedGearTapWater,
+    REGISTERS_NAME_setHeatpumpMinAllowedGearTapWater,
+    REGISTERS_NAME_setCoolingMixValveSetPoint,
+    REGISTERS_NAME_setTapwaterTwcMixValveSetPoint,
+    REGISTERS_NAME_setTapwaterWcsReturnLineSetPoint,
+    REGISTERS_NAME_setTapwaterTwcMixValveLowestAllowedOpeningDegree,
+    REGISTERS_NAME_setTapwaterTwcMixValveHighestAllowedOpeningDegree,
+    REGISTERS_NAME_setTapwaterTwcStartTemperatureImmersionHeater,
+    REGISTERS_NAME_setTapwaterTwcStartDelayImmersionHeater,
+    REGISTERS_NAME_setTapwaterTwcStopTemperatureImmersionHeater,
+    REGISTERS_NAME_setTapwaterWcsMixValveLowestAllowedOpeningDegree,
+    REGISTERS_NAME_setTapwaterWcsMixValveHighestAllowedOpeningDegree,
+    REGISTERS_NAME_setHeatingMixValve2LowestAllowedOpeningDegree,
+    REGISTERS_NAME_setHeatingMixValve2HighestAllowedOpeningDegree,
+    REGISTERS_NAME_setHeatingMixValve3LowestAllowedOpeningDegree,
+    REGISTERS_NAME_setHeatingMixValve3HighestAllowedOpeningDegree,
+    REGISTERS_NAME_setHeatingMixValve4LowestAllowedOpeningDegree,
+    REGISTERS_NAME_setHeatingMixValve4HighestAllowedOpeningDegree,
+    REGISTERS_NAME_setHeatingMixValve5LowestAllowedOpeningDegree,
+    REGISTERS_NAME_setHeatingMixValve5HighestAllowedOpeningDegree,
+    REGISTERS_NAME_setCoolingSurplusHeatChillerSetPoint,
+    REGISTERS_NAME_setCoolingSupplyLineMixValveLowestAllowedOpeningDegree,
+    REGISTERS_NAME_setCoolingSupplyLineMixValveHighestAllowedOpeningDegree,
+    REGISTERS_NAME_setCoolingSurplusHeatOpeningDegreeStartFan1,
+    REGISTERS_NAME_setCoolingSurplusHeatOpeningDegreeStartFan2,
+    REGISTERS_NAME_setCoolingSurplusHeatOpeningDegreeStopFan1,
+    REGISTERS_NAME_setCoolingSurplusHeatOpeningDegreeStopFan2,
+    REGISTERS_NAME_setCoolingSurplusHeatLowestAllowedOpeningDegree,
+    REGISTERS_NAME_setCoolingSurplusHeatHighestAllowedOpeningDegree,
+    REGISTERS_NAME_setPoolChargeSetPoint,
+    REGISTERS_NAME_setPoolMixValveLowestAllowedOpeningDegree,
+    REGISTERS_NAME_setPoolMixValveHighestAllowedOpeningDegree,
+    REGISTERS_NAME_setHeatpumpGearShiftDelayHeating,
+    REGISTERS_NAME_setHeatpumpGearShiftDelayPool,
+    REGISTERS_NAME_setHeatpumpGearShiftDelayCooling,
+    REGISTERS_NAME_setHeatpumpBrineInHighAlarmLimit,
+    REGISTERS_NAME_setHeatpumpBrineInLowAlarmLimit,
+    REGISTERS_NAME_setHeatpumpBrineOutLowAlarmLimit,
+    REGISTERS_NAME_setHeatpumpBrineMaxDeltaLimit,
+    REGISTERS_NAME_setTapwaterHgwPumpStartTemperatureDischargePipe,
+    REGISTERS_NAME_setTapwaterHgwPumpLowerStopLimitTemperatureDischargePipe,
+    REGISTERS_NAME_setTapwaterHgwPumpUpperStopLimitTemperatureDischargePipe,
+    REGISTERS_NAME_setHeatpumpExternalAdditionalHeaterStartPidSum,
+    REGISTERS_NAME_setHeatpumpCondenserPumpLowestAllowedSpeed,
+    REGISTERS_NAME_setHeatpumpBrinePumpLowestAllowedSpeed,
+    REGISTERS_NAME_setHeatpumpExternalAdditionalHeaterStopPidSum,
+    REGISTERS_NAME_setHeatpumpCondenserPumpHighestAllowedSpeed,
+    REGISTERS_NAME_setHeatpumpBrinePumpHighestAllowedSpeed,
+    REGISTERS_NAME_setHeatpumpCondenserPumpStandbySpeed,
+    REGISTERS_NAME_setHeatpumpBrinePumpStandbySpeed,
+    REGISTERS_NAME_setHeatpumpMinAllowedGearPool,
+    REGISTERS_NAME_setHeatpumpMaxAllowedGearPool,
+    REGISTERS_NAME_setHeatpumpMinAllowedGearCooling,
+    REGISTERS_NAME_setHeatpumpMaxAllowedGearCooling,
+    REGISTERS_NAME_setCoolingStartTemp,
+    REGISTERS_NAME_setCoolingStopTemp,
+    REGISTERS_NAME_setHeatingMixValve1MinLimitationSetPointCurve,
+    REGISTERS_NAME_setHeatingMixValve1MaxLimitationSetPointCurve,
+    REGISTERS_NAME_setHeatingMixValve1HeatCurveYCoordinate1,
+    REGISTERS_NAME_setHeatingMixValve1HeatCurveYCoordinate2,
+    REGISTERS_NAME_setHeatingMixValve1HeatCurveYCoordinate3,
+    REGISTERS_NAME_setHeatingMixValve1HeatCurveYCoordinate4,
+    REGISTERS_NAME_setHeatingMixValve1HeatCurveYCoordinate5,
+    REGISTERS_NAME_setHeatingMixValve1HeatCurveYCoordinate6,
+    REGISTERS_NAME_setHeatingMixValve1HeatCurveYCoordinate7,
+    REGISTERS_NAME_setHeatingFixedSystemSupplySetPoint,
+    REGISTERS_NAME_setHeatingMixValve2MinLimitationSetPointCurve,
+    REGISTERS_NAME_setHeatingMixValve2MaxLimitationSetPointCurve,
+    REGISTERS_NAME_setHeatingMixValve2HeatCurveYCoordinate1,
+    REGISTERS_NAME_setHeatingMixValve2HeatCurveYCoordinate2,
+    REGISTERS_NAME_setHeatingMixValve2HeatCurveYCoordinate3,
+    REGISTERS_NAME_setHeatingMixValve2HeatCurveYCoordinate4,
+    REGISTERS_NAME_setHeatingMixValve2HeatCurveYCoordinate5,
+    REGISTERS_NAME_setHeatingMixValve2HeatCurveYCoordinate6,
+    REGISTERS_NAME_setHeatingMixValve2HeatCurveYCoordinate7,
+    REGISTERS_NAME_setHeatingMixValve3MinLimitationSetPointCurve,
+    REGISTERS_NAME_setHeatingMixValve3MaxLimitationSetPointCurve,
+    REGISTERS_NAME_setHeatingMixValve3HeatCurveYCoordinate1,
+    REGISTERS_NAME_setHeatingMixValve3HeatCurveYCoordinate2,
+    REGISTERS_NAME_setHeatingMixValve3HeatCurveYCoordinate3,
+    REGISTERS_NAME_setHeatingMixValve3HeatCurveYCoordinate4,
+    REGISTERS_NAME_setHeatingMixValve3HeatCurveYCoordinate5,
+    REGISTERS_NAME_setHeatingMixValve3HeatCurveYCoordinate6,
+    REGISTERS_NAME_setHeatingMixValve3HeatCurveYCoordinate7,
+    REGISTERS_NAME_setHeatingMixValve4MinLimitationSetPointCurve,
+    REGISTERS_NAME_setHeatingMixValve4MaxLimitationSetPointCurve,
+    REGISTERS_NAME_setHeatingMixValve4HeatCurveYCoordinate1,
+    REGISTERS_NAME_setHeatingMixValve4HeatCurveYCoordinate2,
+    REGISTERS_NAME_setHeatingMixValve4HeatCurveYCoordinate3,
+    REGISTERS_NAME_setHeatingMixValve4HeatCurveYCoordinate4,
+    REGISTERS_NAME_setHeatingMixValve4HeatCurveYCoordinate5,
+    REGISTERS_NAME_setHeatingMixValve4HeatCurveYCoordinate6,
+    REGISTERS_NAME_setHeatingMixValve4HeatCurveYCoordinate7,
+    REGISTERS_NAME_setHeatingMixValve5MinLimitationSetPointCurve,
+    REGISTERS_NAME_setHeatingMixValve5MaxLimitationSetPointCurve,
+    REGISTERS_NAME_setHeatingMixValve5HeatCurveYCoordinate1,
+    REGISTERS_NAME_setHeatingMixValve5HeatCurveYCoordinate2,
+    REGISTERS_NAME_setHeatingMixValve5HeatCurveYCoordinate3,
+    REGISTERS_NAME_setHeatingMixValve5HeatCurveYCoordinate4,
+    REGISTERS_NAME_setHeatingMixValve5HeatCurveYCoordinate5,
+    REGISTERS_NAME_setHeatingMixValve5HeatCurveYCoordinate6,
+    REGISTERS_NAME_setHeatingMixValve5HeatCurveYCoordinate7,
+    REGISTERS_NAME_setPoolReturnTempFromPoolToHeatExchanger,
+    REGISTERS_NAME_setPoolHysteresis,
+    REGISTERS_NAME_setHeatingMixValve1SupplyLineTempPassiveCooling,
+    REGISTERS_NAME_setHeatingMinOutdoorTempCoolingPermitted,
+    REGISTERS_NAME_setHeatpumpExternalHeaterOutdoorTempLimit,
+    REGISTERS_NAME_setHeatingMixValve2SelectedMode,
+    REGISTERS_NAME_setHeatingMixValve2DesiredCoolingTempSetPoint,
+    REGISTERS_NAME_setHeatingMixValve2SeasonalCoolingTemp,
+    REGISTERS_NAME_setHeatingMixValve2SeasonalHeatingTemp,
+    REGISTERS_NAME_setHeatingMixValve3SelectedMode,
+    REGISTERS_NAME_setHeatingMixValve3DesiredCoolingTempSetPoint,
+    REGISTERS_NAME_setHeatingMixValve3SeasonalCoolingTemp,
+    REGISTERS_NAME_setHeatingMixValve3SeasonalHeatingTemp,
+    REGISTERS_NAME_setHeatingMixValve4SelectedMode,
+    REGISTERS_NAME_setHeatingMixValve4DesiredCoolingTempSetPoint,
+    REGISTERS_NAME_setHeatingMixValve4SeasonalCoolingTemp,
+    REGISTERS_NAME_setHeatingMixValve4SeasonalHeatingTemp,
+    REGISTERS_NAME_setHeatingMixValve5SelectedMode,
+    REGISTERS_NAME_setHeatingMixValve5DesiredCoolingTempSetPoint,
+    REGISTERS_NAME_setHeatingMixValve5SeasonalCoolingTemp,
+    REGISTERS_NAME_setHeatingMixValve5SeasonalHeatingTemp,
+};
+enum {
+    REGISTERS_ADDRESS_REG_COIL_STATUS_3,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_4,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_5,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_6,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_7,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_8,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_9,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_10,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_11,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_12,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_13,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_14,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_16,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_17,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_18,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_19,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_20,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_21,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_22,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_23,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_24,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_25,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_26,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_28,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_29,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_30,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_31,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_32,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_33,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_34,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_35,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_36,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_37,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_38,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_39,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_40,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_41,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_42,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_43,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_44,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_45,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_46,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_47,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_48,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_49,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_50,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_51,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_52,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_53,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_54,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_55,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_56,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_57,
+    REGISTERS_ADDRESS_REG_COIL_STATUS_58,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_0,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_1,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_2,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_3,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_4,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_9,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_10,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_11,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_12,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_13,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_14,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_15,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_16,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_22,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_23,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_24,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_25,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_26,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_27,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_28,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_29,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_30,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_31,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_32,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_33,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_34,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_35,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_36,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_37,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_38,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_39,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_40,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_44,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_45,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_46,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_47,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_48,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_49,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_50,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_51,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_52,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_53,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_55,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_56,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_57,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_58,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_59,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_60,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_61,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_62,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_63,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_64,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_65,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_66,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_67,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_68,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_69,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_70,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_71,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_72,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_73,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_74,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_75,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_76,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_77,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_78,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_79,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_81,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_82,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_83,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_84,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_85,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_86,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_199,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_201,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_202,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_204,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_206,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_209,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_210,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_211,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_213,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_218,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_219,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_220,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_221,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_222,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_223,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_224,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_225,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_230,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_232,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_233,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_234,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_235,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_236,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_237,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_238,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_239,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_240,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_241,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_242,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_243,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_244,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_245,
+    REGISTERS_ADDRESS_REG_INPUT_STATUS_246,
+    REGISTERS_ADDRESS_REG_INPUT_1,
+    REGISTERS_ADDRESS_REG_INPUT_4,
+    REGISTERS_ADDRESS_REG_INPUT_5,
+    REGISTERS_ADDRESS_REG_INPUT_6,
+    REGISTERS_ADDRESS_REG_INPUT_7,
+    REGISTERS_ADDRESS_REG_INPUT_8,
+    REGISTERS_ADDRESS_REG_INPUT_9,
+    REGISTERS_ADDRESS_REG_INPUT_10,
+    REGISTERS_ADDRESS_REG_INPUT_11,
+    REGISTERS_ADDRESS_REG_INPUT_12,
+    REGISTERS_ADDRESS_REG_INPUT_13,
+    REGISTERS_ADDRESS_REG_INPUT_15,
+    REGISTERS_ADDRESS_REG_INPUT_16,
+    REGISTERS_ADDRESS_REG_INPUT_17,
+    REGISTERS_ADDRESS_REG_INPUT_18,
+    REGISTERS_ADDRESS_REG_INPUT_19,
+    REGISTERS_ADDRESS_REG_INPUT_20,
+    REGISTERS_ADDRESS_REG_INPUT_21,
+    REGISTERS_ADDRESS_REG_INPUT_22,
+    REGISTERS_ADDRESS_REG_INPUT_23,
+    REGISTERS_ADDRESS_REG_INPUT_24,
+    REGISTERS_ADDRESS_REG_INPUT_25,
+    REGISTERS_ADDRESS_REG_INPUT_26,
+    REGISTERS_ADDRESS_REG_INPUT_36,
+    REGISTERS_ADDRESS_REG_INPUT_39,
+    REGISTERS_ADDRESS_REG_INPUT_40,
+    REGISTERS_ADDRESS_REG_INPUT_41,
+    REGISTERS_ADDRESS_REG_INPUT_43,
+    REGISTERS_ADDRESS_REG_INPUT_44,
+    REGISTERS_ADDRESS_REG_INPUT_45,
+    REGISTERS_ADDRESS_REG_INPUT_47,
+    REGISTERS_ADDRESS_REG_INPUT_48,
+    REGISTERS_ADDRESS_REG_INPUT_49,
+    REGISTERS_ADDRESS_REG_INPUT_50,
+    REGISTERS_ADDRESS_REG_INPUT_51,
+    REGISTERS_ADDRESS_REG_INPUT_52,
+    REGISTERS_ADDRESS_REG_INPUT_53,
+    REGISTERS_ADDRESS_REG_INPUT_54,
+    REGISTERS_ADDRESS_REG_INPUT_55,
+    REGISTERS_ADDRESS_REG_INPUT_56,
+    REGISTERS_ADDRESS_REG_INPUT_57,
+    REGISTERS_ADDRESS_REG_INPUT_58,
+    REGISTERS_ADDRESS_REG_INPUT_59,
+    REGISTERS_ADDRESS_REG_INPUT_60,
+    REGISTERS_ADDRESS_REG_INPUT_61,
+    REGISTERS_ADDRESS_REG_INPUT_62,
+    REGISTERS_ADDRESS_REG_INPUT_63,
+    REGISTERS_ADDRESS_REG_INPUT_64,
+    REGISTERS_ADDRESS_REG_INPUT_65,
+    REGISTERS_ADDRESS_REG_INPUT_66,
+    REGISTERS_ADDRESS_REG_INPUT_67,
+    REGISTERS_ADDRESS_REG_INPUT_68,
+    REGISTERS_ADDRESS_REG_INPUT_69,
+    REGISTERS_ADDRESS_REG_INPUT_70,
+    REGISTERS_ADDRESS_REG_INPUT_71,
+    REGISTERS_ADDRESS_REG_INPUT_72,
+    REGISTERS_ADDRESS_REG_INPUT_73,
+    REGISTERS_ADDRESS_REG_INPUT_74,
+    REGISTERS_ADDRESS_REG_INPUT_75,
+    REGISTERS_ADDRESS_REG_INPUT_76,
+    REGISTERS_ADDRESS_REG_INPUT_77,
+    REGISTERS_ADDRESS_REG_INPUT_78,
+    REGISTERS_ADDRESS_REG_INPUT_79,
+    REGISTERS_ADDRESS_REG_INPUT_80,
+    REGISTERS_ADDRESS_REG_INPUT_81,
+    REGISTERS_ADDRESS_REG_INPUT_82,
+    REGISTERS_ADDRESS_REG_INPUT_83,
+    REGISTERS_ADDRESS_REG_INPUT_84,
+    REGISTERS_ADDRESS_REG_INPUT_85,
+    REGISTERS_ADDRESS_REG_INPUT_86,
+    REGISTERS_ADDRESS_REG_INPUT_87,
+    REGISTERS_ADDRESS_REG_INPUT_88,
+    REGISTERS_ADDRESS_REG_INPUT_89,
+    REGISTERS_ADDRESS_REG_INPUT_90,
+    REGISTERS_ADDRESS_REG_INPUT_91,
+    REGISTERS_ADDRESS_REG_INPUT_92,
+    REGISTERS_ADDRESS_REG_INPUT_93,
+    REGISTERS_ADDRESS_REG_INPUT_94,
+    REGISTERS_ADDRESS_REG_INPUT_95,
+    REGISTERS_ADDRESS_REG_INPUT_96,
+    REGISTERS_ADDRESS_REG_INPUT_97,
+    REGISTERS_ADDRESS_REG_INPUT_98,
+    REGISTERS_ADDRESS_REG_INPUT_99,
+    REGISTERS_ADDRESS_REG_INPUT_100,
+    REGISTERS_ADDRESS_REG_INPUT_101,
+    REGISTERS_ADDRESS_REG_INPUT_103,
+    REGISTERS_ADDRESS_REG_INPUT_104,
+    REGISTERS_ADDRESS_REG_INPUT_105,
+    REGISTERS_ADDRESS_REG_INPUT_106,
+    REGISTERS_ADDRESS_REG_INPUT_107,
+    REGISTERS_ADDRESS_REG_INPUT_109,
+    REGISTERS_ADDRESS_REG_INPUT_111,
+    REGISTERS_ADDRESS_REG_INPUT_113,
+    REGISTERS_ADDRESS_REG_INPUT_115,
+    REGISTERS_ADDRESS_REG_INPUT_117,
+    REGISTERS_ADDRESS_REG_INPUT_118,
+    REGISTERS_ADDRESS_REG_INPUT_119,
+    REGISTERS_ADDRESS_REG_INPUT_120,
+    REGISTERS_ADDRESS_REG_INPUT_121,
+    REGISTERS_ADDRESS_REG_INPUT_122,
+    REGISTERS_ADDRESS_REG_INPUT_123,
+    REGISTERS_ADDRESS_REG_INPUT_124,
+    REGISTERS_ADDRESS_REG_INPUT_125,
+    REGISTERS_ADDRESS_REG_INPUT_126,
+    REGISTERS_ADDRESS_REG_INPUT_127,
+    REGISTERS_ADDRESS_REG_INPUT_128,
+    REGISTERS_ADDRESS_REG_INPUT_129,
+    REGISTERS_ADDRESS_REG_INPUT_130,
+    REGISTERS_ADDRESS_REG_INPUT_131,
+    REGISTERS_ADDRESS_REG_INPUT_132,
+    REGISTERS_ADDRESS_REG_INPUT_133,
+    REGISTERS_ADDRESS_REG_INPUT_134,
+    REGISTERS_ADDRESS_REG_INPUT_135,
+    REGISTERS_ADDRESS_REG_INPUT_136,
+    REGISTERS_ADDRESS_REG_INPUT_137,
+    REGISTERS_ADDRESS_REG_INPUT_139,
+    REGISTERS_ADDRESS_REG_INPUT_140,
+    REGISTERS_ADDRESS_REG_INPUT_141,
+    REGISTERS_ADDRESS_REG_INPUT_142,
+    REGISTERS_ADDRESS_REG_INPUT_143,
+    REGISTERS_ADDRESS_REG_INPUT_144,
+    REGISTERS_ADDRESS_REG_INPUT_145,
+    REGISTERS_ADDRESS_REG_INPUT_146,
+    REGISTERS_ADDRESS_REG_INPUT_147,
+    REGISTERS_ADDRESS_REG_INPUT_148,
+    REGISTERS_ADDRESS_REG_INPUT_149,
+    REGISTERS_ADDRESS_REG_INPUT_150,
+    REGISTERS_ADDRESS_REG_INPUT_151,
+    REGISTERS_ADDRESS_REG_INPUT_152,
+    REGISTERS_ADDRESS_REG_INPUT_153,
+    REGISTERS_ADDRESS_REG_INPUT_154,
+    REGISTERS_ADDRESS_REG_INPUT_155,
+    REGISTERS_ADDRESS_REG_INPUT_156,
+    REGISTERS_ADDRESS_REG_INPUT_160,
+    REGISTERS_ADDRESS_REG_INPUT_161,
+    REGISTERS_ADDRESS_REG_INPUT_162,
+    REGISTERS_ADDRESS_REG_INPUT_163,
+    REGISTERS_ADDRESS_REG_INPUT_170,
+    REGISTERS_ADDRESS_REG_INPUT_171,
+    REGISTERS_ADDRESS_REG_INPUT_173,
+    REGISTERS_ADDRESS_REG_HOLDING_0,
+    REGISTERS_ADDRESS_REG_HOLDING_3,
+    REGISTERS_ADDRESS_REG_HOLDING_4,
+    REGISTERS_ADDRESS_REG_HOLDING_5,
+    REGISTERS_ADDRESS_REG_HOLDING_6,
+    REGISTERS_ADDRESS_REG_HOLDING_7,
+    REGISTERS_ADDRESS_REG_HOLDING_8,
+    REGISTERS_ADDRESS_REG_HOLDING_9,
+    REGISTERS_ADDRESS_REG_HOLDING_10,
+    REGISTERS_ADDRESS_REG_HOLDING_11,
+    REGISTERS_ADDRESS_REG_HOLDING_12,
+    REGISTERS_ADDRESS_REG_HOLDING_16,
+    REGISTERS_ADDRESS_REG_HOLDING_22,
+    REGISTERS_ADDRESS_REG_HOLDING_23,
+    REGISTERS_ADDRESS_REG_HOLDING_26,
+    REGISTERS_ADDRESS_REG_HOLDING_27,
+    REGISTERS_ADDRESS_REG_HOLDING_28,
+    REGISTERS_ADDRESS_REG_HOLDING_29,
+    REGISTERS_ADDRESS_REG_HOLDING_30,
+    REGISTERS_ADDRESS_REG_HOLDING_31,
+    REGISTERS_ADDRESS_REG_HOLDING_32,
+    REGISTERS_ADDRESS_REG_HOLDING_33,
+    REGISTERS_ADDRESS_REG_HOLDING_34,
+    REGISTERS_ADDRESS_REG_HOLDING_35,
+    REGISTERS_ADDRESS_REG_HOLDING_36,
+    REGISTERS_ADDRESS_REG_HOLDING_37,
+    REGISTERS_ADDRESS_REG_HOLDING_38,
+    REGISTERS_ADDRESS_REG_HOLDING_39,
+    REGISTERS_ADDRESS_REG_HOLDING_40,
+    REGISTERS_ADDRESS_REG_HOLDING_41,
+    REGISTERS_ADDRESS_REG_HOLDING_42,
+    REGISTERS_ADDRESS_REG_HOLDING_43,
+    REGISTERS_ADDRESS_REG_HOLDING_44,
+    REGISTERS_ADDRESS_REG_HOLDING_45,
+    REGISTERS_ADDRESS_REG_HOLDING_46,
+    REGISTERS_ADDRESS_REG_HOLDING_47,
+    REGISTERS_ADDRESS_REG_HOLDING_48,
+    REGISTERS_ADDRESS_REG_HOLDING_49,
+    REGISTERS_ADDRESS_REG_HOLDING_50,
+    REGISTERS_ADDRESS_REG_HOLDING_51,
+    REGISTERS_ADDRESS_REG_HOLDING_52,
+    REGISTERS_ADDRESS_REG_HOLDING_53,
+    REGISTERS_ADDRESS_REG_HOLDING_54,
+    REGISTERS_ADDRESS_REG_HOLDING_55,
+    REGISTERS_ADDRESS_REG_HOLDING_56,
+    REGISTERS_ADDRESS_REG_HOLDING_58,
+    REGISTERS_ADDRESS_REG_HOLDING_59,
+    REGISTERS_ADDRESS_REG_HOLDING_60,
+    REGISTERS_ADDRESS_REG_HOLDING_61,
+    REGISTERS_ADDRESS_REG_HOLDING_62,
+    REGISTERS_ADDRESS_REG_HOLDING_63,
+    REGISTERS_ADDRESS_REG_HOLDING_67,
+    REGISTERS_ADDRESS_REG_HOLDING_68,
+    REGISTERS_ADDRESS_REG_HOLDING_69,
+    REGISTERS_ADDRESS_REG_HOLDING_70,
+    REGISTERS_ADDRESS_REG_HOLDING_71,
+    REGISTERS_ADDRESS_REG_HOLDING_72,
+    REGISTERS_ADDRESS_REG_HOLDING_73,
+    REGISTERS_ADDRESS_REG_HOLDING_75,
+    REGISTERS_ADDRESS_REG_HOLDING_76,
+    REGISTERS_ADDRESS_REG_HOLDING_77,
+    REGISTERS_ADDRESS_REG_HOLDING_78,
+    REGISTERS_ADDRESS_REG_HOLDING_79,
+    REGISTERS_ADDRESS_REG_HOLDING_80,
+    REGISTERS_ADDRESS_REG_HOLDING_81,
+    REGISTERS_ADDRESS_REG_HOLDING_82,
+    REGISTERS_ADDRESS_REG_HOLDING_85,
+    REGISTERS_ADDRESS_REG_HOLDING_86,
+    REGISTERS_ADDRESS_REG_HOLDING_87,
+    REGISTERS_ADDRESS_REG_HOLDING_88,
+    REGISTERS_ADDRESS_REG_HOLDING_105,
+    REGISTERS_ADDRESS_REG_HOLDING_106,
+    REGISTERS_ADDRESS_REG_HOLDING_107,
+    REGISTERS_ADDRESS_REG_HOLDING_108,
+    REGISTERS_ADDRESS_REG_HOLDING_109,
+    REGISTERS_ADDRESS_REG_HOLDING_110,
+    REGISTERS_ADDRESS_REG_HOLDING_111,
+    REGISTERS_ADDRESS_REG_HOLDING_112,
+    REGISTERS_ADDRESS_REG_HOLDING_113,
+    REGISTERS_ADDRESS_REG_HOLDING_114,
+    REGISTERS_ADDRESS_REG_HOLDING_115,
+    REGISTERS_ADDRESS_REG_HOLDING_116,
+    REGISTERS_ADDRESS_REG_HOLDING_199,
+    REGISTERS_ADDRESS_REG_HOLDING_200,
+    REGISTERS_ADDRESS_REG_HOLDING_201,
+    REGISTERS_ADDRESS_REG_HOLDING_202,
+    REGISTERS_ADDRESS_REG_HOLDING_203,
+    REGISTERS_ADDRESS_REG_HOLDING_204,
+    REGISTERS_ADDRESS_REG_HOLDING_205,
+    REGISTERS_ADDRESS_REG_HOLDING_206,
+    REGISTERS_ADDRESS_REG_HOLDING_207,
+    REGISTERS_ADDRESS_REG_HOLDING_208,
+    REGISTERS_ADDRESS_REG_HOLDING_209,
+    REGISTERS_ADDRESS_REG_HOLDING_210,
+    REGISTERS_ADDRESS_REG_HOLDING_211,
+    REGISTERS_ADDRESS_REG_HOLDING_212,
+    REGISTERS_ADDRESS_REG_HOLDING_213,
+    REGISTERS_ADDRESS_REG_HOLDING_214,
+    REGISTERS_ADDRESS_REG_HOLDING_215,
+    REGISTERS_ADDRESS_REG_HOLDING_216,
+    REGISTERS_ADDRESS_REG_HOLDING_239,
+    REGISTERS_ADDRESS_REG_HOLDING_240,
+    REGISTERS_ADDRESS_REG_HOLDING_241,
+    REGISTERS_ADDRESS_REG_HOLDING_242,
+    REGISTERS_ADDRESS_REG_HOLDING_243,
+    REGISTERS_ADDRESS_REG_HOLDING_244,
+    REGISTERS_ADDRESS_REG_HOLDING_245,
+    REGISTERS_ADDRESS_REG_HOLDING_246,
+    REGISTERS_ADDRESS_REG_HOLDING_247,
+    REGISTERS_ADDRESS_REG_HOLDING_248,
+    REGISTERS_ADDRESS_REG_HOLDING_249,
+    REGISTERS_ADDRESS_REG_HOLDING_250,
+    REGISTERS_ADDRESS_REG_HOLDING_251,
+    REGISTERS_ADDRESS_REG_HOLDING_252,
+    REGISTERS_ADDRESS_REG_HOLDING_253,
+    REGISTERS_ADDRESS_REG_HOLDING_254,
+    REGISTERS_ADDRESS_REG_HOLDING_255,
+    REGISTERS_ADDRESS_REG_HOLDING_256,
+    REGISTERS_ADDRESS_REG_HOLDING_299,
+    REGISTERS_ADDRESS_REG_HOLDING_300,
+    REGISTERS_ADDRESS_REG_HOLDING_302,
+    REGISTERS_ADDRESS_REG_HOLDING_303,
+    REGISTERS_ADDRESS_REG_HOLDING_304,
+    REGISTERS_ADDRESS_REG_HOLDING_305,
+    REGISTERS_ADDRESS_REG_HOLDING_306,
+    REGISTERS_ADDRESS_REG_HOLDING_307,
+    REGISTERS_ADDRESS_REG_HOLDING_308,
+    REGISTERS_ADDRESS_REG_HOLDING_309,
+    REGISTERS_ADDRESS_REG_HOLDING_310,
+    REGISTERS_ADDRESS_REG_HOLDING_311,
+    REGISTERS_ADDRESS_REG_HOLDING_312,
+    REGISTERS_ADDRESS_REG_HOLDING_313,
+    REGISTERS_ADDRESS_REG_HOLDING_314,
+    REGISTERS_ADDRESS_REG_HOLDING_315,
+    REGISTERS_ADDRESS_REG_HOLDING_316,
+    REGISTERS_ADDRESS_REG_HOLDING_317,
+    REGISTERS_ADDRESS_REG_HOLDING_318,
+    REGISTERS_ADDRESS_REG_HOLDING_319,
+    REGISTERS_ADDRESS_REG_HOLDING_320,
+};
+_Static_assert(1 > 0, "scale of 'enableHeatpumpResetAllAlarms' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpInternalAdditionalHeater' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpExternalAdditionalHeater' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableTapwaterHgw' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpFlowPressureSwitch' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpTapWater' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpHeat' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableCoolingActiveCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve1' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableTapwaterTwc' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableTapwaterWcs' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableTapwaterHotGasPump' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve2' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve3' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve4' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve5' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpBrineOutMonitoring' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpBrinePumpContinuousOperation' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpSystemCirculationPump' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableCoolingDewPointCalculation' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableTapwaterAntiLegionella' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpAdditionalHeaterOnly' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableElectricCurrentLimitation' must be > 0");
+_Static_assert(1 > 0, "scale of 'enablePoolPool' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableCoolingSurplusHeatChiller' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableCoolingSurplusHeatBorehole' must be > 0");
+_Static_assert(1 > 0, "scale of 'enablePoolExternalAdditionalHeater' must be > 0");
+_Static_assert(1 > 0, "scale of 'enablePoolInternalAdditionalHeater' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableCoolingPassiveCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpVariableSpeedCondenserPump' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpVariableSpeedBrinePump' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve1CoolingMode' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve1OutdoorTempCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve1BrinePumpOnCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpOutdoorTempExternalHeater' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpBrineInMonitoring' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingFixedSystemSupplySetPoint' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatpumpEvaporatorFreezeProtection' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve2OutdoorTempCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve2DewPointCalculation' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve2OutdoorTempHeating' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve3OutdoorTempCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve3DewPointCalculation' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve3OutdoorTempHeating' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve4OutdoorTempCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve4DewPointCalculation' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve4OutdoorTempHeating' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve5OutdoorTempCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve5DewPointCalculation' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve5OutdoorTempHeating' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve2BrinePumpOnCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve3BrinePumpOnCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve4BrinePumpOnCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'enableHeatingMixValve5BrinePumpOnCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpClassA' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpClassB' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpClassC' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpClassDGenesisSecondary' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpClassELegacySecondary' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpHighPressureSwitch' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpLowPressureLevel' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpHighDischargePipeTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpOperatingPressureLimit' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpDischargePipeSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpLiquidLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpSuctionGasSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpFlowPressureSwitch' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpPowerInputPhaseDetection' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpInverterUnit' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingSystemSupplyLowTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpCompressorLowSpeed' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpLowSuperHeat' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpPressureRatioOutOfRange' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpCompressorPressureOutsideEnvelope' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpBrineTemperatureOutOfRange' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpBrineInSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpBrineOutSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpCondenserInSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpCondenserOutSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpOutdoorSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingSystemSupplyLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingMixValve1SupplyLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingMixValve2SupplyLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingMixValve3SupplyLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingMixValve4SupplyLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingMixValve5SupplyLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmTapwaterWcsReturnLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmTapwaterTwcSupplyLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmCoolingTankSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmCoolingSupplyLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmCoolingCircuitReturnLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpBrineDeltaOutOfRange' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmTapwaterMidSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmTapwaterTwcCirculationReturnSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmTapwaterHgwSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpInternalAdditionalHeater' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpBrineInHighTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpBrineInLowTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpBrineOutLowTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmTapwaterTwcCirculationReturnLowTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmTapwaterTwcSupplyLowTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingMixValve1SupplyTemperatureDeviation' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingMixValve2SupplyTemperatureDeviation' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingMixValve3SupplyTemperatureDeviation' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingMixValve4SupplyTemperatureDeviation' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingMixValve5SupplyTemperatureDeviation' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmTapwaterWcsReturnLineTemperatureDeviation' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpSum' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmCoolingCircuitSupplyLineTemperatureDeviation' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmCoolingTankTemperatureDeviation' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmCoolingSurplusHeatTemperatureDeviation' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmCoolingHumidityRoomSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmCoolingSurplusHeatSupplyLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmCoolingSurplusHeatReturnLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmCoolingTankReturnLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatingTemperatureRoomSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpInverterUnitCommunication' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmPoolReturnLineSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusPoolExternalStop' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusCoolingExternalStartBrinePump' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpExternalRelayBrineGroundWaterPump' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmTapwaterEndTankSensor' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmTapwaterMaxTimeAntiLegionellaExceeded' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpGenesisSecondaryUnitCommunication' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpPrimaryUnitNetworkConflict' must be > 0");
+_Static_assert(1 > 0, "scale of 'alarmHeatpumpPrimaryUnitSecondariesNotDetected' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpOilBoostInProgress' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpCompressorControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpSmartGrid1Evu' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpExternalAlarmInput' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpSmartGrid2' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpExternalAdditionalHeaterControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatingMixValve1CirculationPumpControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpCondenserPumpOnOff' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatingSystemCirculationPumpControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusTapwaterHotGasCirculationPumpControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpBrinePumpOnOff' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpExternalHeaterCirculationPumpControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatingSeasonWinterActive' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpExternalAdditionalHeaterActive' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpInternalAdditionalHeaterActive' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusTapwaterHgwRegulationControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpStopping' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpOkToStart' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusTapwaterTwcSupplyLineCirculationPumpControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusTapwaterWcsRegulationControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusTapwaterWcsCirculationPumpControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusTapwaterTwcEndTankHeaterControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusPoolDirectionalValvePosition' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusCoolingCircuitCirculationPumpControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusPoolCirculationPumpControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusCoolingSurplusHeatDirectionalValvePosition' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusCoolingSurplusHeatCirculationPumpControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusCoolingCircuitRegulationControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusCoolingSurplusHeatRegulationControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusCoolingActiveCoolingDirectionalValvePosition' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusCoolingPassiveActiveCoolingDirectionalValvePosition' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusPoolRegulationControl' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatingMixValve1ProducingPassiveCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'statusHeatpumpCompressorUnableToSpeedUp' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpCurrentlyRunningFirstPrioritisedDemand' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpCompressorAvailableGears' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpCompressorSpeedRpm' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpExternalAdditionalHeaterCurrentDemand' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpDischargePipeTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpCondenserInTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpCondenserOutTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpBrineInTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpBrineOutTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingSystemSupplyLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpOutdoorTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueTapwaterTopTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueTapwaterLowerTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueTapwaterWeightedTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingSystemSupplyLineCalculatedSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingSelectedHeatCurveSystemSupplyLine' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingHeatCurveXCoordinate1' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingHeatCurveXCoordinate2' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingHeatCurveXCoordinate3' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingHeatCurveXCoordinate4' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingHeatCurveXCoordinate5' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingHeatCurveXCoordinate6' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingHeatCurveXCoordinate7' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueCoolingSeasonIntegralValue' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpCondenserCirculationPumpSpeed' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve1SupplyLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingBufferTankTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve1Position' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpBrineCirculationPumpSpeed' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueTapwaterHgwSupplyLineTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueTapwaterHgwDirectionalValvePosition' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpCompressorOperatingHoursMsb' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpCompressorOperatingHoursLsb' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueTapwaterOperatingHoursMsb' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueTapwaterOperatingHoursLsb' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpExternalAdditionalHeaterOperatingHoursMsb' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpExternalAdditionalHeaterOperatingHoursLsb' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpCompressorSpeedPercent' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpCurrentlyRunningSecondPrioritisedDemand' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpCurrentlyRunningThirdPrioritisedDemand' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpSoftwareVersionMajor' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpSoftwareVersionMinor' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpSoftwareVersionMicro' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpCompressorTemporarilyBlocked' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpCompressorCurrentGear' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpQueuedDemandFirstPriority' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpQueuedDemandSecondPriority' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpQueuedDemandThirdPriority' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpQueuedDemandFourthPriority' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpQueuedDemandFifthPriority' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpInternalAdditionalHeaterCurrentStep' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingBufferTankChargeSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueElectricMeterL1Current' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueElectricMeterL2Current' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueElectricMeterL3Current' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueElectricMeterL1ToNeutralVoltage' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueElectricMeterL2ToNeutralVoltage' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueElectricMeterL3ToNeutralVoltage' must be > 0");
+_Static_assert(10 > 0, "scale of 'valueElectricMeterL1ToL2Voltage' must be > 0");
+_Static_assert(10 > 0, "scale of 'valueElectricMeterL2ToL3Voltage' must be > 0");
+_Static_assert(10 > 0, "scale of 'valueElectricMeterL3ToL1Voltage' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueElectricMeterL1Power' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueElectricMeterL2Power' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueElectricMeterL3Power' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueElectricMeterValue' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpComfortMode' must be > 0");
+_Static_assert(10 > 0, "scale of 'valueElectricMeterKwhTotalLsb' must be > 0");
+_Static_assert(10 > 0, "scale of 'valueElectricMeterKwhTotalMsb' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueTapwaterWcsValvePosition' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueTapwaterTwcValvePosition' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve2Position' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve3Position' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve4Position' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve5Position' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueCoolingDewPointRoom' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueCoolingSupplyLineMixValvePosition' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueCoolingSurplusHeatFanSpeed' must be > 0");
+_Static_assert(100 > 0, "scale of 'valuePoolSupplyLineMixValvePosition' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueTapwaterTwcSupplyLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueTapwaterTwcReturnTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueTapwaterWcsReturnLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueTapwaterTwcEndTankTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve2SupplyLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve3SupplyLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve4SupplyLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueCoolingCircuitReturnLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueCoolingTankTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueCoolingTankReturnLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueCoolingCircuitSupplyLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve5SupplyLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve2ReturnLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve3ReturnLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve4ReturnLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve5ReturnLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueCoolingSurplusHeatReturnLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueCoolingSurplusHeatSupplyLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valuePoolSupplyLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valuePoolReturnLineTemperature' must be > 0");
+_Static_assert(10 > 0, "scale of 'valueHeatingRoomTemperatureSensor' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpBubblePointHighPressureTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpDewPointHighPressureTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpDewPointLowPressureTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpSuperheatTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpSubCoolingTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpLowPressureSidePressure' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpHighPressureSidePressure' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpLiquidLineTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpSuctionGasTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatingSeasonIntegralValue' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpPidPValue' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpPidIValue' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpPidDValue' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpBufferTankIValue' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatpumpBufferTankPValue' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatingMixValveCoolingOpeningDegree' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueTapwaterDesiredGear' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatingDesiredGear' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueCoolingDesiredGear' must be > 0");
+_Static_assert(1 > 0, "scale of 'valuePoolDesiredGear' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpNumberOfAvailableSecondariesGenesis' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpNumberOfAvailableSecondariesLegacy' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpTotalDistributedGearsAllUnits' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpMaximumGearCurrentlyRequested' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve1DesiredTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve2DesiredTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve3DesiredTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve4DesiredTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'valueHeatingMixValve5DesiredTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueTapwaterHgwDisconnectEndTank' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpLegacyCompressorRunning' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpLegacyReportingAlarm' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpLegacyStartSignal' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpLegacyTapWaterSignal' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpPrimaryUnitAlarmClassDCombined' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpPrimaryUnitAlarmLostCommunicationGenesis' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpPrimaryUnitAlarmClassASecondary' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpPrimaryUnitAlarmClassBSecondary' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpPrimaryUnitAlarmClassECombined' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpPrimaryUnitAlarmLegacyGeneral' must be > 0");
+_Static_assert(1 > 0, "scale of 'valueHeatpumpPrimaryUnitAlarmLegacyExpansionCardCommunication' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpOperationalMode' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMaxLimitationSetPointCurveRadiator' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMinLimitationSetPointCurveRadiator' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingComfortWheelSetting' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingHeatCurveYCoordinate1' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingHeatCurveYCoordinate2' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingHeatCurveYCoordinate3' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingHeatCurveYCoordinate4' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingHeatCurveYCoordinate5' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingHeatCurveYCoordinate6' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingHeatCurveYCoordinate7' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingSeasonStopTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterStartTemperature' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterStopTemperature' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpMinAllowedGearHeating' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpMaxAllowedGearHeating' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpMaxAllowedGearTapWater' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpMinAllowedGearTapWater' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingMixValveSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterTwcMixValveSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterWcsReturnLineSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterTwcMixValveLowestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterTwcMixValveHighestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterTwcStartTemperatureImmersionHeater' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterTwcStartDelayImmersionHeater' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterTwcStopTemperatureImmersionHeater' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterWcsMixValveLowestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterWcsMixValveHighestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2LowestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2HighestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3LowestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3HighestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4LowestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4HighestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5LowestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5HighestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingSurplusHeatChillerSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingSupplyLineMixValveLowestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingSupplyLineMixValveHighestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingSurplusHeatOpeningDegreeStartFan1' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingSurplusHeatOpeningDegreeStartFan2' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingSurplusHeatOpeningDegreeStopFan1' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingSurplusHeatOpeningDegreeStopFan2' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingSurplusHeatLowestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingSurplusHeatHighestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setPoolChargeSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'setPoolMixValveLowestAllowedOpeningDegree' must be > 0");
+_Static_assert(100 > 0, "scale of 'setPoolMixValveHighestAllowedOpeningDegree' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpGearShiftDelayHeating' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpGearShiftDelayPool' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpGearShiftDelayCooling' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpBrineInHighAlarmLimit' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpBrineInLowAlarmLimit' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpBrineOutLowAlarmLimit' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpBrineMaxDeltaLimit' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterHgwPumpStartTemperatureDischargePipe' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterHgwPumpLowerStopLimitTemperatureDischargePipe' must be > 0");
+_Static_assert(100 > 0, "scale of 'setTapwaterHgwPumpUpperStopLimitTemperatureDischargePipe' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpExternalAdditionalHeaterStartPidSum' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpCondenserPumpLowestAllowedSpeed' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpBrinePumpLowestAllowedSpeed' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpExternalAdditionalHeaterStopPidSum' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpCondenserPumpHighestAllowedSpeed' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpBrinePumpHighestAllowedSpeed' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpCondenserPumpStandbySpeed' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpBrinePumpStandbySpeed' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpMinAllowedGearPool' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpMaxAllowedGearPool' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpMinAllowedGearCooling' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatpumpMaxAllowedGearCooling' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingStartTemp' must be > 0");
+_Static_assert(100 > 0, "scale of 'setCoolingStopTemp' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve1MinLimitationSetPointCurve' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve1MaxLimitationSetPointCurve' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve1HeatCurveYCoordinate1' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve1HeatCurveYCoordinate2' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve1HeatCurveYCoordinate3' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve1HeatCurveYCoordinate4' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve1HeatCurveYCoordinate5' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve1HeatCurveYCoordinate6' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve1HeatCurveYCoordinate7' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingFixedSystemSupplySetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2MinLimitationSetPointCurve' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2MaxLimitationSetPointCurve' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2HeatCurveYCoordinate1' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2HeatCurveYCoordinate2' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2HeatCurveYCoordinate3' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2HeatCurveYCoordinate4' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2HeatCurveYCoordinate5' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2HeatCurveYCoordinate6' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2HeatCurveYCoordinate7' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3MinLimitationSetPointCurve' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3MaxLimitationSetPointCurve' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3HeatCurveYCoordinate1' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3HeatCurveYCoordinate2' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3HeatCurveYCoordinate3' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3HeatCurveYCoordinate4' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3HeatCurveYCoordinate5' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3HeatCurveYCoordinate6' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3HeatCurveYCoordinate7' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4MinLimitationSetPointCurve' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4MaxLimitationSetPointCurve' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4HeatCurveYCoordinate1' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4HeatCurveYCoordinate2' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4HeatCurveYCoordinate3' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4HeatCurveYCoordinate4' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4HeatCurveYCoordinate5' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4HeatCurveYCoordinate6' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4HeatCurveYCoordinate7' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5MinLimitationSetPointCurve' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5MaxLimitationSetPointCurve' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5HeatCurveYCoordinate1' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5HeatCurveYCoordinate2' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5HeatCurveYCoordinate3' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5HeatCurveYCoordinate4' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5HeatCurveYCoordinate5' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5HeatCurveYCoordinate6' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5HeatCurveYCoordinate7' must be > 0");
+_Static_assert(10 > 0, "scale of 'setPoolReturnTempFromPoolToHeatExchanger' must be > 0");
+_Static_assert(10 > 0, "scale of 'setPoolHysteresis' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve1SupplyLineTempPassiveCooling' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMinOutdoorTempCoolingPermitted' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatpumpExternalHeaterOutdoorTempLimit' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatingMixValve2SelectedMode' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2DesiredCoolingTempSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2SeasonalCoolingTemp' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve2SeasonalHeatingTemp' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatingMixValve3SelectedMode' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3DesiredCoolingTempSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3SeasonalCoolingTemp' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve3SeasonalHeatingTemp' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatingMixValve4SelectedMode' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4DesiredCoolingTempSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4SeasonalCoolingTemp' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve4SeasonalHeatingTemp' must be > 0");
+_Static_assert(1 > 0, "scale of 'setHeatingMixValve5SelectedMode' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5DesiredCoolingTempSetPoint' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5SeasonalCoolingTemp' must be > 0");
+_Static_assert(100 > 0, "scale of 'setHeatingMixValve5SeasonalHeatingTemp' must be > 0");
+
+#define REGISTERS_HASH_BUCKETS 110
+#define REGISTERS_HASH_SLOTS 439
+
+static const int16_t g_registers_hash_seeds[REGISTERS_HASH_BUCKETS] = {
+    33, 3, 6, 23, 428, 45, 57, 16, 55, 6, 3, 4, 32, 93, 16, 59,
+    65, 12, 34, 8, 6, 120, 63, 40, 16, 1, 40, 123, 60, 1, 1, 314,
+    2, 197, 143, 2, 199, 369, 1, 50, 2, -56, 259, 18, 51, 7, -182, 62,
+    35, -187, -218, 1, 8, 4, 74, 524, 21, 195, 108, 17, 1, 2, 0, 2,
+    49, 25, 26, 125, -275, 1, 2, 234, 54, 896, 2, 75, 14, 3, 46, 10,
+    30, 90, 127, -300, 461, 463, 16, 6, 2, -337, 254, 13, 104, 27, 4, 536,
+    -381, 301, 65, 345, 1697, 15, 33, 1360, 337, 1555, 111, 12, 12, 157,
+};
+static const uint16_t g_registers_hash_slots[REGISTERS_HASH_SLOTS] = {
+    238, 405, 190, 119, 351, 151, 390, 278, 379, 246, 121, 205, 410, 229, 37, 343,
+    164, 252, 176, 285, 308, 64, 116, 359, 162, 240, 288, 368, 96, 76, 34, 0,
+    412, 111, 14, 339, 241, 301, 215, 336, 98, 363, 333, 388, 47, 306, 130, 10,
+    404, 131, 275, 43, 72, 62, 107, 391, 84, 218, 330, 403, 296, 93, 163, 365,
+    108, 360, 142, 105, 231, 236, 15, 328, 199, 71, 86, 80, 214, 125, 65, 137,
+    158, 106, 9, 155, 6, 434, 326, 225, 324, 221, 141, 307, 50, 193, 375, 245,
+    290, 372, 353, 227, 332, 436, 322, 32, 152, 425, 239, 348, 413, 327, 147, 197,
+    179, 386, 181, 200, 209, 100, 415, 145, 311, 144, 165, 210, 350, 273, 167, 263,
+    172, 401, 91, 58, 262, 122, 248, 83, 194, 183, 24, 264, 312, 11, 113, 437,
+    82, 431, 362, 299, 81, 400, 335, 204, 196, 185, 320, 417, 432, 134, 373, 177,
+    321, 423, 316, 171, 126, 63, 315, 358, 124, 175, 70, 135, 266, 255, 88, 314,
+    156, 143, 39, 394, 207, 19, 216, 188, 272, 416, 191, 45, 150, 382, 366, 381,
+    29, 40, 355, 146, 27, 378, 234, 169, 67, 41, 329, 349, 342, 49, 265, 161,
+    269, 59, 92, 211, 61, 303, 117, 367, 77, 357, 397, 268, 371, 139, 123, 153,
+    256, 133, 60, 159, 430, 75, 309, 180, 16, 54, 292, 97, 201, 313, 427, 411,
+    276, 87, 53, 243, 232, 267, 73, 228, 380, 230, 198, 261, 398, 271, 89, 44,
+    5, 99, 414, 148, 90, 399, 235, 282, 325, 115, 247, 202, 356, 393, 118, 258,
+    174, 138, 212, 408, 364, 433, 242, 3, 383, 79, 426, 435, 284, 203, 319, 294,
+    323, 281, 22, 189, 389, 52, 66, 78, 38, 253, 132, 297, 120, 168, 17, 287,
+    157, 340, 206, 402, 361, 110, 18, 428, 341, 30, 33, 149, 406, 251, 304, 317,
+    270, 35, 31, 305, 259, 217, 283, 154, 385, 208, 226, 250, 409, 220, 192, 25,
+    173, 222, 69, 302, 13, 318, 274, 127, 101, 160, 102, 286, 260, 352, 257, 374,
+    20, 104, 293, 224, 254, 244, 438, 136, 4, 277, 419, 354, 295, 338, 36, 103,
+    279, 213, 223, 178, 344, 94, 109, 384, 370, 334, 166, 129, 377, 420, 114, 310,
+    422, 95, 195, 331, 170, 395, 337, 2, 68, 8, 42, 56, 369, 51, 26, 85,
+    46, 345, 1, 182, 28, 140, 21, 347, 219, 186, 396, 291, 418, 184, 237, 421,
+    187, 298, 346, 48, 12, 424, 429, 128, 392, 7, 23, 376, 289, 387, 55, 233,
+    249, 112, 300, 57, 407, 74, 280,
+};
+
+#define REGISTERS_VALUE_PAIRS 4
+
+static const uint8_t g_registers_kinds[REGISTERS_HASH_SLOTS] = {
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT, VALUE_BIT,
+    VALUE_S16, VALUE_S16, VALUE_U16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_U32_MSB,
+    VALUE_U32_LSB, VALUE_U32_MSB, VALUE_U32_LSB, VALUE_U32_MSB, VALUE_U32_LSB, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_U16, VALUE_U16, VALUE_U16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_U16,
+    VALUE_U16, VALUE_U16, VALUE_U16, VALUE_U16, VALUE_U16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_U32_LSB, VALUE_U32_MSB, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+    VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16, VALUE_S16,
+};
+static const double g_registers_multipliers[REGISTERS_HASH_SLOTS] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0.01, 1, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01,
+    0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 1, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 1, 1,
+    1, 1, 1, 1, 1, 0.01, 1, 1, 1, 1, 1, 1, 0.01, 1, 1, 1,
+    1, 1, 1, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.1, 0.1, 0.1, 1, 1, 1,
+    1, 1, 0.1, 0.1, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01,
+    0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01,
+    0.01, 0.01, 0.1, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 1, 0.01, 0.01, 0.01,
+    0.01, 0.01, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0.01, 0.01, 0.01, 0.01, 0.01,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0.01, 0.01, 0.01,
+    0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 1, 1, 1, 1, 0.01, 0.01,
+    0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01,
+    0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 1, 1, 1, 0.01,
+    0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 1, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 1, 1,
+    1, 1, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01,
+    0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01,
+    0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01, 0.01,
+    0.01, 0.01, 0.1, 0.1, 0.01, 0.01, 0.01, 1, 0.01, 0.01, 0.01, 1, 0.01, 0.01, 0.01, 1,
+    0.01, 0.01, 0.01, 1, 0.01, 0.01, 0.01,
+};
+static const uint16_t g_registers_value_pairs[REGISTERS_VALUE_PAIRS][2] = {
+    {191, 192}, {193, 194}, {195, 196}, {227, 226},
+};
+
+static const uint16_t g_registers_mega_order[411] = {
+    0, 2, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 21, 23, 24, 25, 26, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+    53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68,
+    69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84,
+    85, 86, 87, 88, 89, 90, 91, 92, 93, 96, 97, 98, 99, 100, 101, 102,
+    103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+    119, 120, 121, 123, 124, 125, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136,
+    137, 138, 139, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154,
+    155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170,
+    171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186,
+    187, 188, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203,
+    204, 205, 206, 207, 208, 209, 211, 225, 228, 229, 230, 231, 232, 233, 234, 235,
+    236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251,
+    252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+    268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+    284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299,
+    300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+    316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331,
+    332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347,
+    348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363,
+    364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379,
+    380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395,
+    396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411,
+    412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427,
+    428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 438,
+};
+static const int16_t g_registers_mega_positions[REGISTERS_HASH_SLOTS] = {
+    0, -1, 1, -1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, -1, 18, -1, 19, 20, 21, 22, -1, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42,
+    43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58,
+    59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74,
+    75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, -1, -1,
+    89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, -1, 115, 116, 117, -1, 118,
+    119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, -1, -1, 131, 132,
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+    149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, -1, 178, 179,
+    180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195,
+    196, 197, -1, 198, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 199, -1, -1, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+    212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227,
+    228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243,
+    244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259,
+    260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275,
+    276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291,
+    292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307,
+    308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323,
+    324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339,
+    340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355,
+    356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371,
+    372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387,
+    388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403,
+    404, 405, 406, 407, 408, 409, 410,
+};
+static const uint16_t g_registers_mega_runs_of[411] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+};
+static const register_run_t g_registers_mega_runs[13] = {
+    {REG_COIL_STATUS, 3, 56, 0, 49}, {REG_INPUT_STATUS, 0, 86, 49, 69}, {REG_INPUT_STATUS, 199, 48, 118, 31}, {REG_INPUT, 1, 26, 149, 23},
+    {REG_INPUT, 36, 33, 172, 27}, {REG_INPUT, 82, 82, 199, 70}, {REG_INPUT, 170, 4, 269, 3}, {REG_HOLDING, 0, 17, 272, 12},
+    {REG_HOLDING, 22, 67, 284, 58}, {REG_HOLDING, 105, 12, 342, 12}, {REG_HOLDING, 199, 18, 354, 18}, {REG_HOLDING, 239, 18, 372, 18},
+    {REG_HOLDING, 299, 22, 390, 21},
+};
+static const uint16_t g_registers_mega_group_positions[411] = {
+    0, 1, 2, 3, 4, 14, 15, 16, 18, 24, 25, 29, 30, 32, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 65, 66, 67,
+    68, 69, 70, 71, 72, 73, 74, 86, 89, 90, 91, 100, 109, 113, 115, 116,
+    117, 118, 119, 120, 121, 122, 124, 127, 128, 130, 131, 132, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 159, 173, 177, 179, 180, 183, 184, 185, 186, 187,
+    188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 199, 231, 232, 233, 234, 235,
+    236, 237, 238, 239, 241, 242, 243, 244, 245, 251, 252, 253, 254, 261, 262, 263,
+    264, 265, 266, 267, 268, 269, 270, 271, 272, 286, 287, 288, 289, 320, 321, 322,
+    323, 324, 325, 326, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341,
+    394, 178, 260, 327, 328, 329, 5, 21, 23, 112, 172, 249, 6, 26, 27, 28,
+    76, 94, 123, 147, 174, 176, 255, 344, 345, 346, 347, 348, 349, 350, 351, 352,
+    392, 393, 7, 82, 88, 92, 93, 114, 133, 136, 201, 210, 211, 213, 291, 293,
+    294, 295, 296, 297, 8, 81, 99, 134, 135, 200, 212, 292, 298, 299, 9, 87,
+    126, 160, 161, 162, 181, 182, 247, 284, 285, 10, 33, 34, 35, 45, 77, 95,
+    202, 214, 222, 256, 300, 301, 354, 355, 356, 357, 358, 359, 360, 361, 362, 395,
+    396, 397, 398, 11, 36, 37, 38, 46, 78, 96, 203, 215, 223, 257, 302, 303,
+    363, 364, 365, 366, 367, 368, 369, 370, 371, 399, 400, 401, 402, 12, 39, 40,
+    41, 47, 79, 97, 204, 216, 224, 258, 304, 305, 372, 373, 374, 375, 376, 377,
+    378, 379, 380, 403, 404, 405, 406, 13, 42, 43, 44, 48, 80, 98, 205, 221,
+    225, 259, 306, 307, 381, 382, 383, 384, 385, 386, 387, 388, 389, 407, 408, 409,
+    410, 17, 85, 101, 104, 138, 142, 206, 207, 217, 220, 290, 309, 310, 19, 22,
+    110, 111, 137, 139, 146, 209, 228, 229, 250, 317, 318, 319, 390, 391, 20, 103,
+    105, 106, 140, 141, 143, 208, 226, 227, 308, 311, 312, 313, 314, 315, 316, 31,
+    64, 75, 108, 125, 129, 158, 163, 164, 165, 166, 167, 168, 169, 170, 171, 175,
+    198, 230, 240, 246, 248, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283,
+    353, 83, 84, 102, 107, 144, 145, 218, 219, 342, 343,
+};
+static const register_run_t g_registers_mega_group_runs[93] = {
+    {REG_COIL_STATUS, 3, 40, 0, 14}, {REG_INPUT_STATUS, 0, 86, 14, 35}, {REG_INPUT_STATUS, 199, 48, 49, 12}, {REG_INPUT, 1, 13, 61, 10},
+    {REG_INPUT, 39, 28, 71, 19}, {REG_INPUT, 82, 82, 90, 27}, {REG_INPUT, 170, 4, 117, 3}, {REG_HOLDING, 0, 1, 120, 1},
+    {REG_HOLDING, 26, 63, 121, 23}, {REG_HOLDING, 304, 1, 144, 1}, {REG_INPUT, 47, 1, 145, 1}, {REG_INPUT, 152, 1, 146, 1},
+    {REG_HOLDING, 71, 3, 147, 3}, {REG_COIL_STATUS, 10, 24, 150, 3}, {REG_INPUT_STATUS, 78, 1, 153, 1}, {REG_INPUT, 36, 1, 154, 1},
+    {REG_INPUT, 141, 1, 155, 1}, {REG_COIL_STATUS, 11, 28, 156, 4}, {REG_INPUT_STATUS, 36, 25, 160, 2}, {REG_INPUT_STATUS, 209, 37, 162, 2},
+    {REG_INPUT, 40, 4, 164, 2}, {REG_INPUT, 147, 1, 166, 1}, {REG_HOLDING, 107, 9, 167, 9}, {REG_HOLDING, 302, 2, 176, 2},
+    {REG_COIL_STATUS, 12, 1, 178, 1}, {REG_INPUT_STATUS, 45, 37, 179, 5}, {REG_INPUT_STATUS, 230, 5, 184, 2}, {REG_INPUT, 86, 13, 186, 4},
+    {REG_HOLDING, 31, 7, 190, 6}, {REG_COIL_STATUS, 13, 1, 196, 1}, {REG_INPUT_STATUS, 44, 22, 197, 2}, {REG_INPUT_STATUS, 232, 2, 199, 2},
+    {REG_INPUT, 85, 13, 201, 2}, {REG_HOLDING, 32, 8, 203, 3}, {REG_COIL_STATUS, 14, 1, 206, 1}, {REG_INPUT_STATUS, 50, 1, 207, 1},
+    {REG_INPUT_STATUS, 213, 1, 208, 1}, {REG_INPUT, 15, 3, 209, 3}, {REG_INPUT, 50, 2, 212, 2}, {REG_INPUT, 139, 1, 214, 1},
+    {REG_HOLDING, 22, 2, 215, 2}, {REG_COIL_STATUS, 16, 40, 217, 5}, {REG_INPUT_STATUS, 37, 25, 222, 2}, {REG_INPUT, 87, 62, 224, 4},
+    {REG_HOLDING, 40, 2, 228, 2}, {REG_HOLDING, 199, 9, 230, 9}, {REG_HOLDING, 305, 4, 239, 4}, {REG_COIL_STATUS, 17, 40, 243, 5},
+    {REG_INPUT_STATUS, 38, 25, 248, 2}, {REG_INPUT, 88, 62, 250, 4}, {REG_HOLDING, 42, 2, 254, 2}, {REG_HOLDING, 208, 9, 256, 9},
+    {REG_HOLDING, 309, 4, 265, 4}, {REG_COIL_STATUS, 18, 40, 269, 5}, {REG_INPUT_STATUS, 39, 25, 274, 2}, {REG_INPUT, 89, 62, 276, 4},
+    {REG_HOLDING, 44, 2, 280, 2}, {REG_HOLDING, 239, 9, 282, 9}, {REG_HOLDING, 313, 4, 291, 4}, {REG_COIL_STATUS, 19, 40, 295, 5},
+    {REG_INPUT_STATUS, 40, 25, 300, 2}, {REG_INPUT, 90, 62, 302, 4}, {REG_HOLDING, 46, 2, 306, 2}, {REG_HOLDING, 248, 9, 308, 9},
+    {REG_HOLDING, 317, 4, 317, 4}, {REG_COIL_STATUS, 23, 1, 321, 1}, {REG_INPUT_STATUS, 48, 23, 322, 3}, {REG_INPUT_STATUS, 236, 5, 325, 2},
+    {REG_INPUT, 91, 16, 327, 4}, {REG_HOLDING, 30, 21, 331, 3}, {REG_COIL_STATUS, 28, 4, 334, 2}, {REG_INPUT_STATUS, 76, 2, 336, 2},
+    {REG_INPUT_STATUS, 235, 10, 338, 3}, {REG_INPUT, 94, 49, 341, 4}, {REG_HOLDING, 58, 3, 345, 3}, {REG_HOLDING, 299, 2, 348, 2},
+    {REG_COIL_STATUS, 29, 1, 350, 1}, {REG_INPUT_STATUS, 69, 4, 351, 3}, {REG_INPUT_STATUS, 238, 4, 354, 3}, {REG_INPUT, 93, 26, 357, 3},
+    {REG_HOLDING, 48, 9, 360, 7}, {REG_COIL_STATUS, 41, 1, 367, 1}, {REG_INPUT_STATUS, 24, 51, 368, 3}, {REG_INPUT_STATUS, 211, 10, 371, 2},
+    {REG_INPUT, 12, 15, 373, 10}, {REG_INPUT, 41, 28, 383, 2}, {REG_INPUT, 121, 20, 385, 4}, {REG_HOLDING, 3, 14, 389, 11},
+    {REG_HOLDING, 116, 1, 400, 1}, {REG_INPUT_STATUS, 46, 28, 401, 4}, {REG_INPUT_STATUS, 242, 2, 405, 2}, {REG_INPUT, 104, 2, 407, 2},
+    {REG_HOLDING, 105, 2, 409, 2},
+};
+static const register_group_plan_t g_registers_mega_groups[REGISTERS_GROUPS] = {
+    {0, 145, 0, 10}, {145, 5, 10, 3}, {150, 6, 13, 4}, {156, 22, 17, 7}, {178, 18, 24, 5}, {196, 10, 29, 5}, {206, 11, 34, 7}, {217, 26, 41, 6},
+    {243, 26, 47, 6}, {269, 26, 53, 6}, {295, 26, 59, 6}, {321, 13, 65, 5}, {334, 0, 70, 0}, {334, 16, 70, 6}, {350, 17, 76, 5}, {367, 34, 81, 8},
+    {401, 10, 89, 4},
+};
+
+static const uint16_t g_registers_inverter_order[330] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 13, 14, 15, 16, 17,
+    18, 20, 21, 22, 23, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 54, 55, 56, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70,
+    71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 87,
+    89, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+    107, 115, 116, 117, 118, 119, 121, 122, 126, 127, 128, 129, 130, 131, 132, 133,
+    134, 136, 137, 138, 139, 140, 141, 142, 143, 144, 147, 148, 150, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 191, 192,
+    193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+    209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224,
+    225, 226, 227, 229, 230, 231, 232, 233, 238, 239, 241, 242, 243, 244, 249, 250,
+    251, 252, 253, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268,
+    269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 281, 282, 283, 284, 285, 286,
+    287, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314,
+    315, 316, 317, 319, 321, 322, 323, 324, 325, 328, 329, 330, 331, 332, 333, 334,
+    335, 345, 348, 349, 350, 351, 352, 353, 354, 358, 359, 360, 361, 362, 363, 364,
+    365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380,
+    381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396,
+    397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409, 410, 411, 412,
+    413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+};
+static const int16_t g_registers_inverter_positions[REGISTERS_HASH_SLOTS] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, -1, -1, 10, 11, 12, 13,
+    14, 15, 16, -1, 17, 18, 19, 20, -1, -1, 21, 22, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 33, 34, 35, -1, -1, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56,
+    57, 58, 59, 60, 61, 62, -1, 63, -1, 64, -1, 65, 66, 67, 68, 69,
+    70, 71, 72, 73, 74, 75, 76, 77, 78, 79, -1, 80, -1, -1, -1, -1,
+    -1, -1, -1, 81, 82, 83, 84, 85, -1, 86, 87, -1, -1, -1, 88, 89,
+    90, 91, 92, 93, 94, 95, 96, -1, 97, 98, 99, 100, 101, 102, 103, 104,
+    105, -1, -1, 106, 107, -1, 108, -1, -1, -1, -1, -1, -1, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, -1, 142,
+    143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+    159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+    175, 176, 177, 178, -1, 179, 180, 181, 182, 183, -1, -1, -1, -1, 184, 185,
+    -1, 186, 187, 188, 189, -1, -1, -1, -1, 190, 191, 192, 193, 194, -1, -1,
+    195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210,
+    211, 212, 213, 214, 215, 216, 217, -1, -1, 218, 219, 220, 221, 222, 223, 224,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, -1, 243,
+    -1, 244, 245, 246, 247, 248, -1, -1, 249, 250, 251, 252, 253, 254, 255, 256,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 257, -1, -1, 258, 259, 260, 261,
+    262, 263, 264, -1, -1, -1, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274,
+    275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290,
+    291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306,
+    307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322,
+    323, 324, 325, 326, 327, 328, 329, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1,
+};
+static const uint16_t g_registers_inverter_runs_of[330] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 12, 12, 12, 12, 12,
+};
+static const register_run_t g_registers_inverter_runs[13] = {
+    {REG_COIL_STATUS, 3, 40, 0, 33}, {REG_INPUT_STATUS, 0, 87, 33, 56}, {REG_INPUT_STATUS, 199, 48, 89, 23}, {REG_INPUT, 1, 26, 112, 23},
+    {REG_INPUT, 36, 66, 135, 55}, {REG_INPUT, 107, 45, 190, 35}, {REG_HOLDING, 0, 17, 225, 12}, {REG_HOLDING, 22, 26, 237, 20},
+    {REG_HOLDING, 58, 31, 257, 20}, {REG_HOLDING, 105, 12, 277, 12}, {REG_HOLDING, 199, 18, 289, 18}, {REG_HOLDING, 239, 18, 307, 18},
+    {REG_HOLDING, 299, 6, 325, 5},
+};
+static const uint16_t g_registers_inverter_group_positions[330] = {
+    0, 1, 2, 4, 5, 6, 14, 15, 16, 18, 24, 25, 29, 30, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 47, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 65, 69, 70, 71, 72, 80, 82, 88, 89, 90,
+    91, 92, 93, 95, 97, 98, 100, 101, 103, 104, 111, 112, 113, 114, 115, 116,
+    117, 118, 119, 120, 122, 136, 140, 142, 143, 146, 147, 148, 149, 150, 151, 152,
+    153, 154, 155, 156, 157, 158, 159, 160, 161, 176, 198, 199, 200, 201, 202, 203,
+    204, 205, 206, 208, 209, 210, 211, 212, 218, 219, 225, 239, 240, 241, 242, 258,
+    259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274,
+    275, 276, 329, 3, 68, 102, 141, 7, 23, 85, 135, 216, 8, 26, 27, 28,
+    58, 75, 94, 110, 137, 139, 220, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    327, 328, 9, 63, 67, 73, 74, 86, 105, 106, 179, 184, 185, 186, 243, 244,
+    245, 246, 247, 248, 17, 66, 87, 123, 124, 125, 144, 145, 214, 237, 238, 10,
+    59, 76, 180, 187, 191, 221, 249, 250, 289, 290, 291, 292, 293, 294, 295, 296,
+    297, 11, 60, 77, 181, 188, 192, 222, 251, 252, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 12, 61, 78, 182, 189, 193, 223, 253, 254, 307, 308, 309, 310,
+    311, 312, 313, 314, 315, 13, 62, 79, 183, 190, 194, 224, 255, 256, 316, 317,
+    318, 319, 320, 321, 322, 323, 324, 19, 163, 164, 165, 166, 167, 168, 169, 170,
+    171, 172, 173, 174, 175, 177, 178, 20, 21, 22, 83, 84, 107, 108, 109, 195,
+    196, 217, 257, 325, 326, 31, 46, 57, 81, 96, 99, 121, 126, 127, 128, 129,
+    130, 131, 132, 133, 134, 138, 162, 197, 207, 213, 215, 226, 227, 228, 229, 230,
+    231, 232, 233, 234, 235, 236, 288, 64, 277, 278,
+};
+static const register_run_t g_registers_inverter_group_runs[78] = {
+    {REG_COIL_STATUS, 3, 40, 0, 15}, {REG_INPUT_STATUS, 0, 87, 15, 31}, {REG_INPUT_STATUS, 199, 48, 46, 13}, {REG_INPUT, 1, 13, 59, 10},
+    {REG_INPUT, 39, 44, 69, 21}, {REG_INPUT, 122, 25, 90, 16}, {REG_HOLDING, 0, 1, 106, 1}, {REG_HOLDING, 26, 4, 107, 4},
+    {REG_HOLDING, 61, 28, 111, 19}, {REG_HOLDING, 304, 1, 130, 1}, {REG_COIL_STATUS, 6, 1, 131, 1}, {REG_INPUT_STATUS, 52, 1, 132, 1},
+    {REG_INPUT_STATUS, 223, 1, 133, 1}, {REG_INPUT, 45, 1, 134, 1}, {REG_COIL_STATUS, 10, 24, 135, 2}, {REG_INPUT_STATUS, 78, 1, 137, 1},
+    {REG_INPUT, 36, 1, 138, 1}, {REG_INPUT, 141, 1, 139, 1}, {REG_COIL_STATUS, 11, 28, 140, 4}, {REG_INPUT_STATUS, 36, 25, 144, 2},
+    {REG_INPUT_STATUS, 209, 37, 146, 2}, {REG_INPUT, 40, 4, 148, 2}, {REG_INPUT, 147, 1, 150, 1}, {REG_HOLDING, 107, 9, 151, 9},
+    {REG_HOLDING, 302, 2, 160, 2}, {REG_COIL_STATUS, 12, 1, 162, 1}, {REG_INPUT_STATUS, 45, 37, 163, 5}, {REG_INPUT_STATUS, 230, 5, 168, 2},
+    {REG_INPUT, 86, 13, 170, 4}, {REG_HOLDING, 31, 7, 174, 6}, {REG_COIL_STATUS, 24, 1, 180, 1}, {REG_INPUT_STATUS, 50, 33, 181, 2},
+    {REG_INPUT, 15, 3, 183, 3}, {REG_INPUT, 50, 2, 186, 2}, {REG_INPUT, 139, 1, 188, 1}, {REG_HOLDING, 22, 2, 189, 2},
+    {REG_COIL_STATUS, 16, 1, 191, 1}, {REG_INPUT_STATUS, 37, 25, 192, 2}, {REG_INPUT, 87, 13, 194, 2}, {REG_INPUT, 109, 40, 196, 2},
+    {REG_HOLDING, 40, 2, 198, 2}, {REG_HOLDING, 199, 9, 200, 9}, {REG_COIL_STATUS, 17, 1, 209, 1}, {REG_INPUT_STATUS, 38, 25, 210, 2},
+    {REG_INPUT, 88, 13, 212, 2}, {REG_INPUT, 111, 39, 214, 2}, {REG_HOLDING, 42, 2, 216, 2}, {REG_HOLDING, 208, 9, 218, 9},
+    {REG_COIL_STATUS, 18, 1, 227, 1}, {REG_INPUT_STATUS, 39, 25, 228, 2}, {REG_INPUT, 89, 13, 230, 2}, {REG_INPUT, 113, 38, 232, 2},
+    {REG_HOLDING, 44, 2, 234, 2}, {REG_HOLDING, 239, 9, 236, 9}, {REG_COIL_STATUS, 19, 1, 245, 1}, {REG_INPUT_STATUS, 40, 25, 246, 2},
+    {REG_INPUT, 90, 1, 248, 1}, {REG_INPUT, 107, 45, 249, 3}, {REG_HOLDING, 46, 2, 252, 2}, {REG_HOLDING, 248, 9, 254, 9},
+    {REG_COIL_STATUS, 26, 1, 263, 1}, {REG_INPUT, 69, 16, 264, 15}, {REG_COIL_STATUS, 28, 5, 279, 3}, {REG_INPUT_STATUS, 76, 2, 282, 2},
+    {REG_INPUT_STATUS, 235, 10, 284, 3}, {REG_INPUT, 119, 24, 287, 3}, {REG_HOLDING, 58, 1, 290, 1}, {REG_HOLDING, 299, 2, 291, 2},
+    {REG_COIL_STATUS, 41, 1, 293, 1}, {REG_INPUT_STATUS, 24, 51, 294, 3}, {REG_INPUT_STATUS, 211, 10, 297, 2}, {REG_INPUT, 12, 15, 299, 10},
+    {REG_INPUT, 41, 28, 309, 2}, {REG_INPUT, 121, 20, 311, 4}, {REG_HOLDING, 3, 14, 315, 11}, {REG_HOLDING, 116, 1, 326, 1},
+    {REG_INPUT_STATUS, 47, 1, 327, 1}, {REG_HOLDING, 105, 2, 328, 2},
+};
+static const register_group_plan_t g_registers_inverter_groups[REGISTERS_GROUPS] = {
+    {0, 131, 0, 10}, {131, 4, 10, 4}, {135, 5, 14, 4}, {140, 22, 18, 7}, {162, 18, 25, 5}, {180, 0, 30, 0}, {180, 11, 30, 6}, {191, 18, 36, 6},
+    {209, 18, 42, 6}, {227, 18, 48, 6}, {245, 18, 54, 6}, {263, 0, 60, 0}, {263, 16, 60, 2}, {279, 14, 62, 6}, {293, 0, 68, 0}, {293, 34, 68, 8},
+    {327, 3, 76, 2},
+};
+
+static const register_model_table_t g_registers_models[] = {
+    {MODEL_MEGA, g_registers_mega_order, g_registers_mega_positions, g_registers_mega_runs_of, sizeof(g_registers_mega_order) / sizeof(uint16_t), g_registers_mega_runs, sizeof(g_registers_mega_runs) / sizeof(register_run_t), g_registers_mega_groups, g_registers_mega_group_positions, g_registers_mega_group_runs},
+    {MODEL_INVERTER, g_registers_inverter_order, g_registers_inverter_positions, g_registers_inverter_runs_of, sizeof(g_registers_inverter_order) / sizeof(uint16_t), g_registers_inverter_runs, sizeof(g_registers_inverter_runs) / sizeof(register_run_t), g_registers_inverter_groups, g_registers_inverter_group_positions, g_registers_inverter_group_runs},
+};